@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+#include "GameEngine/Core/AssetArchive.h"
+#include "GameEngine/Core/FileSystem.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+namespace {
+
+constexpr size_t kFiles = 1000;
+constexpr size_t kFileSize = 4096;
+
+// kFiles small assets written both as loose files and into one pack. The
+// page cache is warm after the first iteration, so this measures per-file
+// overhead rather than the disk.
+class AssetSet {
+public:
+    explicit AssetSet(benchmark::State& state) {
+        const std::filesystem::path root = std::filesystem::temp_directory_path();
+        directory = (root / "GameEngineBenchmarks_assets").string();
+        packFile = (root / "GameEngineBenchmarks_assets.pack").string();
+        std::filesystem::create_directories(directory);
+
+        AssetArchiveBuilder builder;
+        std::vector<char> data(kFileSize);
+        for (size_t i = 0; i < kFiles; ++i) {
+            for (size_t j = 0; j < kFileSize; ++j) {
+                data[j] = static_cast<char>((i * 131 + j) * 7);
+            }
+            names.push_back("asset_" + std::to_string(i) + ".bin");
+            if (!FileSystem::WriteBinaryFile(directory + "/" + names.back(), data)) {
+                state.SkipWithError("cannot write loose files");
+                return;
+            }
+            builder.AddData(names.back(), data);
+        }
+        if (!builder.Write(packFile)) {
+            state.SkipWithError("cannot write pack file");
+        }
+    }
+    ~AssetSet() {
+        std::filesystem::remove_all(directory);
+        std::remove(packFile.c_str());
+    }
+
+    AssetSet(const AssetSet&) = delete;
+    AssetSet& operator=(const AssetSet&) = delete;
+
+    std::string directory;
+    std::string packFile;
+    std::vector<std::string> names;
+};
+
+} // namespace
+
+static void BM_LooseFilesRead(benchmark::State& state) {
+    AssetSet assets(state);
+    for (auto _ : state) {
+        size_t bytes = 0;
+        for (const std::string& name : assets.names) {
+            bytes += FileSystem::ReadBinaryFile(assets.directory + "/" + name).value_or(std::vector<char>()).size();
+        }
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kFiles));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(kFiles * kFileSize));
+}
+BENCHMARK(BM_LooseFilesRead)->Unit(benchmark::kMicrosecond);
+
+// Opening the pack is part of the cost, as it is at load time
+static void BM_AssetArchiveOpenAndRead(benchmark::State& state) {
+    AssetSet assets(state);
+    for (auto _ : state) {
+        std::shared_ptr<AssetArchive> archive = AssetArchive::Open(assets.packFile);
+        if (!archive) {
+            state.SkipWithError("cannot open pack file");
+            break;
+        }
+        size_t bytes = 0;
+        for (const std::string& name : assets.names) {
+            bytes += archive->Read(*archive->Find(name)).value_or(std::vector<char>()).size();
+        }
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kFiles));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(kFiles * kFileSize));
+}
+BENCHMARK(BM_AssetArchiveOpenAndRead)->Unit(benchmark::kMicrosecond);
+
+static void BM_AssetArchiveFind(benchmark::State& state) {
+    AssetSet assets(state);
+    std::shared_ptr<AssetArchive> archive = AssetArchive::Open(assets.packFile);
+    if (!archive) {
+        state.SkipWithError("cannot open pack file");
+        return;
+    }
+    size_t next = 0;
+    for (auto _ : state) {
+        const AssetPack::Entry* entry = archive->Find(assets.names[next]);
+        benchmark::DoNotOptimize(entry);
+        next = next + 1 == kFiles ? 0 : next + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AssetArchiveFind);
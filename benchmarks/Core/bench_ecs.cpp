@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include "GameEngine/Core/ECS.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+namespace {
+
+struct Position {
+    float x, y, z;
+};
+
+struct Velocity {
+    float x, y, z;
+};
+
+constexpr size_t kEntities = 1000000;
+constexpr float kStep = 0.016f;
+
+void FillWorld(World& world) {
+    for (size_t i = 0; i < kEntities; ++i) {
+        world.CreateEntity(Position{0.0f, 0.0f, 0.0f}, Velocity{1.0f, 2.0f, 3.0f});
+    }
+}
+
+// Position read and written, Velocity read
+void SetIntegrateCounters(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kEntities));
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(kEntities * (2 * sizeof(Position) + sizeof(Velocity))));
+}
+
+} // namespace
+
+// The same data as plain arrays, the bandwidth bound for the queries below
+static void BM_ArraysIntegrate(benchmark::State& state) {
+    std::vector<Position> positions(kEntities, Position{0.0f, 0.0f, 0.0f});
+    const std::vector<Velocity> velocities(kEntities, Velocity{1.0f, 2.0f, 3.0f});
+    for (auto _ : state) {
+        Position* p = positions.data();
+        const Velocity* v = velocities.data();
+        for (size_t i = 0; i < kEntities; ++i) {
+            p[i].x += v[i].x * kStep;
+            p[i].y += v[i].y * kStep;
+            p[i].z += v[i].z * kStep;
+        }
+        benchmark::DoNotOptimize(p);
+        benchmark::ClobberMemory();
+    }
+    SetIntegrateCounters(state);
+}
+BENCHMARK(BM_ArraysIntegrate)->Unit(benchmark::kMillisecond);
+
+static void BM_WorldEach(benchmark::State& state) {
+    World world;
+    FillWorld(world);
+    for (auto _ : state) {
+        world.Each<Position, const Velocity>([](Position& p, const Velocity& v) {
+            p.x += v.x * kStep;
+            p.y += v.y * kStep;
+            p.z += v.z * kStep;
+        });
+        benchmark::ClobberMemory();
+    }
+    SetIntegrateCounters(state);
+}
+BENCHMARK(BM_WorldEach)->Unit(benchmark::kMillisecond);
+
+static void BM_WorldParallelEach(benchmark::State& state) {
+    World world;
+    FillWorld(world);
+    JobSystem jobs;
+    state.SetLabel(std::to_string(jobs.GetThreadCount()) + " threads");
+    for (auto _ : state) {
+        world.ParallelEach<Position, const Velocity>(jobs, [](Position& p, const Velocity& v) {
+            p.x += v.x * kStep;
+            p.y += v.y * kStep;
+            p.z += v.z * kStep;
+        });
+        benchmark::ClobberMemory();
+    }
+    SetIntegrateCounters(state);
+}
+BENCHMARK(BM_WorldParallelEach)->Unit(benchmark::kMillisecond)->UseRealTime();
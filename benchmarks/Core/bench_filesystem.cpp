@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+#include "GameEngine/Core/FileSystem.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+namespace {
+
+// A scratch file of the size given as the benchmark's argument. Reads are
+// served from the page cache after the first iteration, so this measures
+// the engine's read path, not the disk.
+class ScratchFile {
+public:
+    explicit ScratchFile(benchmark::State& state) : size(static_cast<size_t>(state.range(0))) {
+        path = (std::filesystem::temp_directory_path() / ("GameEngineBenchmarks_" + std::to_string(size) + ".bin"))
+                   .string();
+        std::vector<char> data(size);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<char>(i * 131u);
+        }
+        if (!FileSystem::WriteBinaryFile(path, data)) {
+            state.SkipWithError("cannot write scratch file");
+        }
+    }
+    ~ScratchFile() { std::remove(path.c_str()); }
+
+    ScratchFile(const ScratchFile&) = delete;
+    ScratchFile& operator=(const ScratchFile&) = delete;
+
+    const std::string& Path() const { return path; }
+    size_t Size() const { return size; }
+
+private:
+    std::string path;
+    size_t size;
+};
+
+// 4 KB to 16 MB, a config file to a large texture
+void FileSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgName("bytes")->RangeMultiplier(16)->Range(4 << 10, 16 << 20);
+}
+
+// Touches one byte per page, so lazily mapped files are faulted in too
+uint64_t TouchPages(const char* data, size_t size) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < size; i += 4096) {
+        sum += static_cast<unsigned char>(data[i]);
+    }
+    return sum;
+}
+
+} // namespace
+
+static void BM_FileSystemReadBinary(benchmark::State& state) {
+    ScratchFile file(state);
+    for (auto _ : state) {
+        std::optional<std::vector<char>> data = FileSystem::ReadBinaryFile(file.Path());
+        if (!data || data->size() != file.Size()) {
+            state.SkipWithError("read failed");
+            break;
+        }
+        uint64_t sum = TouchPages(data->data(), data->size());
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(file.Size()));
+}
+BENCHMARK(BM_FileSystemReadBinary)->Apply(FileSizes);
+
+static void BM_FileSystemReadText(benchmark::State& state) {
+    ScratchFile file(state);
+    for (auto _ : state) {
+        std::optional<std::string> text = FileSystem::ReadTextFile(file.Path());
+        if (!text || text->size() != file.Size()) {
+            state.SkipWithError("read failed");
+            break;
+        }
+        uint64_t sum = TouchPages(text->data(), text->size());
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(file.Size()));
+}
+BENCHMARK(BM_FileSystemReadText)->Apply(FileSizes);
+
+static void BM_FileSystemMapFile(benchmark::State& state) {
+    ScratchFile file(state);
+    for (auto _ : state) {
+        std::optional<MappedFile> mapped = FileSystem::MapFile(file.Path());
+        if (!mapped || mapped->Size() != file.Size()) {
+            state.SkipWithError("map failed");
+            break;
+        }
+        uint64_t sum = TouchPages(mapped->Data(), mapped->Size());
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(file.Size()));
+}
+BENCHMARK(BM_FileSystemMapFile)->Apply(FileSizes);
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+#include "GameEngine/Core/FixedTimestep.h"
+#include "GameEngine/Core/JobSystem.h"
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+namespace {
+
+constexpr size_t kItems = 1 << 20;
+
+// Enough arithmetic per item that the loop is not purely memory bound
+inline void Work(float& value) {
+    value = std::sqrt(value * value + 1.0f) * 0.5f + std::sin(value);
+}
+
+void SetThreadLabel(benchmark::State& state, const JobSystem& jobs) {
+    state.SetLabel(std::to_string(jobs.GetThreadCount()) + " threads");
+}
+
+} // namespace
+
+static void BM_SerialFor(benchmark::State& state) {
+    std::vector<float> data(kItems, 1.5f);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kItems; ++i) {
+            Work(data[i]);
+        }
+        benchmark::DoNotOptimize(data.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kItems));
+}
+BENCHMARK(BM_SerialFor)->Unit(benchmark::kMillisecond);
+
+static void BM_ParallelFor(benchmark::State& state) {
+    JobSystem jobs;
+    SetThreadLabel(state, jobs);
+    std::vector<float> data(kItems, 1.5f);
+    for (auto _ : state) {
+        jobs.ParallelFor(0, kItems, [&data](size_t i) { Work(data[i]); });
+        benchmark::DoNotOptimize(data.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kItems));
+}
+BENCHMARK(BM_ParallelFor)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Scheduling overhead: a batch of jobs that do nothing
+static void BM_EmptyJobs(benchmark::State& state) {
+    JobSystem jobs;
+    SetThreadLabel(state, jobs);
+    const int batch = static_cast<int>(state.range(0));
+    std::atomic<int> ran{0};
+    for (auto _ : state) {
+        JobCounter counter;
+        for (int i = 0; i < batch; ++i) {
+            jobs.Run([&ran] { ran.fetch_add(1, std::memory_order_relaxed); }, &counter);
+        }
+        jobs.Wait(counter);
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_EmptyJobs)->ArgName("jobs")->Arg(1024)->UseRealTime();
+
+// The loop Engine::RunHeadless() runs: one fixed tick, fanning a particle
+// integration out to the job system
+static void BM_HeadlessTick(benchmark::State& state) {
+    JobSystem jobs;
+    SetThreadLabel(state, jobs);
+    const size_t particles = static_cast<size_t>(state.range(0));
+    FixedTimestep timestep(60.0);
+    const float step = timestep.GetStepSeconds();
+    std::vector<float> position(particles, 0.0f);
+    std::vector<float> velocity(particles, 1.0f);
+    for (auto _ : state) {
+        jobs.ParallelForRange(0, particles, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                velocity[i] -= 9.81f * step;
+                position[i] += velocity[i] * step;
+            }
+        });
+        benchmark::ClobberMemory();
+    }
+    // items/s is ticks/s here; divide by 60 for the speed-up over real time
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HeadlessTick)->ArgName("particles")->Arg(10000)->UseRealTime();
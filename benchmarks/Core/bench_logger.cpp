@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include "GameEngine/Core/Logger.h"
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+using namespace GameEngine::Core;
+
+namespace {
+
+std::string LogPath() {
+    return (std::filesystem::temp_directory_path() / "GameEngineBenchmarks.log").string();
+}
+
+// Logs to a scratch file in the mode given as the benchmark's argument
+class LogScope {
+public:
+    explicit LogScope(benchmark::State& state, LogLevel level = LogLevel::Debug)
+        : path(LogPath()) {
+        const LogMode mode = static_cast<LogMode>(state.range(0));
+        Logger::GetInstance().Initialize(path, level, mode);
+        state.SetLabel(mode == LogMode::Synchronous ? "sync" : mode == LogMode::Asynchronous ? "async" : "binary");
+    }
+    ~LogScope() {
+        Logger::GetInstance().Shutdown();
+        std::remove(path.c_str());
+    }
+
+    LogScope(const LogScope&) = delete;
+    LogScope& operator=(const LogScope&) = delete;
+
+private:
+    std::string path;
+};
+
+void AllModes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgName("mode");
+    for (LogMode mode : {LogMode::Synchronous, LogMode::Asynchronous, LogMode::Binary}) {
+        benchmark->Arg(static_cast<int64_t>(mode));
+    }
+}
+
+} // namespace
+
+// Sustained rate: once an async ring is full, callers wait for the writer,
+// so long runs measure what reaches the file rather than a burst
+static void BM_LoggerFormatted(benchmark::State& state) {
+    LogScope scope(state);
+    int entity = 0;
+    for (auto _ : state) {
+        ++entity;
+        LOG_EVENT(LogLevel::Info, "Entity %d moved to (%.2f, %.2f, %.2f) in sector %u", entity,
+                  static_cast<double>(entity) * 0.5, 0.0, -3.25, 7u);
+    }
+    Logger::GetInstance().Flush();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LoggerFormatted)->Apply(AllModes);
+
+static void BM_LoggerString(benchmark::State& state) {
+    LogScope scope(state);
+    const std::string message = "Entity 4211 moved to (12.5, 0.0, -3.25) in sector 7";
+    for (auto _ : state) {
+        LOG_INFO(message);
+    }
+    Logger::GetInstance().Flush();
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(message.size()));
+}
+BENCHMARK(BM_LoggerString)->Arg(static_cast<int64_t>(LogMode::Synchronous))
+    ->Arg(static_cast<int64_t>(LogMode::Asynchronous))
+    ->ArgName("mode");
+
+// A call below the runtime level: one relaxed load and a branch
+static void BM_LoggerFiltered(benchmark::State& state) {
+    LogScope scope(state, LogLevel::Warning);
+    double position = 0.0;
+    for (auto _ : state) {
+        position += 0.5;
+        LOG_INFO("position %f", position);
+        benchmark::DoNotOptimize(position);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LoggerFiltered)->Arg(static_cast<int64_t>(LogMode::Asynchronous))->ArgName("mode");
+
+static void BM_LoggerThreaded(benchmark::State& state) {
+    static LogScope* scope = nullptr;
+    if (state.thread_index() == 0) {
+        scope = new LogScope(state);
+    }
+    int entity = state.thread_index() * 1000000;
+    for (auto _ : state) {
+        ++entity;
+        LOG_EVENT(LogLevel::Info, "Entity %d moved to (%.2f, %.2f, %.2f) in sector %u", entity,
+                  static_cast<double>(entity) * 0.5, 0.0, -3.25, 7u);
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        Logger::GetInstance().Flush();
+        delete scope;
+        scope = nullptr;
+    }
+}
+BENCHMARK(BM_LoggerThreaded)->Arg(static_cast<int64_t>(LogMode::Asynchronous))
+    ->Arg(static_cast<int64_t>(LogMode::Binary))
+    ->ArgName("mode")
+    ->ThreadRange(2, 4)
+    ->UseRealTime();
@@ -0,0 +1,463 @@
+#include <benchmark/benchmark.h>
+#include "GameEngine/Core/FastMath.h"
+#include "GameEngine/Core/Math.h"
+#include "GameEngine/Core/Vector3SoA.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace GameEngine::Math;
+
+namespace {
+
+constexpr size_t kBatch = 1024;
+
+std::vector<Vector3> MakeVectors(size_t count, float seed) {
+    std::vector<Vector3> vectors;
+    vectors.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const float f = static_cast<float>(i) * 0.37f + seed;
+        vectors.emplace_back(f, 1.0f - f * 0.5f, 2.0f + f * 0.25f);
+    }
+    return vectors;
+}
+
+std::vector<Quaternion> MakeRotations(size_t count, float seed) {
+    std::vector<Quaternion> rotations;
+    rotations.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const float f = static_cast<float>(i) * 0.37f + seed;
+        rotations.push_back(Quaternion::rotationX(f) * Quaternion::rotationY(f * 0.5f) * Quaternion::rotationZ(-f));
+    }
+    return rotations;
+}
+
+std::vector<float> MakeAngles(size_t count) {
+    std::vector<float> angles(count);
+    for (size_t i = 0; i < count; ++i) {
+        angles[i] = static_cast<float>(i) * 0.01f - 300.0f;
+    }
+    return angles;
+}
+
+// Interpolation factors spread over [0, 1)
+std::vector<float> MakeFractions(size_t count) {
+    std::vector<float> t(count);
+    for (size_t i = 0; i < count; ++i) {
+        t[i] = static_cast<float>(i % 100) * 0.01f;
+    }
+    return t;
+}
+
+std::vector<Matrix4> MakeMatrices(size_t count) {
+    std::vector<Matrix4> matrices;
+    matrices.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const float f = static_cast<float>(i) * 0.01f;
+        matrices.push_back(Matrix4::trs(Vector3(f, -f, 2.0f * f), Quaternion::rotationY(f).Normalized(),
+                                        Vector3(1.0f + f, 1.0f, 1.0f - f * 0.5f)));
+    }
+    return matrices;
+}
+
+// Runs the benchmark on the SIMD backend given as its first argument and
+// restores the previous one afterwards
+class BackendScope {
+public:
+    explicit BackendScope(benchmark::State& state)
+        : previous(GetSimdBackend()), backend(static_cast<SimdBackend>(state.range(0))) {
+        if (!IsSimdBackendSupported(backend)) {
+            state.SkipWithError("SIMD backend not supported on this CPU");
+            return;
+        }
+        SetSimdBackend(backend);
+        state.SetLabel(GetSimdBackendName(backend));
+    }
+    ~BackendScope() { SetSimdBackend(previous); }
+
+    BackendScope(const BackendScope&) = delete;
+    BackendScope& operator=(const BackendScope&) = delete;
+
+private:
+    SimdBackend previous;
+    SimdBackend backend;
+};
+
+void AllBackends(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgName("backend");
+    for (SimdBackend backend : {SimdBackend::Scalar, SimdBackend::SSE41, SimdBackend::AVX2}) {
+        benchmark->Arg(static_cast<int64_t>(backend));
+    }
+}
+
+} // namespace
+
+static void BM_Vector3AddScale(benchmark::State& state) {
+    std::vector<Vector3> a = MakeVectors(kBatch, 0.0f);
+    const std::vector<Vector3> b = MakeVectors(kBatch, 1.0f);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            a[i] = a[i] + b[i] * 0.5f;
+        }
+        benchmark::DoNotOptimize(a.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Vector3AddScale);
+
+// Every op an opaque call, as before the math types were header-only; the
+// volatile function pointers keep the compiler from inlining them
+static void BM_Vector3AddScaleDotOutOfLine(benchmark::State& state) {
+    Vector3 (*volatile addScaled)(const Vector3&, const Vector3&, float) =
+        [](const Vector3& a, const Vector3& b, float s) { return a + b * s; };
+    float (*volatile dot)(const Vector3&, const Vector3&) = [](const Vector3& a, const Vector3& b) { return a.Dot(b); };
+    std::vector<Vector3> a = MakeVectors(kBatch, 0.0f);
+    const std::vector<Vector3> b = MakeVectors(kBatch, 1.0f);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < kBatch; ++i) {
+            a[i] = addScaled(a[i], b[i], 0.001f);
+            sum += dot(a[i], b[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Vector3AddScaleDotOutOfLine);
+
+static void BM_Vector3AddScaleDot(benchmark::State& state) {
+    std::vector<Vector3> a = MakeVectors(kBatch, 0.0f);
+    const std::vector<Vector3> b = MakeVectors(kBatch, 1.0f);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < kBatch; ++i) {
+            a[i] = a[i] + b[i] * 0.001f;
+            sum += a[i].Dot(b[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Vector3AddScaleDot);
+
+static void BM_Vector3DotCross(benchmark::State& state) {
+    const std::vector<Vector3> a = MakeVectors(kBatch, 0.0f);
+    const std::vector<Vector3> b = MakeVectors(kBatch, 1.0f);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < kBatch; ++i) {
+            sum += a[i].Cross(b[i]).Dot(a[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Vector3DotCross);
+
+static void BM_Vector3Normalize(benchmark::State& state) {
+    const std::vector<Vector3> in = MakeVectors(kBatch, 0.5f);
+    std::vector<Vector3> out(kBatch);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            out[i] = in[i].Normalized();
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Vector3Normalize);
+
+static void BM_FastNormalizeBatch(benchmark::State& state) {
+    BackendScope scope(state);
+    const std::vector<Vector3> in = MakeVectors(kBatch, 0.5f);
+    std::vector<Vector3> out(kBatch);
+    for (auto _ : state) {
+        Fast::NormalizeBatch(in.data(), out.data(), kBatch);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_FastNormalizeBatch)->Apply(AllBackends);
+
+static void BM_StdSinCos(benchmark::State& state) {
+    const std::vector<float> angles = MakeAngles(kBatch);
+    std::vector<float> sines(kBatch), cosines(kBatch);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            sines[i] = std::sin(angles[i]);
+            cosines[i] = std::cos(angles[i]);
+        }
+        benchmark::DoNotOptimize(sines.data());
+        benchmark::DoNotOptimize(cosines.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_StdSinCos);
+
+static void BM_FastSinCos(benchmark::State& state) {
+    const std::vector<float> angles = MakeAngles(kBatch);
+    std::vector<float> sines(kBatch), cosines(kBatch);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            Fast::SinCos(angles[i], sines[i], cosines[i]);
+        }
+        benchmark::DoNotOptimize(sines.data());
+        benchmark::DoNotOptimize(cosines.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_FastSinCos);
+
+static void BM_FastSinCosBatch(benchmark::State& state) {
+    BackendScope scope(state);
+    const std::vector<float> angles = MakeAngles(kBatch);
+    std::vector<float> sines(kBatch), cosines(kBatch);
+    for (auto _ : state) {
+        Fast::SinCosBatch(angles.data(), sines.data(), cosines.data(), kBatch);
+        benchmark::DoNotOptimize(sines.data());
+        benchmark::DoNotOptimize(cosines.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_FastSinCosBatch)->Apply(AllBackends);
+
+// Particle integration: position += velocity * dt, then renormalize the
+// velocity, on interleaved xyz versus one stream per component
+static void BM_Vector3IntegrateAoS(benchmark::State& state) {
+    std::vector<Vector3> positions = MakeVectors(kBatch, 0.0f);
+    std::vector<Vector3> velocities = MakeVectors(kBatch, 1.0f);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            positions[i] += velocities[i] * 0.016f;
+            velocities[i] = velocities[i].Normalized();
+        }
+        benchmark::DoNotOptimize(positions.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Vector3IntegrateAoS);
+
+static void BM_Vector3IntegrateSoA(benchmark::State& state) {
+    Vector3SoA positions(MakeVectors(kBatch, 0.0f));
+    Vector3SoA velocities(MakeVectors(kBatch, 1.0f));
+    for (auto _ : state) {
+        positions.MultiplyAdd(velocities, 0.016f);
+        velocities.Normalize();
+        benchmark::DoNotOptimize(positions.X());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Vector3IntegrateSoA);
+
+static void BM_QuaternionRotate(benchmark::State& state) {
+    const std::vector<Vector3> in = MakeVectors(kBatch, 0.0f);
+    std::vector<Vector3> out(kBatch);
+    const Quaternion rotation = Quaternion::fromAxisAngle(Vector3(1.0f, 2.0f, 3.0f).Normalized(), 0.7f);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            out[i] = rotation.Rotate(in[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_QuaternionRotate);
+
+static void BM_QuaternionSlerp(benchmark::State& state) {
+    const std::vector<Quaternion> a = MakeRotations(kBatch, 0.0f);
+    const std::vector<Quaternion> b = MakeRotations(kBatch, 1.0f);
+    const std::vector<float> t = MakeFractions(kBatch);
+    std::vector<Quaternion> out(kBatch);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            out[i] = Quaternion::Slerp(a[i], b[i], t[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_QuaternionSlerp);
+
+static void BM_SlerpBatch(benchmark::State& state) {
+    BackendScope scope(state);
+    const std::vector<Quaternion> a = MakeRotations(kBatch, 0.0f);
+    const std::vector<Quaternion> b = MakeRotations(kBatch, 1.0f);
+    const std::vector<float> t = MakeFractions(kBatch);
+    std::vector<Quaternion> out(kBatch);
+    for (auto _ : state) {
+        SlerpBatch(a.data(), b.data(), t.data(), out.data(), kBatch);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_SlerpBatch)->Apply(AllBackends);
+
+// Independent products, so this is throughput rather than the latency of
+// a dependent chain
+static void BM_Matrix4Multiply(benchmark::State& state) {
+    BackendScope scope(state);
+    const std::vector<Matrix4> a = MakeMatrices(kBatch);
+    const std::vector<Matrix4> b = MakeMatrices(kBatch);
+    std::vector<Matrix4> out(kBatch);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            out[i] = a[i] * b[kBatch - 1 - i];
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Matrix4Multiply)->Apply(AllBackends);
+
+static void BM_Matrix4Inverse(benchmark::State& state) {
+    const std::vector<Matrix4> in = MakeMatrices(kBatch);
+    std::vector<Matrix4> out(kBatch);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            out[i] = in[i].inverse().value_or(Matrix4::identity());
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Matrix4Inverse);
+
+// A parent-to-child composition plus a camera-style inverse per node, as
+// in a hierarchy/view update; node i's parent is node i / 2
+static void BM_Matrix4ComposeInverse(benchmark::State& state) {
+    const std::vector<Matrix4> local = MakeMatrices(kBatch);
+    std::vector<Matrix4> world(kBatch), view(kBatch);
+    for (auto _ : state) {
+        world[0] = local[0];
+        for (size_t i = 1; i < kBatch; ++i) {
+            world[i] = world[i / 2] * local[i];
+            view[i] = world[i].inverse().value_or(Matrix4::identity());
+        }
+        benchmark::DoNotOptimize(view.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch - 1));
+}
+BENCHMARK(BM_Matrix4ComposeInverse);
+
+static void BM_AffineComposeInverse(benchmark::State& state) {
+    const std::vector<Matrix4> matrices = MakeMatrices(kBatch);
+    std::vector<AffineTransform> local(kBatch), world(kBatch), view(kBatch);
+    for (size_t i = 0; i < kBatch; ++i) {
+        local[i] = AffineTransform(matrices[i]);
+    }
+    for (auto _ : state) {
+        world[0] = local[0];
+        for (size_t i = 1; i < kBatch; ++i) {
+            world[i] = world[i / 2] * local[i];
+            view[i] = world[i].inverse().value_or(AffineTransform::identity());
+        }
+        benchmark::DoNotOptimize(view.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch - 1));
+}
+BENCHMARK(BM_AffineComposeInverse);
+
+// World matrices from animated channels: a chained Euler product, then a
+// quaternion through Matrix4::trs, then the batched ComposeTRS
+static void BM_Matrix4ChainedTRS(benchmark::State& state) {
+    const std::vector<Vector3> positions = MakeVectors(kBatch, 0.0f);
+    const std::vector<Vector3> eulers = MakeVectors(kBatch, 1.0f);
+    const std::vector<Vector3> scales(kBatch, Vector3(1.0f, 2.0f, 0.5f));
+    std::vector<Matrix4> out(kBatch);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            const Vector3& p = positions[i];
+            out[i] = Matrix4::translation(p.x, p.y, p.z) * Matrix4::rotationX(eulers[i].x) *
+                     Matrix4::rotationY(eulers[i].y) * Matrix4::rotationZ(eulers[i].z) * Matrix4::scale(scales[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Matrix4ChainedTRS);
+
+static void BM_Matrix4Trs(benchmark::State& state) {
+    const std::vector<Vector3> positions = MakeVectors(kBatch, 0.0f);
+    const std::vector<Quaternion> rotations = MakeRotations(kBatch, 1.0f);
+    const std::vector<Vector3> scales(kBatch, Vector3(1.0f, 2.0f, 0.5f));
+    std::vector<Matrix4> out(kBatch);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            out[i] = Matrix4::trs(positions[i], rotations[i], scales[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_Matrix4Trs);
+
+static void BM_ComposeTRS(benchmark::State& state) {
+    BackendScope scope(state);
+    const std::vector<Vector3> positions = MakeVectors(kBatch, 0.0f);
+    const std::vector<Quaternion> rotations = MakeRotations(kBatch, 1.0f);
+    const std::vector<Vector3> scales(kBatch, Vector3(1.0f, 2.0f, 0.5f));
+    std::vector<Matrix4> out(kBatch);
+    for (auto _ : state) {
+        ComposeTRS(positions.data(), rotations.data(), scales.data(), out.data(), kBatch);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatch));
+}
+BENCHMARK(BM_ComposeTRS)->Apply(AllBackends);
+
+// One transformPoint() call per point, the baseline for the batch kernels
+static void BM_Matrix4TransformPoint(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const std::vector<Vector3> in = MakeVectors(count, 0.0f);
+    std::vector<Vector3> out(count);
+    const Matrix4 transform = MakeMatrices(2)[1];
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = transform.transformPoint(in[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(count * 2 * sizeof(Vector3)));
+}
+BENCHMARK(BM_Matrix4TransformPoint)->ArgName("points")->Arg(1024)->Arg(65536);
+
+static void BM_Matrix4TransformPoints(benchmark::State& state) {
+    BackendScope scope(state);
+    const size_t count = static_cast<size_t>(state.range(1));
+    const std::vector<Vector3> in = MakeVectors(count, 0.0f);
+    std::vector<Vector3> out(count);
+    const Matrix4 transform = MakeMatrices(2)[1];
+    for (auto _ : state) {
+        transform.transformPoints(in.data(), out.data(), count);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(count * 2 * sizeof(Vector3)));
+}
+BENCHMARK(BM_Matrix4TransformPoints)
+    ->ArgNames({"backend", "points"})
+    ->ArgsProduct({{static_cast<int64_t>(SimdBackend::Scalar), static_cast<int64_t>(SimdBackend::SSE41),
+                    static_cast<int64_t>(SimdBackend::AVX2)},
+                   {1024, 65536}});
@@ -0,0 +1,235 @@
+#include <benchmark/benchmark.h>
+#include "GameEngine/Core/FrameArena.h"
+#include "GameEngine/Core/Memory.h"
+#include "GameEngine/Core/SlabAllocator.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+namespace {
+
+// A typical small engine object
+struct Particle {
+    float position[3];
+    float velocity[3];
+    float lifetime;
+    uint32_t flags;
+};
+
+constexpr size_t kLive = 4096;
+
+// The pattern that matters for pools: allocate a batch, then free it in an
+// order other than allocation order so the free list gets shuffled
+template<typename Allocate, typename Free>
+void AllocateAndFreeBatch(benchmark::State& state, Allocate&& allocate, Free&& free) {
+    std::vector<Particle*> live(kLive);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kLive; ++i) {
+            live[i] = allocate();
+        }
+        benchmark::ClobberMemory();
+        for (size_t i = 0; i < kLive; i += 2) {
+            free(live[i]);
+        }
+        for (size_t i = 1; i < kLive; i += 2) {
+            free(live[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kLive));
+}
+
+// Every thread allocates and frees its own batch of mostly small blocks,
+// with the odd one up to 2 KB. Everything is freed inside the timed loop,
+// so a shared allocator can be destroyed as soon as thread 0 leaves it.
+template<typename Allocate, typename Free>
+void AllocateAndFreeMixedSizes(benchmark::State& state, Allocate&& allocate, Free&& free) {
+    const size_t thread = static_cast<size_t>(state.thread_index());
+    std::vector<size_t> sizes(512);
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        sizes[i] = i % 16 == 0 ? i * 131 % 2048 + 1 : (i * 7 + thread) % 96 + 8;
+    }
+    std::vector<void*> live(sizes.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < sizes.size(); ++i) {
+            live[i] = allocate(sizes[i]);
+            static_cast<char*>(live[i])[0] = 1;
+        }
+        for (size_t i = 0; i < sizes.size(); ++i) {
+            free(live[i], sizes[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sizes.size()));
+}
+
+} // namespace
+
+static void BM_NewDeleteBatch(benchmark::State& state) {
+    AllocateAndFreeBatch(
+        state, [] { return new Particle{}; }, [](Particle* particle) { delete particle; });
+}
+BENCHMARK(BM_NewDeleteBatch);
+
+static void BM_MemoryPoolBatch(benchmark::State& state) {
+    // Too large for the stack
+    auto pool = std::make_unique<MemoryPool<Particle, kLive>>();
+    AllocateAndFreeBatch(
+        state, [&pool] { return pool->Allocate(); }, [&pool](Particle* particle) { pool->Deallocate(particle); });
+}
+BENCHMARK(BM_MemoryPoolBatch);
+
+static void BM_GrowableMemoryPoolBatch(benchmark::State& state) {
+    GrowableMemoryPool<Particle> pool;
+    AllocateAndFreeBatch(
+        state, [&pool] { return pool.Allocate(); }, [&pool](Particle* particle) { pool.Deallocate(particle); });
+}
+BENCHMARK(BM_GrowableMemoryPoolBatch);
+
+// One object at a time, the best case for malloc's thread cache
+static void BM_NewDeleteSingle(benchmark::State& state) {
+    for (auto _ : state) {
+        Particle* particle = new Particle{};
+        benchmark::DoNotOptimize(particle);
+        delete particle;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NewDeleteSingle);
+
+static void BM_MemoryPoolSingle(benchmark::State& state) {
+    auto pool = std::make_unique<MemoryPool<Particle, kLive>>();
+    for (auto _ : state) {
+        Particle* particle = pool->Allocate();
+        benchmark::DoNotOptimize(particle);
+        pool->Deallocate(particle);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MemoryPoolSingle);
+
+// Same pools under contention: every thread allocates and frees its own batch
+static void BM_GrowableMemoryPoolThreaded(benchmark::State& state) {
+    static GrowableMemoryPool<Particle>* pool = nullptr;
+    if (state.thread_index() == 0) {
+        pool = new GrowableMemoryPool<Particle>();
+    }
+    std::vector<Particle*> live(256);
+    for (auto _ : state) {
+        for (Particle*& particle : live) {
+            particle = pool->Allocate();
+        }
+        for (Particle* particle : live) {
+            pool->Deallocate(particle);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(live.size()));
+    if (state.thread_index() == 0) {
+        delete pool;
+        pool = nullptr;
+    }
+}
+BENCHMARK(BM_GrowableMemoryPoolThreaded)->ThreadRange(1, 4)->UseRealTime();
+
+// The fixed pool is not thread-safe, so shared use needs a lock
+static void BM_MemoryPoolLockedThreaded(benchmark::State& state) {
+    static MemoryPool<Particle, 4 * 256>* pool = nullptr;
+    static std::mutex* mutex = nullptr;
+    if (state.thread_index() == 0) {
+        pool = new MemoryPool<Particle, 4 * 256>();
+        mutex = new std::mutex();
+    }
+    std::vector<Particle*> live(256);
+    for (auto _ : state) {
+        for (Particle*& particle : live) {
+            std::lock_guard<std::mutex> lock(*mutex);
+            particle = pool->Allocate();
+        }
+        for (Particle* particle : live) {
+            std::lock_guard<std::mutex> lock(*mutex);
+            pool->Deallocate(particle);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(live.size()));
+    if (state.thread_index() == 0) {
+        delete pool;
+        delete mutex;
+        pool = nullptr;
+        mutex = nullptr;
+    }
+}
+BENCHMARK(BM_MemoryPoolLockedThreaded)->ThreadRange(1, 4)->UseRealTime();
+
+static void BM_NewDeleteThreaded(benchmark::State& state) {
+    std::vector<Particle*> live(256);
+    for (auto _ : state) {
+        for (Particle*& particle : live) {
+            particle = new Particle{};
+        }
+        for (Particle* particle : live) {
+            delete particle;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(live.size()));
+}
+BENCHMARK(BM_NewDeleteThreaded)->ThreadRange(1, 4)->UseRealTime();
+
+static void BM_MallocMixedSizes(benchmark::State& state) {
+    AllocateAndFreeMixedSizes(
+        state, [](size_t size) { return std::malloc(size); }, [](void* ptr, size_t) { std::free(ptr); });
+}
+BENCHMARK(BM_MallocMixedSizes)->ThreadRange(1, 4)->UseRealTime();
+
+static void BM_SlabAllocatorMixedSizes(benchmark::State& state) {
+    static SlabAllocator* allocator = nullptr;
+    if (state.thread_index() == 0) {
+        allocator = new SlabAllocator();
+    }
+    AllocateAndFreeMixedSizes(
+        state, [](size_t size) { return allocator->Allocate(size); },
+        [](void* ptr, size_t size) { allocator->Deallocate(ptr, size); });
+    if (state.thread_index() == 0) {
+        delete allocator;
+        allocator = nullptr;
+    }
+}
+BENCHMARK(BM_SlabAllocatorMixedSizes)->ThreadRange(1, 4)->UseRealTime();
+
+// A frame's worth of short-lived lists, e.g. per-view visible sets
+constexpr int kFrameLists = 64;
+constexpr uint32_t kFrameListItems = 200;
+
+static void BM_HeapTransientVectors(benchmark::State& state) {
+    for (auto _ : state) {
+        for (int list = 0; list < kFrameLists; ++list) {
+            std::vector<uint32_t> items;
+            for (uint32_t i = 0; i < kFrameListItems; ++i) {
+                items.push_back(i);
+            }
+            benchmark::DoNotOptimize(items.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kFrameLists);
+}
+BENCHMARK(BM_HeapTransientVectors);
+
+static void BM_FrameArenaTransientVectors(benchmark::State& state) {
+    FrameArena arena(1 << 20);
+    for (auto _ : state) {
+        arena.Reset();
+        for (int list = 0; list < kFrameLists; ++list) {
+            std::pmr::vector<uint32_t> items(&arena);
+            for (uint32_t i = 0; i < kFrameListItems; ++i) {
+                items.push_back(i);
+            }
+            benchmark::DoNotOptimize(items.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kFrameLists);
+    state.counters["peak_bytes"] = static_cast<double>(arena.HighWaterMark());
+}
+BENCHMARK(BM_FrameArenaTransientVectors);
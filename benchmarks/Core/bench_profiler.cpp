@@ -0,0 +1,22 @@
+#include <benchmark/benchmark.h>
+#include "GameEngine/Core/Profiler.h"
+#include <cstdint>
+
+using namespace GameEngine::Core;
+
+// Cost of one PROFILE_SCOPE with recording on (1) or off at runtime (0).
+// With GE_PROFILER=0 both measure an empty loop.
+static void BM_ProfileScope(benchmark::State& state) {
+    const bool recording = state.range(0) != 0;
+    Profiler::Clear();
+    Profiler::SetEnabled(recording);
+    state.SetLabel(recording ? "recording" : "disabled");
+    for (auto _ : state) {
+        PROFILE_SCOPE("Overhead");
+        benchmark::ClobberMemory();
+    }
+    Profiler::SetEnabled(false);
+    Profiler::Clear();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ProfileScope)->ArgName("enabled")->Arg(1)->Arg(0);
@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+#include "GameEngine/Core/Memory.h"
+#include "GameEngine/Core/SlotMap.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+namespace {
+
+struct Entity {
+    float position[3];
+    float velocity[3];
+    int id;
+
+    explicit Entity(int id_ = 0) : position{0.0f, 0.0f, 0.0f}, velocity{1.0f, 0.5f, 0.25f}, id(id_) {}
+};
+
+constexpr int kCount = 50000;
+
+// The same objects in a slot map and in a pool after spawn/despawn churn:
+// a scattered half is freed and respawned, so pool slots end up shuffled
+class Population {
+public:
+    Population() : pool(std::make_unique<MemoryPool<Entity, kCount>>()) {
+        for (int i = 0; i < kCount; ++i) {
+            handles.push_back(map.Insert(Entity(i)));
+            pointers.push_back(pool->Allocate(i));
+        }
+        for (size_t i = 0; i < handles.size(); i += 2) {
+            map.Erase(handles[i]);
+            pool->Deallocate(pointers[i]);
+        }
+        for (size_t i = 0; i < handles.size(); i += 2) {
+            handles[i] = map.Insert(Entity(static_cast<int>(i)));
+            pointers[i] = pool->Allocate(static_cast<int>(i));
+        }
+        // Walk the first half in reverse, so pool order no longer follows slots
+        const size_t half = pointers.size() / 2;
+        for (size_t i = 0; i < half / 2; ++i) {
+            std::swap(pointers[i], pointers[half - 1 - i]);
+        }
+    }
+    ~Population() {
+        for (Entity* entity : pointers) {
+            pool->Deallocate(entity);
+        }
+    }
+
+    Population(const Population&) = delete;
+    Population& operator=(const Population&) = delete;
+
+    SlotMap<Entity> map;
+    std::unique_ptr<MemoryPool<Entity, kCount>> pool;
+    std::vector<SlotMap<Entity>::Handle> handles;
+    std::vector<Entity*> pointers;
+};
+
+} // namespace
+
+// Per-frame update of every live object: scattered pool pointers versus
+// the slot map's dense array
+static void BM_PoolPointerUpdate(benchmark::State& state) {
+    Population population;
+    for (auto _ : state) {
+        for (Entity* e : population.pointers) {
+            e->position[0] += e->velocity[0];
+            e->position[1] += e->velocity[1];
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(BM_PoolPointerUpdate);
+
+static void BM_SlotMapUpdate(benchmark::State& state) {
+    Population population;
+    for (auto _ : state) {
+        for (Entity& e : population.map) {
+            e.position[0] += e.velocity[0];
+            e.position[1] += e.velocity[1];
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(BM_SlotMapUpdate);
+
+static void BM_SlotMapGet(benchmark::State& state) {
+    Population population;
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (SlotMap<Entity>::Handle handle : population.handles) {
+            sum += population.map.Get(handle)->position[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(BM_SlotMapGet);
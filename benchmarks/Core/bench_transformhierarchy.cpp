@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include "GameEngine/Core/TransformHierarchy.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace GameEngine::Math;
+using NodeId = TransformHierarchy::NodeId;
+
+namespace {
+
+constexpr size_t kNodes = 20000;
+constexpr size_t kBranching = 4;
+
+AffineTransform MakeLocal(size_t seed) {
+    const float f = static_cast<float>(seed);
+    return AffineTransform(Matrix4::trs(Vector3(std::sin(f), 1.0f, std::cos(f) * 0.5f),
+                                        Quaternion::rotationY(f * 0.1f), Vector3(1.0f, 1.0f, 1.0f)));
+}
+
+// Node i's parent is node (i - 1) / kBranching
+std::vector<NodeId> BuildTree(TransformHierarchy& hierarchy) {
+    std::vector<NodeId> ids;
+    ids.reserve(kNodes);
+    for (size_t i = 0; i < kNodes; ++i) {
+        const NodeId parent = i == 0 ? TransformHierarchy::kInvalidNode : ids[(i - 1) / kBranching];
+        ids.push_back(hierarchy.CreateNode(parent, MakeLocal(i)));
+    }
+    hierarchy.UpdateWorldTransforms();
+    return ids;
+}
+
+} // namespace
+
+// What callers did before the hierarchy: a Matrix4 product per node per frame
+static void BM_Matrix4FullRecompute(benchmark::State& state) {
+    std::vector<Matrix4> locals(kNodes), worlds(kNodes);
+    for (size_t i = 0; i < kNodes; ++i) {
+        locals[i] = MakeLocal(i).toMatrix4();
+    }
+    for (auto _ : state) {
+        worlds[0] = locals[0];
+        for (size_t i = 1; i < kNodes; ++i) {
+            worlds[i] = worlds[(i - 1) / kBranching] * locals[i];
+        }
+        benchmark::DoNotOptimize(worlds.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kNodes));
+}
+BENCHMARK(BM_Matrix4FullRecompute)->Unit(benchmark::kMicrosecond);
+
+// Nothing moved since the last frame
+static void BM_HierarchyUnchanged(benchmark::State& state) {
+    TransformHierarchy hierarchy;
+    BuildTree(hierarchy);
+    for (auto _ : state) {
+        hierarchy.UpdateWorldTransforms();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HierarchyUnchanged);
+
+// 1% of the nodes animate, mostly leaves
+static void BM_HierarchyPartialDirty(benchmark::State& state) {
+    TransformHierarchy hierarchy;
+    const std::vector<NodeId> ids = BuildTree(hierarchy);
+    size_t frame = 0;
+    for (auto _ : state) {
+        for (size_t i = kNodes - kNodes / 100; i < kNodes; ++i) {
+            hierarchy.SetLocalTransform(ids[i], MakeLocal(i + frame));
+        }
+        hierarchy.UpdateWorldTransforms();
+        ++frame;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HierarchyPartialDirty)->Unit(benchmark::kMicrosecond);
+
+// The root moved, so every node is recomputed
+static void BM_HierarchyRootMoved(benchmark::State& state) {
+    TransformHierarchy hierarchy;
+    const std::vector<NodeId> ids = BuildTree(hierarchy);
+    size_t frame = 0;
+    for (auto _ : state) {
+        hierarchy.SetLocalTransform(ids[0], MakeLocal(frame++));
+        hierarchy.UpdateWorldTransforms();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kNodes));
+}
+BENCHMARK(BM_HierarchyRootMoved)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Compares two GameEngineBenchmarks JSON runs and flags regressions.
+
+Save runs with
+    GameEngineBenchmarks --benchmark_out=run.json --benchmark_out_format=json
+adding --benchmark_repetitions=N to compare medians instead of single runs.
+
+    compare_baseline.py baseline.json current.json [--threshold 0.10]
+
+Exits with 1 if any benchmark got slower than the threshold allows, 2 on
+bad input, 0 otherwise.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+UNIT_TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_run(path):
+    """Returns (context, {name: benchmark}) with one entry per benchmark."""
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+    results = {}
+    medians = {}
+    for bench in data.get("benchmarks", []):
+        if bench.get("error_occurred"):
+            continue
+        if bench.get("run_type") == "aggregate":
+            if bench.get("aggregate_name") == "median":
+                medians[bench["run_name"]] = bench
+            continue
+        # With repetitions, the first iteration stands in until the median
+        # replaces it
+        results.setdefault(bench.get("run_name", bench["name"]), bench)
+    results.update(medians)
+    return data.get("context", {}), results
+
+
+def time_ns(bench, metric):
+    return float(bench[metric]) * UNIT_TO_NS[bench.get("time_unit", "ns")]
+
+
+def format_ns(value):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if value >= scale:
+            return f"{value / scale:.3f} {unit}"
+    return f"{value:.2f} ns"
+
+
+def warn_on_context_mismatch(baseline, current):
+    for key in ("host_name", "num_cpus", "mhz_per_cpu", "library_build_type"):
+        if key in baseline and key in current and baseline[key] != current[key]:
+            print(f"warning: {key} differs: {baseline[key]} vs {current[key]}", file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="allowed slowdown as a fraction (default 0.10)")
+    parser.add_argument("--metric", choices=("cpu_time", "real_time"), default="cpu_time")
+    parser.add_argument("--filter", default="", help="only compare benchmarks matching this regex")
+    args = parser.parse_args()
+
+    try:
+        base_context, baseline = load_run(args.baseline)
+        current_context, current = load_run(args.current)
+    except (OSError, ValueError, KeyError) as error:
+        print(f"error: {error}", file=sys.stderr)
+        return 2
+    warn_on_context_mismatch(base_context, current_context)
+
+    pattern = re.compile(args.filter)
+    names = [name for name in baseline if name in current and pattern.search(name)]
+    if not names:
+        print("error: the runs have no benchmarks in common", file=sys.stderr)
+        return 2
+
+    width = max(len(name) for name in names)
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Current':>12}  {'Change':>8}")
+    regressions = []
+    for name in names:
+        before = time_ns(baseline[name], args.metric)
+        after = time_ns(current[name], args.metric)
+        change = (after - before) / before if before > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            flag = "  faster"
+        print(f"{name:<{width}}  {format_ns(before):>12}  {format_ns(after):>12}  {change:>+7.1%}{flag}")
+
+    for name in sorted(set(baseline) - set(current)):
+        if pattern.search(name):
+            print(f"missing from current run: {name}")
+    for name in sorted(set(current) - set(baseline)):
+        if pattern.search(name):
+            print(f"new in current run: {name}")
+
+    if regressions:
+        print(f"\n{len(regressions)} of {len(names)} benchmarks regressed by more than {args.threshold:.0%}")
+        return 1
+    print(f"\nNo regressions beyond {args.threshold:.0%} in {len(names)} benchmarks")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
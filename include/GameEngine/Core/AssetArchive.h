@@ -0,0 +1,140 @@
+#pragma once
+#include "GameEngine/Core/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GameEngine {
+namespace Core {
+
+// Pack file format. Many assets are stored in one file so loading them
+// costs one open and one mapping instead of an open/stat/read each.
+// Little-endian as written by the host.
+//
+//   Header
+//   payloads, each starting on a multiple of Header::alignment
+//   Entry[entryCount]           sorted by path
+//   uint32_t[hashTableSize]     open-addressed index into the entries
+//   path strings
+//
+// Lookup hashes the path and probes the hash table linearly, so finding
+// an entry is O(1) and needs nothing built at load time.
+namespace AssetPack {
+
+constexpr char kMagic[8] = {'G', 'E', 'P', 'A', 'C', 'K', '\0', '\0'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kDefaultAlignment = 64;
+constexpr uint32_t kEmptyBucket = 0xFFFFFFFFu;
+
+enum class Compression : uint32_t {
+    None = 0,
+    Lz4 = 1   // LZ4 block format
+};
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t alignment;
+    uint32_t entryCount;
+    uint32_t hashTableSize;   // Power of two, at least twice entryCount
+    uint64_t entriesOffset;
+    uint64_t hashTableOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+};
+
+struct Entry {
+    uint64_t pathHash;
+    uint64_t offset;       // Of the stored bytes, from the start of the file
+    uint64_t storedSize;
+    uint64_t size;         // Uncompressed
+    uint32_t pathOffset;   // Into the string table
+    uint32_t pathLength;
+    Compression compression;
+    uint32_t reserved;
+};
+
+// FNV-1a of the normalized path
+uint64_t HashPath(std::string_view path);
+
+// Archive paths use '/' separators with no leading "./" or '/'
+std::string NormalizePath(std::string_view path);
+
+} // namespace AssetPack
+
+// Read-only view of a pack file. The whole archive is mapped once;
+// uncompressed entries are served as zero-copy views into that mapping,
+// compressed ones are decompressed into a buffer of their exact size.
+// Thread-safe, as nothing is mutated after Open().
+class AssetArchive : public std::enable_shared_from_this<AssetArchive> {
+public:
+    // Returns nullptr if the file is missing or not a valid pack
+    static std::shared_ptr<AssetArchive> Open(const std::string& filepath, std::string* error = nullptr);
+
+    const std::string& GetPath() const { return path; }
+    size_t EntryCount() const { return header.entryCount; }
+    // Entries in path order
+    const AssetPack::Entry& EntryAt(size_t index) const { return entries[index]; }
+    std::string_view EntryPath(const AssetPack::Entry& entry) const;
+
+    // `entryPath` must already be normalized (see AssetPack::NormalizePath)
+    const AssetPack::Entry* Find(std::string_view entryPath) const;
+    bool Contains(std::string_view entryPath) const { return Find(entryPath) != nullptr; }
+
+    // The entry's bytes as stored (compressed if it is compressed)
+    std::string_view StoredData(const AssetPack::Entry& entry) const;
+    // Writes the entry's entry.size uncompressed bytes to `destination`
+    bool ReadInto(const AssetPack::Entry& entry, char* destination) const;
+
+    // The returned view keeps the archive mapped while it is alive
+    std::optional<MappedFile> Map(const AssetPack::Entry& entry) const;
+    std::optional<std::vector<char>> Read(const AssetPack::Entry& entry) const;
+
+private:
+    AssetArchive() = default;
+
+    std::string path;
+    MappedFile file;
+    AssetPack::Header header{};
+    const AssetPack::Entry* entries = nullptr;
+    const uint32_t* hashTable = nullptr;
+    const char* strings = nullptr;
+};
+
+// Collects assets and writes a pack. Files added by path are read only
+// when Write() runs. Adding a path twice keeps the later addition.
+class AssetArchiveBuilder {
+public:
+    explicit AssetArchiveBuilder(uint32_t alignment = AssetPack::kDefaultAlignment);
+
+    // Lz4 is only kept for entries it shrinks by at least 1/16
+    void AddData(const std::string& path, std::vector<char> data,
+                 AssetPack::Compression compression = AssetPack::Compression::None);
+    void AddFile(const std::string& path, const std::string& sourceFile,
+                 AssetPack::Compression compression = AssetPack::Compression::None);
+    // Every regular file under `directory`, by its relative path; returns
+    // the number of files added
+    size_t AddDirectory(const std::string& directory,
+                        AssetPack::Compression compression = AssetPack::Compression::None);
+
+    size_t EntryCount() const { return pending.size(); }
+
+    bool Write(const std::string& outputPath, std::string* error = nullptr) const;
+
+private:
+    struct Pending {
+        std::string sourceFile;   // Empty when `data` holds the bytes
+        std::vector<char> data;
+        AssetPack::Compression compression;
+    };
+
+    uint32_t alignment;
+    std::map<std::string, Pending> pending;   // Ordered, so packs are reproducible
+};
+
+}} // namespace GameEngine::Core
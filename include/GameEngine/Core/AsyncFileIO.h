@@ -0,0 +1,127 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GameEngine {
+namespace Core {
+
+enum class IOPriority {
+    Low = 0,       // Prefetch, streaming ahead of need
+    Normal = 1,
+    High = 2,      // Blocking the current frame
+};
+
+enum class IOStatus {
+    Queued,
+    InFlight,
+    Completed,
+    Failed,
+    Cancelled
+};
+
+struct ReadResult {
+    IOStatus status = IOStatus::Queued;
+    int error = 0;               // errno value when Failed
+    std::vector<char> data;
+};
+
+namespace Detail {
+struct ReadState;
+}
+
+// Handle to one submitted read. Copies refer to the same request. A
+// handle may outlive the AsyncFileIO that issued it.
+class ReadHandle {
+public:
+    ReadHandle() = default;
+
+    bool Valid() const { return state != nullptr; }
+    IOStatus Status() const;
+    // Completed, Failed or Cancelled
+    bool IsDone() const;
+
+    // Blocks until the request is done; the completion callback, if any,
+    // has run by the time this returns. The data may be moved out.
+    ReadResult& Wait() const;
+
+    // Cancels a request that has not been issued to the OS yet: it will
+    // not run, its callback fires now with IOStatus::Cancelled and true is
+    // returned. Reads already in flight finish normally.
+    bool Cancel() const;
+
+private:
+    friend class AsyncFileIO;
+    explicit ReadHandle(std::shared_ptr<Detail::ReadState> state_) : state(std::move(state_)) {}
+
+    std::shared_ptr<Detail::ReadState> state;
+};
+
+// Asynchronous file reads for asset loading. Requests wait in a priority
+// queue (FIFO within a priority) and are issued up to `queueDepth` at a
+// time. On Linux they go through io_uring: one I/O thread fills the
+// submission ring with every request it can take and issues the whole
+// batch with a single system call. Elsewhere, or where io_uring is
+// unavailable (old kernels, seccomp sandboxes), a pool of worker threads
+// performs blocking reads instead. If the ring fails at run time, reads
+// already in it fail and the pool takes over the queue.
+//
+// Completion callbacks run on the I/O thread or a worker, so keep them
+// short: hand the data off rather than parsing it in place. Thread-safe.
+// Destruction cancels queued requests and waits for in-flight ones.
+class AsyncFileIO {
+public:
+    enum class Backend {
+        Auto,         // io_uring if available, else the thread pool
+        IoUring,      // Falls back to the thread pool if unavailable
+        ThreadPool
+    };
+
+    using Callback = std::function<void(ReadResult&)>;
+
+    // Read of `length` bytes at `offset`; kWholeFile reads to the end
+    static constexpr size_t kWholeFile = static_cast<size_t>(-1);
+
+    struct ReadRequest {
+        std::string path;
+        uint64_t offset = 0;
+        size_t length = kWholeFile;
+        IOPriority priority = IOPriority::Normal;
+        Callback onComplete;
+    };
+
+    static constexpr unsigned kDefaultQueueDepth = 64;
+
+    // `workerThreads` sizes the thread pool backend; 0 picks one per
+    // hardware thread, capped at the queue depth
+    explicit AsyncFileIO(Backend backend = Backend::Auto, unsigned queueDepth = kDefaultQueueDepth,
+                         unsigned workerThreads = 0);
+    ~AsyncFileIO();
+
+    AsyncFileIO(const AsyncFileIO&) = delete;
+    AsyncFileIO& operator=(const AsyncFileIO&) = delete;
+
+    ReadHandle Read(const std::string& path, IOPriority priority = IOPriority::Normal, Callback onComplete = {});
+    ReadHandle Read(ReadRequest request);
+    // Queues every request under one lock and one wakeup
+    std::vector<ReadHandle> ReadBatch(std::vector<ReadRequest> requests);
+
+    // Blocks until every request submitted so far is done
+    void WaitIdle();
+
+    // The backend actually in use: IoUring or ThreadPool
+    Backend GetBackend() const;
+    unsigned GetQueueDepth() const;
+
+private:
+    friend struct Detail::ReadState;
+    struct Impl;
+    class UringBackend;
+    class ThreadPoolBackend;
+    std::unique_ptr<Impl> impl;
+};
+
+}} // namespace GameEngine::Core
@@ -0,0 +1,174 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define GE_BINARY_LOG_TSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define GE_BINARY_LOG_TSC 1
+#else
+#define GE_BINARY_LOG_TSC 0
+#endif
+
+namespace GameEngine {
+namespace Core {
+
+// File format written by Logger in LogMode::Binary. Instead of formatted
+// text, each event stores the id of its call site's format string, a raw
+// timestamp and its arguments' bytes; a format definition record precedes
+// the first event of every id. Text is rebuilt offline by BinaryLog::Decode
+// (the GameEngineLogDecoder tool). All values are little-endian as
+// written by the host.
+//
+//   FileHeader
+//   { RecordHeader, payload[size] }...
+namespace BinaryLog {
+
+constexpr char kMagic[8] = {'G', 'E', 'L', 'O', 'G', 'B', 'I', 'N'};
+constexpr uint32_t kVersion = 1;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+};
+
+struct RecordHeader {
+    uint32_t formatId;
+    uint32_t size;        // Payload bytes that follow
+    uint64_t timestamp;   // ReadTimestamp() ticks
+};
+
+// Record ids. Definition payload: u32 id, u32 level, u32 line, then the
+// signature, format and file as u32 length + bytes. Clock sync payload:
+// i64 system_clock nanoseconds taken with the header's timestamp, so the
+// decoder can map ticks to wall time. Plain-text messages use one
+// predefined "%s" format per level.
+constexpr uint32_t kDefinitionRecord = 0;
+constexpr uint32_t kClockSyncRecord = 1;
+constexpr uint32_t kFirstTextFormat = 2;
+constexpr uint32_t kFirstEventFormat = 16;
+
+// Largest argument payload of one event; strings are truncated to fit
+constexpr size_t kMaxEventPayload = 1024;
+
+// Signature codes, one per argument. Values are stored as the printf
+// promotion of the argument: 4 or 8 byte integers, doubles, and strings
+// as u32 length + bytes.
+constexpr char kInt32 = 'i';
+constexpr char kInt64 = 'I';
+constexpr char kUInt32 = 'u';
+constexpr char kUInt64 = 'U';
+constexpr char kDouble = 'd';
+constexpr char kString = 's';
+constexpr char kPointer = 'p';
+
+// Cheapest monotonic tick source: the TSC on x86, steady_clock elsewhere
+inline uint64_t ReadTimestamp() {
+#if GE_BINARY_LOG_TSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// Only printf-compatible argument types have a code
+template<typename T, typename = void>
+struct ArgCode;
+
+template<typename T>
+struct ArgCode<T, std::enable_if_t<std::is_integral<T>::value>> {
+    static constexpr char value = std::is_signed<T>::value ? (sizeof(T) <= 4 ? kInt32 : kInt64)
+                                                           : (sizeof(T) <= 4 ? kUInt32 : kUInt64);
+};
+
+template<typename T>
+struct ArgCode<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+    static constexpr char value = kDouble;
+};
+
+template<typename T>
+struct ArgCode<T*, std::enable_if_t<std::is_same<std::remove_cv_t<T>, char>::value>> {
+    static constexpr char value = kString;
+};
+
+template<typename T>
+struct ArgCode<T*, std::enable_if_t<!std::is_same<std::remove_cv_t<T>, char>::value>> {
+    static constexpr char value = kPointer;
+};
+
+// Appends one argument at `offset` in `buffer`; stops at `capacity`
+template<typename T>
+void EncodeArg(char* buffer, size_t& offset, size_t capacity, const T& value) {
+    constexpr char code = ArgCode<std::decay_t<T>>::value;
+    if constexpr (code == kString) {
+        const char* text = value;
+        if (text == nullptr) {
+            text = "(null)";
+        }
+        if (capacity - offset < sizeof(uint32_t)) {
+            return;
+        }
+        size_t length = std::strlen(text);
+        if (length > capacity - offset - sizeof(uint32_t)) {
+            length = capacity - offset - sizeof(uint32_t);
+        }
+        const uint32_t length32 = static_cast<uint32_t>(length);
+        std::memcpy(buffer + offset, &length32, sizeof(length32));
+        std::memcpy(buffer + offset + sizeof(length32), text, length);
+        offset += sizeof(length32) + length;
+    } else {
+        using Stored = std::conditional_t<
+            code == kInt32, int32_t,
+            std::conditional_t<code == kInt64, int64_t,
+                               std::conditional_t<code == kUInt32, uint32_t,
+                                                  std::conditional_t<code == kUInt64, uint64_t,
+                                                                     std::conditional_t<code == kDouble, double,
+                                                                                        uint64_t>>>>>;
+        Stored stored;
+        if constexpr (code == kPointer) {
+            stored = static_cast<Stored>(reinterpret_cast<uintptr_t>(value));
+        } else {
+            stored = static_cast<Stored>(value);
+        }
+        if (capacity - offset < sizeof(stored)) {
+            return;
+        }
+        std::memcpy(buffer + offset, &stored, sizeof(stored));
+        offset += sizeof(stored);
+    }
+}
+
+// Per call site state of LOG_EVENT: its format id, assigned on first use.
+// Constant-initialized, so a function-local static needs no guard.
+struct Site {
+    constexpr Site(const char* file_, int line_) : file(file_), line(line_) {}
+
+    const char* file;
+    int line;
+    std::atomic<uint32_t> id{0};
+};
+
+enum class DecodeFormat {
+    Text,   // One line per event, as the text logger would have written it
+    Json    // One JSON object per line
+};
+
+// Decodes a whole binary log. Returns false and sets `error` on malformed
+// input; events before the damage are still written.
+bool Decode(std::istream& in, std::ostream& out, DecodeFormat format, std::string* error = nullptr);
+// Same, over a log already in memory (e.g. a MappedFile's view)
+bool Decode(std::string_view data, std::ostream& out, DecodeFormat format, std::string* error = nullptr);
+
+} // namespace BinaryLog
+
+}} // namespace GameEngine::Core
@@ -0,0 +1,357 @@
+#pragma once
+#include "GameEngine/Core/JobSystem.h"
+#include "GameEngine/Core/SlotMap.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace GameEngine {
+namespace Core {
+
+// Archetype entity component system. Every distinct set of component
+// types is an archetype; its entities live in fixed-size chunks laid out
+// as one contiguous array per component (SoA), so a query walks the
+// arrays of each matching chunk linearly with no per-entity indirection.
+//
+// Components are plain data: trivially copyable and destructible, so
+// chunks move them with memcpy and never run constructors or destructors.
+// At most kMaxComponentTypes component types exist per process.
+
+namespace Detail {
+// Where an entity's row lives
+struct EntityRecord {
+    uint32_t archetype;
+    uint32_t chunk;
+    uint32_t row;
+};
+} // namespace Detail
+
+using Entity = SlotMap<Detail::EntityRecord>::Handle;
+using ComponentId = uint32_t;
+using ComponentMask = uint64_t;
+
+constexpr ComponentId kMaxComponentTypes = 64;
+// A system access mask that conflicts with every other system
+constexpr ComponentMask kAllComponents = ~ComponentMask(0);
+
+namespace Detail {
+
+struct ComponentInfo {
+    size_t size;
+    size_t alignment;
+};
+
+// Thread-safe; ids are assigned in first-use order. Aborts past
+// kMaxComponentTypes types, in every build type.
+ComponentId RegisterComponent(const ComponentInfo& info);
+const ComponentInfo& GetComponentInfo(ComponentId id);
+
+constexpr size_t kChunkBytes = 16 * 1024;
+constexpr size_t kColumnAlignment = 64;
+
+// Prints the message and aborts; for limits whose violation would
+// otherwise corrupt memory
+[[noreturn]] void Fatal(const char* message);
+
+struct Chunk {
+    unsigned char* data;
+    uint32_t count;
+};
+
+struct Archetype {
+    ComponentMask mask = 0;
+    std::vector<ComponentId> components;
+    uint32_t capacity = 0;   // Rows per chunk
+    // Byte offset of each component's array within a chunk; the entity
+    // array is at offset 0
+    std::array<uint32_t, kMaxComponentTypes> columnOffset{};
+    // Full except possibly the last
+    std::vector<Chunk> chunks;
+    size_t entityCount = 0;
+
+    Entity* Entities(const Chunk& chunk) const { return reinterpret_cast<Entity*>(chunk.data); }
+    void* Column(const Chunk& chunk, ComponentId id) const { return chunk.data + columnOffset[id]; }
+};
+
+} // namespace Detail
+
+template<typename T>
+ComponentId ComponentTypeId() {
+    if constexpr (std::is_const<T>::value || std::is_volatile<T>::value) {
+        // const T shares T's id
+        return ComponentTypeId<std::remove_cv_t<T>>();
+    } else {
+        static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value,
+                      "Components must be trivially copyable and destructible");
+        static_assert(alignof(T) <= Detail::kColumnAlignment, "Component alignment exceeds the column alignment");
+        // One row of T next to the entity array, padded to a column boundary
+        static_assert(sizeof(T) <= Detail::kChunkBytes - Detail::kColumnAlignment, "Component too large for a chunk");
+        static const ComponentId id = Detail::RegisterComponent({sizeof(T), alignof(T)});
+        return id;
+    }
+}
+
+template<typename... Ts>
+ComponentMask ComponentMaskOf() {
+    return (ComponentMask(0) | ... | (ComponentMask(1) << ComponentTypeId<Ts>()));
+}
+
+// Owns all entities and their components. Not thread-safe for structural
+// changes (create, destroy, add, remove); those invalidate component
+// pointers and must not happen during a query. Queries themselves may
+// run in parallel and write the components they name. Record structural
+// changes made while iterating in a CommandBuffer instead.
+class World {
+public:
+    World() = default;
+    ~World();
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    // Returns a null entity when the entity limit (SlotMap::kMaxSlots) is reached
+    template<typename... Ts>
+    Entity CreateEntity(const Ts&... components) {
+        const ComponentId ids[] = {ComponentTypeId<Ts>()..., 0};
+        const void* values[] = {static_cast<const void*>(&components)..., nullptr};
+        return CreateEntityRaw(ComponentMaskOf<Ts...>(), ids, values, sizeof...(Ts));
+    }
+    bool DestroyEntity(Entity entity);
+    bool IsAlive(Entity entity) const { return records.Contains(entity); }
+    size_t EntityCount() const { return records.Size(); }
+    size_t ArchetypeCount() const { return archetypes.size(); }
+
+    template<typename T>
+    bool Has(Entity entity) const {
+        const Detail::EntityRecord* record = records.Get(entity);
+        return record != nullptr && (archetypes[record->archetype]->mask & ComponentMaskOf<T>()) != 0;
+    }
+
+    // nullptr if the entity is dead or lacks T; valid until the next
+    // structural change
+    template<typename T>
+    T* Get(Entity entity) {
+        return static_cast<T*>(GetRaw(entity, ComponentTypeId<T>()));
+    }
+
+    // Sets the component, moving the entity to a new archetype if it did
+    // not have one; false if the entity is dead
+    template<typename T>
+    bool Add(Entity entity, const T& component) {
+        return AddRaw(entity, ComponentTypeId<T>(), &component);
+    }
+    template<typename T>
+    bool Remove(Entity entity) {
+        return RemoveRaw(entity, ComponentTypeId<T>());
+    }
+
+    // Calls f(count, entities, Ts* columns...) for every chunk whose
+    // archetype has all of Ts. Use const T to read only.
+    template<typename... Ts, typename F>
+    void EachChunk(F&& f) {
+        const ComponentMask required = ComponentMaskOf<Ts...>();
+        for (const auto& archetype : archetypes) {
+            if ((archetype->mask & required) != required) {
+                continue;
+            }
+            for (const Detail::Chunk& chunk : archetype->chunks) {
+                f(static_cast<size_t>(chunk.count), static_cast<const Entity*>(archetype->Entities(chunk)),
+                  static_cast<Ts*>(archetype->Column(chunk, ComponentTypeId<Ts>()))...);
+            }
+        }
+    }
+
+    // Calls f(Ts&...) or f(Entity, Ts&...) for every entity with all of Ts
+    template<typename... Ts, typename F>
+    void Each(F&& f) {
+        EachChunk<Ts...>([&f](size_t count, const Entity* entities, Ts*... columns) {
+            ForEachRow<Ts...>(f, count, entities, columns...);
+        });
+    }
+
+    // EachChunk with the chunks spread over jobs; f must be safe to call
+    // concurrently on different chunks
+    template<typename... Ts, typename F>
+    void ParallelEachChunk(JobSystem& jobs, F&& f) {
+        const ComponentMask required = ComponentMaskOf<Ts...>();
+        std::vector<ChunkRef> matched;
+        CollectChunks(required, matched);
+        jobs.ParallelForRange(0, matched.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const Detail::Archetype& archetype = *matched[i].archetype;
+                const Detail::Chunk& chunk = *matched[i].chunk;
+                f(static_cast<size_t>(chunk.count), static_cast<const Entity*>(archetype.Entities(chunk)),
+                  static_cast<Ts*>(archetype.Column(chunk, ComponentTypeId<Ts>()))...);
+            }
+        });
+    }
+
+    template<typename... Ts, typename F>
+    void ParallelEach(JobSystem& jobs, F&& f) {
+        ParallelEachChunk<Ts...>(jobs, [&f](size_t count, const Entity* entities, Ts*... columns) {
+            ForEachRow<Ts...>(f, count, entities, columns...);
+        });
+    }
+
+    // Entities with all of Ts
+    template<typename... Ts>
+    size_t Count() const {
+        const ComponentMask required = ComponentMaskOf<Ts...>();
+        size_t count = 0;
+        for (const auto& archetype : archetypes) {
+            if ((archetype->mask & required) == required) {
+                count += archetype->entityCount;
+            }
+        }
+        return count;
+    }
+
+private:
+    friend class CommandBuffer;
+
+    struct ChunkRef {
+        const Detail::Archetype* archetype;
+        const Detail::Chunk* chunk;
+    };
+
+    template<typename... Ts, typename F>
+    static void ForEachRow(F& f, size_t count, const Entity* entities, Ts*... columns) {
+        if constexpr (std::is_invocable<F&, Entity, Ts&...>::value) {
+            for (size_t i = 0; i < count; ++i) {
+                f(entities[i], columns[i]...);
+            }
+        } else {
+            (void)entities;
+            for (size_t i = 0; i < count; ++i) {
+                f(columns[i]...);
+            }
+        }
+    }
+
+    Entity CreateEntityRaw(ComponentMask mask, const ComponentId* ids, const void* const* values, size_t count);
+    void* GetRaw(Entity entity, ComponentId id);
+    bool AddRaw(Entity entity, ComponentId id, const void* value);
+    bool RemoveRaw(Entity entity, ComponentId id);
+
+    uint32_t FindOrCreateArchetype(ComponentMask mask);
+    // Appends an uninitialized row; returns its chunk and row
+    Detail::EntityRecord AppendRow(uint32_t archetypeIndex, Entity entity);
+    // Fills the hole with the archetype's last row
+    void RemoveRow(const Detail::EntityRecord& location);
+    void MoveEntity(Detail::EntityRecord& record, uint32_t targetArchetype);
+    void CollectChunks(ComponentMask required, std::vector<ChunkRef>& out) const;
+
+    SlotMap<Detail::EntityRecord> records;
+    std::vector<std::unique_ptr<Detail::Archetype>> archetypes;
+    std::unordered_map<ComponentMask, uint32_t> archetypeByMask;
+    std::vector<unsigned char*> freeChunks;
+};
+
+// Records structural changes to apply to a World later, e.g. from inside
+// a query or a parallel system. Not thread-safe: use one per job or
+// system. Component values are copied into the buffer when recorded.
+class CommandBuffer {
+public:
+    template<typename... Ts>
+    void CreateEntity(const Ts&... components) {
+        AppendHeader(Op::Create, Entity(), 0, static_cast<uint32_t>(sizeof...(Ts)));
+        (AppendComponent(Op::Add, Entity(), ComponentTypeId<Ts>(), &components, sizeof(Ts)), ...);
+        ++commandCount;
+    }
+    void DestroyEntity(Entity entity) {
+        AppendHeader(Op::Destroy, entity, 0, 0);
+        ++commandCount;
+    }
+    template<typename T>
+    void Add(Entity entity, const T& component) {
+        AppendComponent(Op::Add, entity, ComponentTypeId<T>(), &component, sizeof(T));
+        ++commandCount;
+    }
+    template<typename T>
+    void Remove(Entity entity) {
+        AppendHeader(Op::Remove, entity, ComponentTypeId<T>(), 0);
+        ++commandCount;
+    }
+
+    // Applies the commands in recording order, then clears the buffer.
+    // Commands on entities that are no longer alive are skipped.
+    void Playback(World& world);
+
+    size_t CommandCount() const { return commandCount; }
+    bool Empty() const { return commandCount == 0; }
+    void Clear() {
+        stream.clear();
+        commandCount = 0;
+    }
+
+private:
+    enum class Op : uint32_t { Create, Destroy, Add, Remove };
+
+    // Create's `size` is the number of Add records that follow it
+    struct Header {
+        Op op;
+        ComponentId component;
+        Entity entity;
+        uint32_t size;
+    };
+
+    void AppendHeader(Op op, Entity entity, ComponentId component, uint32_t size);
+    void AppendComponent(Op op, Entity entity, ComponentId component, const void* value, size_t size);
+
+    std::vector<unsigned char> stream;
+    size_t commandCount = 0;
+};
+
+// What a system sees while it runs
+struct SystemContext {
+    World& world;
+    CommandBuffer& commands;   // Played back after the system's stage
+    JobSystem& jobs;
+    float deltaTime;
+};
+
+// Runs systems over a World on a JobSystem. Each system declares the
+// components it reads and writes; systems are grouped into stages, and
+// the systems in a stage run concurrently as jobs. A system lands in the
+// stage after the last earlier system it conflicts with (one writes what
+// the other reads or writes), so conflicting systems keep registration
+// order. Each system's command buffer is played back, in registration
+// order, at the end of its stage.
+//
+// Systems must not make structural changes to the World directly unless
+// they declare kAllComponents as written, which makes them run alone.
+class SystemScheduler {
+public:
+    using SystemFunction = std::function<void(SystemContext& context)>;
+
+    void Add(std::string name, ComponentMask reads, ComponentMask writes, SystemFunction system);
+    void Run(World& world, JobSystem& jobs, float deltaTime);
+
+    size_t SystemCount() const { return systems.size(); }
+    size_t StageCount() const { return stages.size(); }
+    // Index of the stage the n-th added system runs in
+    size_t StageOf(size_t system) const { return systems[system].stage; }
+
+private:
+    struct System {
+        std::string name;
+        const char* profileName;   // Profiler::InternName(name)
+        ComponentMask reads;
+        ComponentMask writes;
+        SystemFunction function;
+        size_t stage;
+        CommandBuffer commands;
+    };
+
+    std::vector<System> systems;
+    std::vector<std::vector<size_t>> stages;   // System indices, in registration order
+};
+
+}} // namespace GameEngine::Core
@@ -0,0 +1,122 @@
+#pragma once
+#include "GameEngine/Core/Math.h"
+#include <cstddef>
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define GE_FAST_MATH_SSE 1
+#else
+#define GE_FAST_MATH_SSE 0
+#endif
+
+namespace GameEngine {
+namespace Math {
+namespace Fast {
+
+// Opt-in approximations for bulk work (particles, steering) that can give
+// up a few ULPs for throughput. Bounds are checked against std:: in
+// tests/Core/test_fastmath.cpp:
+//
+//   Sin, Cos, SinCos   absolute error <= 5e-7 for |x| <= 8192; beyond
+//                      that the range reduction degrades, so larger and
+//                      non-finite x fall back to std::sin/std::cos
+//   InvSqrt            relative error <= 5e-7 (rsqrt estimate plus one
+//                      Newton-Raphson step)
+//   Normalized         |length - 1| <= 1e-6; zero vectors stay zero
+//
+// The batch functions run on the active SIMD backend and stay within the
+// same bounds.
+
+namespace Detail {
+
+constexpr float kTwoOverPi = 0.63661977236f;
+// Largest |x| the reduction below handles within the error bound
+constexpr float kMaxReducedAngle = 8192.0f;
+// pi/2 split in three parts so k * part stays exact for large k
+constexpr float kPiOver2A = 1.5703125f;
+constexpr float kPiOver2B = 4.837512969970703125e-4f;
+constexpr float kPiOver2C = 7.54978995489188216e-8f;
+
+// Minimax polynomials on [-pi/4, pi/4] (Cephes sinf/cosf)
+constexpr float kSin3 = -1.6666654611e-1f;
+constexpr float kSin5 = 8.3321608736e-3f;
+constexpr float kSin7 = -1.9515295891e-4f;
+constexpr float kCos4 = 4.166664568298827e-2f;
+constexpr float kCos6 = -1.388731625493765e-3f;
+constexpr float kCos8 = 2.443315711809948e-5f;
+
+inline float SinPoly(float r, float r2) noexcept {
+    return ((kSin7 * r2 + kSin5) * r2 + kSin3) * r2 * r + r;
+}
+
+inline float CosPoly(float r2) noexcept {
+    return ((kCos8 * r2 + kCos6) * r2 + kCos4) * r2 * r2 - 0.5f * r2 + 1.0f;
+}
+
+} // namespace Detail
+
+inline void SinCos(float x, float& s, float& c) noexcept {
+    // Also catches NaN and inf, whose quadrant would not fit in an int
+    if (!(std::abs(x) <= Detail::kMaxReducedAngle)) {
+        s = std::sin(x);
+        c = std::cos(x);
+        return;
+    }
+    // Reduce to r in [-pi/4, pi/4] and the quadrant of x
+    const float q = x * Detail::kTwoOverPi;
+    const int quadrant = static_cast<int>(q + (q >= 0.0f ? 0.5f : -0.5f));
+    const float k = static_cast<float>(quadrant);
+    const float r = ((x - k * Detail::kPiOver2A) - k * Detail::kPiOver2B) - k * Detail::kPiOver2C;
+    const float r2 = r * r;
+    const float sr = Detail::SinPoly(r, r2);
+    const float cr = Detail::CosPoly(r2);
+
+    switch (quadrant & 3) {
+        case 0: s = sr; c = cr; break;
+        case 1: s = cr; c = -sr; break;
+        case 2: s = -sr; c = -cr; break;
+        default: s = -cr; c = sr; break;
+    }
+}
+
+inline float Sin(float x) noexcept {
+    float s, c;
+    SinCos(x, s, c);
+    return s;
+}
+
+inline float Cos(float x) noexcept {
+    float s, c;
+    SinCos(x, s, c);
+    return c;
+}
+
+// 1 / sqrt(x) for x > 0
+inline float InvSqrt(float x) noexcept {
+#if GE_FAST_MATH_SSE
+    const float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+    return y * (1.5f - 0.5f * x * y * y);
+#else
+    return 1.0f / std::sqrt(x);
+#endif
+}
+
+inline Vector2 Normalized(const Vector2& v) noexcept {
+    const float lengthSquared = v.Dot(v);
+    if (lengthSquared == 0.0f) return Vector2(0.0f, 0.0f);
+    return v * InvSqrt(lengthSquared);
+}
+
+inline Vector3 Normalized(const Vector3& v) noexcept {
+    const float lengthSquared = v.Dot(v);
+    if (lengthSquared == 0.0f) return Vector3(0.0f, 0.0f, 0.0f);
+    return v * InvSqrt(lengthSquared);
+}
+
+// sines[i], cosines[i] = SinCos(angles[i])
+void SinCosBatch(const float* angles, float* sines, float* cosines, size_t count);
+// out[i] = Normalized(in[i]); in == out is allowed
+void NormalizeBatch(const Vector3* in, Vector3* out, size_t count);
+
+} // namespace Fast
+}} // namespace GameEngine::Math
@@ -1,4 +1,5 @@
 #pragma once
+#include "GameEngine/Core/MappedFile.h"
 #include <string>
 #include <vector>
 #include <fstream>
@@ -7,8 +8,27 @@
 namespace GameEngine {
 namespace Core {
 
+// Reads and FileExists() also resolve through mounted asset archives,
+// which are searched before the disk, the most recently mounted first.
+// An entry "textures/a.png" of an archive mounted at "assets" is found as
+// "assets/textures/a.png". Writes always go to the disk.
 class FileSystem {
 public:
+    // Returns false if the archive cannot be opened
+    static bool MountArchive(const std::string& archivePath, const std::string& mountPoint = "");
+    static bool UnmountArchive(const std::string& archivePath);
+    static void UnmountAllArchives();
+
+    // Zero-copy read: prefer this for assets and anything large. The
+    // returned view borrows the OS page cache instead of a heap buffer
+    // (compressed archive entries are decompressed into one).
+    static std::optional<MappedFile> MapFile(const std::string& filepath,
+                                             MappedFile::Access access = MappedFile::Access::Sequential);
+
+    // Copying reads, for callers that need to own or modify the bytes.
+    // Regular files are read() once into a buffer of their exact size.
+    // Unlike MapFile these also read files that report size 0 (procfs,
+    // pipes), and a file truncated mid-read just comes back shorter.
     static std::optional<std::string> ReadTextFile(const std::string& filepath);
     static std::optional<std::vector<char>> ReadBinaryFile(const std::string& filepath);
     static bool WriteTextFile(const std::string& filepath, const std::string& content);
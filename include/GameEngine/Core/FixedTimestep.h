@@ -0,0 +1,90 @@
+#pragma once
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+
+namespace GameEngine {
+namespace Core {
+
+// Accumulator for a fixed-rate simulation. Real elapsed time is added
+// each frame and paid out in whole ticks of a constant step, so the
+// simulation sees the same delta on every tick regardless of frame rate.
+// Time is kept in integer nanoseconds, so long runs do not accumulate
+// floating-point error.
+//
+// A frame pays out at most maxTicksPerFrame ticks; time beyond that is
+// dropped, so a slow frame cannot demand ever more catch-up ticks (the
+// "spiral of death"). The simulation then runs slower than real time
+// until it keeps up again.
+class FixedTimestep {
+public:
+    using Duration = std::chrono::nanoseconds;
+
+    explicit FixedTimestep(double tickRate = 60.0, unsigned maxTicksPerFrame_ = 8)
+        : maxTicksPerFrame(maxTicksPerFrame_) {
+        SetTickRate(tickRate);
+    }
+
+    // Ticks per second, > 0; keeps any accumulated time. The step is
+    // clamped to [1 ns, 1 h], which also keeps a bad rate in a release
+    // build (<= 0, NaN) from producing a zero or undefined step.
+    void SetTickRate(double tickRate) {
+        assert(tickRate > 0.0 && "tick rate must be positive");
+        const double nanoseconds = 1e9 / tickRate;
+        const Duration maxStep = std::chrono::hours(1);
+        if (!(nanoseconds >= 1.0)) {
+            step = Duration(1);
+        } else if (nanoseconds >= static_cast<double>(maxStep.count())) {
+            step = maxStep;
+        } else {
+            step = Duration(static_cast<Duration::rep>(nanoseconds + 0.5));
+        }
+    }
+    void SetMaxTicksPerFrame(unsigned maxTicks) { maxTicksPerFrame = maxTicks; }
+
+    // Adds a frame's elapsed time; returns how many ticks to run now
+    unsigned Advance(Duration elapsed) {
+        if (elapsed.count() > 0) {
+            accumulator += elapsed;
+        }
+        Duration::rep due = accumulator / step;
+        if (due > static_cast<Duration::rep>(maxTicksPerFrame)) {
+            droppedTicks += static_cast<uint64_t>(due) - maxTicksPerFrame;
+            due = static_cast<Duration::rep>(maxTicksPerFrame);
+            // Keep the partial tick so interpolation stays continuous
+            accumulator = accumulator % step + step * due;
+        }
+        accumulator -= step * due;
+        tickCount += static_cast<uint64_t>(due);
+        return static_cast<unsigned>(due);
+    }
+
+    // Fraction of the next tick already elapsed, in [0, 1). Render blends
+    // the previous and current simulation states by this much.
+    float Alpha() const {
+        return static_cast<float>(static_cast<double>(accumulator.count()) / static_cast<double>(step.count()));
+    }
+
+    Duration GetStep() const { return step; }
+    float GetStepSeconds() const { return std::chrono::duration<float>(step).count(); }
+    double GetTickRate() const { return 1e9 / static_cast<double>(step.count()); }
+    unsigned GetMaxTicksPerFrame() const { return maxTicksPerFrame; }
+    uint64_t GetTickCount() const { return tickCount; }
+    // Ticks skipped by the catch-up cap
+    uint64_t GetDroppedTicks() const { return droppedTicks; }
+
+    void Reset() {
+        accumulator = Duration::zero();
+        tickCount = 0;
+        droppedTicks = 0;
+    }
+
+private:
+    Duration step{};
+    Duration accumulator{};
+    unsigned maxTicksPerFrame;
+    uint64_t tickCount = 0;
+    uint64_t droppedTicks = 0;
+};
+
+}} // namespace GameEngine::Core
@@ -0,0 +1,149 @@
+#pragma once
+#include "GameEngine/Core/MemoryTracker.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+namespace GameEngine {
+namespace Core {
+
+// Bump-pointer arena for transient data (visible lists, temporary
+// matrices, command buffers). Allocation is an align-and-add on a single
+// preallocated block; nothing is freed individually. Everything is
+// released at once by Reset(), or back to a marker by FreeToMarker().
+//
+// Allocate() returns nullptr when the block is exhausted. Used as a
+// std::pmr::memory_resource it throws std::bad_alloc instead, and
+// deallocate() is a no-op, so pmr containers built on a frame arena must
+// not outlive the next Reset().
+//
+// Not thread-safe: use one arena per thread. An arena constructed with a
+// tag reports to MemoryTracker in tracking builds.
+class FrameArena : public std::pmr::memory_resource {
+public:
+    using Marker = size_t;
+
+    explicit FrameArena(size_t capacity, const char* tag = nullptr);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // `alignment` must be a power of two
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) noexcept {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(buffer);
+        const uintptr_t aligned = (base + offset + (alignment - 1)) & ~uintptr_t(alignment - 1);
+        const size_t begin = aligned - base;
+        if (begin > capacity || size > capacity - begin) {
+            return nullptr;
+        }
+#if GE_MEMORY_TRACKING
+        if (tracker) tracker->OnAllocate(begin + size - offset, size);
+#endif
+        offset = begin + size;
+        if (offset > highWater) {
+            highWater = offset;
+        }
+        return buffer + begin;
+    }
+
+    // Constructs a T in the arena. Destructors are never run, so T must be
+    // trivially destructible.
+    template<typename T, typename... Args>
+    T* New(Args&&... args) {
+        static_assert(std::is_trivially_destructible<T>::value, "FrameArena never runs destructors");
+        void* memory = Allocate(sizeof(T), alignof(T));
+        return memory ? new(memory) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    // Default-constructs `count` Ts; trivial types are left uninitialized
+    template<typename T>
+    T* NewArray(size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value, "FrameArena never runs destructors");
+        if (count > capacity / sizeof(T)) {
+            return nullptr;
+        }
+        void* memory = Allocate(sizeof(T) * count, alignof(T));
+        if (memory == nullptr) {
+            return nullptr;
+        }
+        T* array = static_cast<T*>(memory);
+        for (size_t i = 0; i < count; ++i) {
+            new(array + i) T;
+        }
+        return array;
+    }
+
+    Marker GetMarker() const { return offset; }
+    // Releases everything allocated after `marker` was taken
+    void FreeToMarker(Marker marker);
+    void Reset() {
+        offset = 0;
+#if GE_MEMORY_TRACKING
+        if (tracker) tracker->OnRewind(0);
+#endif
+    }
+
+    size_t Used() const { return offset; }
+    size_t Capacity() const { return capacity; }
+    size_t Remaining() const { return capacity - offset; }
+    // Peak Used() since construction or ResetHighWaterMark()
+    size_t HighWaterMark() const { return highWater; }
+    void ResetHighWaterMark() { highWater = offset; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    unsigned char* buffer;
+    size_t capacity;
+    size_t offset = 0;
+    size_t highWater = 0;
+#if GE_MEMORY_TRACKING
+    std::unique_ptr<AllocationTracker> tracker;
+#endif
+};
+
+// Frees everything allocated in its lifetime when it goes out of scope
+class ScopedArenaMarker {
+public:
+    explicit ScopedArenaMarker(FrameArena& arena_) : arena(arena_), marker(arena_.GetMarker()) {}
+    ~ScopedArenaMarker() { arena.FreeToMarker(marker); }
+
+    ScopedArenaMarker(const ScopedArenaMarker&) = delete;
+    ScopedArenaMarker& operator=(const ScopedArenaMarker&) = delete;
+
+private:
+    FrameArena& arena;
+    FrameArena::Marker marker;
+};
+
+// Two arenas used in alternate frames, so data built during frame N
+// (e.g. render commands) stays valid while frame N+1 is being built.
+class DoubleBufferedFrameArena {
+public:
+    explicit DoubleBufferedFrameArena(size_t capacityPerFrame, const char* tag = nullptr)
+        : arenas{FrameArena(capacityPerFrame, tag), FrameArena(capacityPerFrame, tag)} {}
+
+    // Call once at the start of every frame: the arena of the frame before
+    // last is reset and becomes current, last frame's arena stays intact.
+    void BeginFrame() {
+        current ^= 1u;
+        arenas[current].Reset();
+    }
+
+    FrameArena& Current() { return arenas[current]; }
+    const FrameArena& Current() const { return arenas[current]; }
+    FrameArena& Previous() { return arenas[current ^ 1u]; }
+    const FrameArena& Previous() const { return arenas[current ^ 1u]; }
+
+private:
+    FrameArena arenas[2];
+    unsigned current = 0;
+};
+
+}} // namespace GameEngine::Core
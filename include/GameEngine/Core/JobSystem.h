@@ -0,0 +1,182 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace GameEngine {
+namespace Core {
+
+class JobCounter;
+
+namespace Detail {
+
+// A queued callable. Small callables are stored inline, larger ones on
+// the heap with a pointer stored inline.
+struct Job {
+    static constexpr size_t kStorageSize = 48;
+
+    void (*invoke)(Job& job) = nullptr;   // Runs and destroys the callable
+    JobCounter* counter = nullptr;
+    Job* next = nullptr;                  // Link in a counter's continuation list
+    alignas(std::max_align_t) unsigned char storage[kStorageSize];
+};
+
+} // namespace Detail
+
+// Counts the unfinished jobs of a group. Jobs started with a counter add
+// to it when started and subtract when finished; JobSystem::Wait() and
+// JobSystem::RunAfter() use it as the group's completion signal.
+//
+// Add jobs only while the counter cannot finish concurrently: before
+// waiting on it, or from one of its own jobs. Once IsDone() is true (or
+// Wait() returned) the counter may be reused or destroyed.
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> pending{0};
+    std::mutex mutex;                        // Guards the fields below
+    Detail::Job* continuations = nullptr;    // Started when the counter reaches zero
+    bool closing = false;                    // Last job finished; continuations were released
+};
+
+// Work-stealing job scheduler. Every worker owns a Chase-Lev deque: it
+// pushes and pops its own jobs at the bottom (LIFO, cache-warm) and idle
+// workers steal from the top of others (FIFO, the oldest and usually
+// largest work). The thread that constructs the system owns a deque too
+// and runs jobs while it waits; other threads submit through a shared
+// queue. Idle workers sleep rather than spin.
+//
+// Jobs must not throw; an escaping exception terminates the program.
+class JobSystem {
+public:
+    // 0 picks one thread per core: hardware_concurrency() - 1 workers plus
+    // the constructing thread, and at least one worker
+    explicit JobSystem(unsigned workerThreads = 0);
+    // Finishes every queued job, then joins the workers
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    unsigned GetWorkerCount() const;
+    // Workers plus the owning thread
+    unsigned GetThreadCount() const { return GetWorkerCount() + 1; }
+
+    template<typename F>
+    void Run(F&& job, JobCounter* counter = nullptr) {
+        Submit(MakeJob(std::forward<F>(job), counter));
+    }
+
+    // Starts `job` once `dependency` reaches zero, without blocking a thread
+    template<typename F>
+    void RunAfter(JobCounter& dependency, F&& job, JobCounter* counter = nullptr) {
+        SubmitAfter(dependency, MakeJob(std::forward<F>(job), counter));
+    }
+
+    // Runs other jobs on the calling thread until `counter` reaches zero
+    void Wait(JobCounter& counter);
+    // Runs jobs until none are queued or running. Not from inside a job,
+    // which would wait for itself.
+    void WaitIdle();
+
+    // Calls body(chunkBegin, chunkEnd) over [begin, end) split into chunks
+    // of at most `grain` indices (0 picks about 8 chunks per thread) and
+    // returns when all are done. Ranges are halved recursively, so idle
+    // threads steal large halves rather than one chunk at a time.
+    template<typename F>
+    void ParallelForRange(size_t begin, size_t end, F&& body, size_t grain = 0) {
+        if (begin >= end) {
+            return;
+        }
+        if (grain == 0) {
+            grain = DefaultGrain(end - begin);
+        }
+        if (end - begin <= grain) {
+            body(begin, end);
+            return;
+        }
+        JobCounter counter;
+        SplitRange(begin, end, grain, body, counter);
+        Wait(counter);
+    }
+
+    // Calls body(i) for every i in [begin, end)
+    template<typename F>
+    void ParallelFor(size_t begin, size_t end, F&& body, size_t grain = 0) {
+        ParallelForRange(
+            begin, end,
+            [&body](size_t chunkBegin, size_t chunkEnd) {
+                for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                    body(i);
+                }
+            },
+            grain);
+    }
+
+private:
+    struct Impl;
+
+    template<typename F>
+    Detail::Job* MakeJob(F&& function, JobCounter* counter) {
+        using Function = std::decay_t<F>;
+        if (counter != nullptr) {
+            AddToCounter(*counter);
+        }
+        Detail::Job* job = AllocateJob();
+        job->counter = counter;
+        if constexpr (sizeof(Function) <= Detail::Job::kStorageSize &&
+                      alignof(Function) <= alignof(std::max_align_t)) {
+            new (job->storage) Function(std::forward<F>(function));
+            job->invoke = [](Detail::Job& self) {
+                Function* stored = std::launder(reinterpret_cast<Function*>(self.storage));
+                (*stored)();
+                stored->~Function();
+            };
+        } else {
+            Function* stored = new Function(std::forward<F>(function));
+            std::memcpy(job->storage, &stored, sizeof(stored));
+            job->invoke = [](Detail::Job& self) {
+                Function* heap;
+                std::memcpy(&heap, self.storage, sizeof(heap));
+                (*heap)();
+                delete heap;
+            };
+        }
+        return job;
+    }
+
+    template<typename F>
+    void SplitRange(size_t begin, size_t end, size_t grain, F& body, JobCounter& counter) {
+        while (end - begin > grain) {
+            const size_t middle = begin + (end - begin) / 2;
+            Run([this, middle, end, grain, &body, &counter] { SplitRange(middle, end, grain, body, counter); },
+                &counter);
+            end = middle;
+        }
+        body(begin, end);
+    }
+
+    Detail::Job* AllocateJob();
+    void AddToCounter(JobCounter& counter);
+    void Submit(Detail::Job* job);
+    void SubmitAfter(JobCounter& dependency, Detail::Job* job);
+    size_t DefaultGrain(size_t count) const;
+
+    std::unique_ptr<Impl> impl;
+};
+
+}} // namespace GameEngine::Core
@@ -1,10 +1,32 @@
 #pragma once
+#include "GameEngine/Core/BinaryLog.h"
+#include <atomic>
+#include <cstddef>
 #include <string>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 
+// Lowest level the LOG_* macros compile in, as a LogLevel value. Calls
+// below it expand to a discarded `if constexpr` branch: the arguments are
+// type-checked but never evaluated. Defaults to Info when NDEBUG is set,
+// so LOG_DEBUG costs nothing in release builds.
+#ifndef GE_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define GE_LOG_MIN_LEVEL 1
+#else
+#define GE_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GE_LOG_PRINTF_FORMAT(formatIndex, firstArg) __attribute__((format(printf, formatIndex, firstArg)))
+#else
+#define GE_LOG_PRINTF_FORMAT(formatIndex, firstArg)
+#endif
+
 namespace GameEngine {
 namespace Core {
 
@@ -15,20 +37,92 @@ enum class LogLevel {
     Error = 3
 };
 
+// Synchronous logging writes and flushes each line on the calling thread.
+// Asynchronous logging formats the line on the calling thread, pushes it
+// into a lock-free ring and returns; a background thread writes records
+// to the file in batches. Flush(), Shutdown(), the Logger's destruction
+// and fatal signals (SIGSEGV, SIGABRT, SIGFPE, SIGILL) all wait for the
+// ring to drain, so accepted records are not lost on exit or crash.
+// Binary logging is asynchronous logging of BinaryLog records: LOG_EVENT
+// stores a format id, a timestamp and raw argument bytes, nothing is
+// formatted until the file is decoded offline.
+enum class LogMode {
+    Synchronous,
+    Asynchronous,
+    Binary
+};
+
 class Logger {
 private:
-    static std::unique_ptr<Logger> instance;
+    struct AsyncBackend;
+
     std::ofstream logFile;
-    LogLevel currentLevel;
+    std::atomic<LogLevel> currentLevel;
+    LogMode mode;
+    std::mutex fileMutex;   // Serializes synchronous writes
+    std::unique_ptr<AsyncBackend> async;
 
     Logger();
 
+    void LogText(LogLevel level, const char* text, size_t length);
+    void WriteLine(const std::string& line);
+    void PushRecord(const char* record, size_t size);
+    uint32_t RegisterEventSite(BinaryLog::Site& site, LogLevel level, const char* format, const char* signature);
+    void EmitClockSync();
+
 public:
-    static Logger& GetInstance();
+    // Records of 256 bytes; longer messages take several
+    static constexpr size_t kDefaultAsyncRecords = 8192;
+    // Formatted messages are built in a stack buffer of this size and
+    // truncated, ending in "...", if longer
+    static constexpr size_t kMaxFormattedMessage = 1024;
+
+    ~Logger();
 
-    void Initialize(const std::string& filename, LogLevel level = LogLevel::Debug);
+    // Inline, so each call is one guard check rather than a function call
+    static Logger& GetInstance() {
+        static Logger logger;
+        return logger;
+    }
+
+    // Not thread-safe with concurrent Log() calls. Re-initializing drains
+    // and stops any previous async writer first.
+    void Initialize(const std::string& filename, LogLevel level = LogLevel::Debug,
+                    LogMode mode = LogMode::Synchronous, size_t asyncRecords = kDefaultAsyncRecords);
     void Log(LogLevel level, const std::string& message);
-    void SetLogLevel(LogLevel level) { currentLevel = level; }
+    void SetLogLevel(LogLevel level) { currentLevel.store(level, std::memory_order_relaxed); }
+    bool IsEnabled(LogLevel level) const { return level >= currentLevel.load(std::memory_order_relaxed); }
+
+    // printf-style formatting into a stack buffer; no heap allocation.
+    // The format is checked at compile time, so log a runtime C string
+    // as Write(level, "%s", text).
+    void Write(LogLevel level, const char* format, ...) GE_LOG_PRINTF_FORMAT(3, 4);
+    void Write(LogLevel level, const std::string& message) { Log(level, message); }
+
+    // Binary mode only; use LOG_EVENT, which falls back to Write() in the
+    // text modes
+    template<typename... Args>
+    void WriteEvent(BinaryLog::Site& site, LogLevel level, const char* format, const Args&... args) {
+        static constexpr char signature[] = {BinaryLog::ArgCode<std::decay_t<Args>>::value..., '\0'};
+        const uint64_t timestamp = BinaryLog::ReadTimestamp();
+        uint32_t id = site.id.load(std::memory_order_acquire);
+        if (id == 0) {
+            id = RegisterEventSite(site, level, format, signature);
+        }
+
+        char record[sizeof(BinaryLog::RecordHeader) + BinaryLog::kMaxEventPayload];
+        size_t size = sizeof(BinaryLog::RecordHeader);
+        (BinaryLog::EncodeArg(record, size, sizeof(record), args), ...);
+        const BinaryLog::RecordHeader header{id, static_cast<uint32_t>(size - sizeof(header)), timestamp};
+        std::memcpy(record, &header, sizeof(header));
+        PushRecord(record, size);
+    }
+    LogMode GetMode() const { return mode; }
+
+    // Blocks until every record logged before the call is in the file
+    void Flush();
+    // Drains and stops the async writer and closes the file
+    void Shutdown();
 
     // Convenience methods for different log levels
     void Debug(const std::string& message) { Log(LogLevel::Debug, message); }
@@ -37,10 +131,40 @@ public:
     void Error(const std::string& message) { Log(LogLevel::Error, message); }
 };
 
-// Macros for easy logging
-#define LOG_DEBUG(msg) GameEngine::Core::Logger::GetInstance().Debug(msg)
-#define LOG_INFO(msg) GameEngine::Core::Logger::GetInstance().Info(msg)
-#define LOG_WARNING(msg) GameEngine::Core::Logger::GetInstance().Warning(msg)
-#define LOG_ERROR(msg) GameEngine::Core::Logger::GetInstance().Error(msg)
+// Macros for easy logging. Take a std::string message or a printf format
+// and its arguments; arguments are only evaluated when the level is
+// enabled.
+#define GE_LOG_AT(level, ...)                                                                   \
+    do {                                                                                        \
+        if constexpr (static_cast<int>(level) >= GE_LOG_MIN_LEVEL) {                            \
+            ::GameEngine::Core::Logger& geLogger_ = ::GameEngine::Core::Logger::GetInstance(); \
+            if (geLogger_.IsEnabled(level)) {                                                   \
+                geLogger_.Write(level, __VA_ARGS__);                                            \
+            }                                                                                   \
+        }                                                                                       \
+    } while (0)
+
+#define LOG_DEBUG(...) GE_LOG_AT(::GameEngine::Core::LogLevel::Debug, __VA_ARGS__)
+#define LOG_INFO(...) GE_LOG_AT(::GameEngine::Core::LogLevel::Info, __VA_ARGS__)
+#define LOG_WARNING(...) GE_LOG_AT(::GameEngine::Core::LogLevel::Warning, __VA_ARGS__)
+#define LOG_ERROR(...) GE_LOG_AT(::GameEngine::Core::LogLevel::Error, __VA_ARGS__)
+
+// High-frequency telemetry: LOG_EVENT(LogLevel::Info, "hit %d at %.2f", id, t).
+// In LogMode::Binary only the format id, a timestamp and the raw arguments
+// are recorded; in the text modes it behaves like the LOG_* macros.
+#define LOG_EVENT(level, ...)                                                                   \
+    do {                                                                                        \
+        if constexpr (static_cast<int>(level) >= GE_LOG_MIN_LEVEL) {                            \
+            ::GameEngine::Core::Logger& geLogger_ = ::GameEngine::Core::Logger::GetInstance(); \
+            if (geLogger_.IsEnabled(level)) {                                                   \
+                if (geLogger_.GetMode() == ::GameEngine::Core::LogMode::Binary) {               \
+                    static ::GameEngine::Core::BinaryLog::Site geSite_(__FILE__, __LINE__);     \
+                    geLogger_.WriteEvent(geSite_, level, __VA_ARGS__);                          \
+                } else {                                                                        \
+                    geLogger_.Write(level, __VA_ARGS__);                                        \
+                }                                                                               \
+            }                                                                                   \
+        }                                                                                       \
+    } while (0)
 
 }} // namespace GameEngine::Core
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GameEngine {
+namespace Core {
+
+// Read-only view of a whole file mapped into memory. Pages are loaded by
+// the OS on first touch and shared with the page cache, so reading a large
+// asset neither copies it into a heap buffer nor keeps two copies alive.
+// The view stays valid until the MappedFile is destroyed or moved from.
+//
+// The same interface also serves bytes that are not a file mapping of
+// their own: a view into memory kept alive by a shared owner (an entry of
+// a mapped AssetArchive), or an owned buffer (a decompressed entry, or the
+// whole file on platforms without mmap).
+class MappedFile {
+public:
+    // Access pattern hints, forwarded to madvise()
+    enum class Access {
+        Normal,
+        Sequential,   // Read front to back once: aggressive read-ahead
+        Random,       // Scattered reads: no read-ahead
+        WillNeed,     // Start paging the range in now
+        DontNeed      // Done with the range; its pages may be dropped
+    };
+
+    // Returns nullopt if the file cannot be opened or mapped. An empty
+    // file maps to an empty view.
+    static std::optional<MappedFile> Open(const std::string& filepath, Access access = Access::Normal);
+
+    // Views `size` bytes at `data`, valid while `owner` is alive
+    static MappedFile FromView(const char* data, size_t size, std::shared_ptr<const void> owner);
+    static MappedFile FromBuffer(std::vector<char> buffer);
+
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* Data() const { return data; }
+    size_t Size() const { return size; }
+    bool Empty() const { return size == 0; }
+    std::string_view View() const { return std::string_view(data, size); }
+
+    const char* begin() const { return data; }
+    const char* end() const { return data + size; }
+
+    // Hint for the bytes [offset, offset + length), clamped to the file.
+    // Returns false if the hint was rejected; the view is unaffected.
+    bool Advise(Access access, size_t offset = 0, size_t length = static_cast<size_t>(-1)) const;
+
+private:
+    void Release();
+
+    const char* data = nullptr;
+    size_t size = 0;
+    bool mapped = false;                  // `data` is our own mmap
+    std::shared_ptr<const void> owner;    // Otherwise keeps `data` alive
+};
+
+}} // namespace GameEngine::Core
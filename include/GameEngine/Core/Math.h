@@ -1,81 +1,588 @@
 #pragma once
 #include <cmath>
+#include <cstddef>
 #include <iostream>
+#include <optional>
 
 namespace GameEngine {
 namespace Math {
 
+// The math types are header-only so trivial operations inline into
+// callers; everything that does not need <cmath> is constexpr.
+//
+// constexpr Matrix4 products need __builtin_is_constant_evaluated() to
+// fall back to the scalar loop during constant evaluation; at run time
+// they use the dispatched SIMD kernels.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define GE_MATH_HAS_CONSTANT_EVALUATED 1
+#endif
+#endif
+#if !defined(GE_MATH_HAS_CONSTANT_EVALUATED)
+#if (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define GE_MATH_HAS_CONSTANT_EVALUATED 1
+#else
+#define GE_MATH_HAS_CONSTANT_EVALUATED 0
+#endif
+#endif
+
+#if GE_MATH_HAS_CONSTANT_EVALUATED
+#define GE_MATH_CONSTEXPR_DISPATCH constexpr
+#else
+#define GE_MATH_CONSTEXPR_DISPATCH
+#endif
+
+// sin and cos of the same angle in one call (one shared range reduction).
+inline void SinCos(float angle, float& s, float& c) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_sincosf(angle, &s, &c);
+#else
+    s = std::sin(angle);
+    c = std::cos(angle);
+#endif
+}
+
 class Vector2 {
 public:
     float x, y;
 
-    Vector2();
-    Vector2(float x, float y);
+    constexpr Vector2() noexcept : x(0.0f), y(0.0f) {}
+    constexpr Vector2(float x_, float y_) noexcept : x(x_), y(y_) {}
 
-    Vector2 operator+(const Vector2& other) const;
-    Vector2 operator-(const Vector2& other) const;
-    Vector2 operator*(float scalar) const;
-    Vector2 operator+=(const Vector2& other);
-    bool operator==(const Vector2& other);
-    bool operator!=(const Vector2& other);
+    constexpr Vector2 operator+(const Vector2& other) const noexcept { return Vector2(x + other.x, y + other.y); }
+    constexpr Vector2 operator-(const Vector2& other) const noexcept { return Vector2(x - other.x, y - other.y); }
+    constexpr Vector2 operator*(float scalar) const noexcept { return Vector2(x * scalar, y * scalar); }
+    constexpr Vector2 operator+=(const Vector2& other) noexcept {
+        x += other.x;
+        y += other.y;
+        return *this;
+    }
+    constexpr bool operator==(const Vector2& other) const noexcept { return x == other.x && y == other.y; }
+    constexpr bool operator!=(const Vector2& other) const noexcept { return !(*this == other); }
 
-    float Magnitude() const;
+    float Magnitude() const noexcept { return std::sqrt(x * x + y * y); }
     // length() is an alias for Magnitude
-    float length() const;
-    float MagnitudeSquared() const;
-    Vector2 Normalized() const;
-    float Dot(const Vector2& other) const;
-    
+    float length() const noexcept { return Magnitude(); }
+    constexpr float MagnitudeSquared() const noexcept { return x * x + y * y; }
+    Vector2 Normalized() const noexcept {
+        float mag = Magnitude();
+        if (mag == 0) return Vector2(0, 0); // Avoid division by zero
+        const float inv = 1.0f / mag;
+        return Vector2(x * inv, y * inv);
+    }
+    constexpr float Dot(const Vector2& other) const noexcept { return x * other.x + y * other.y; }
 };
 
 class Vector3 {
 public:
     float x, y, z;
 
-    Vector3();
-    Vector3(float x, float y, float z);
-
-    Vector3 operator+(const Vector3& other) const;
-    Vector3 operator-(const Vector3& other) const;
-    Vector3 operator*(float scalar) const;
-    Vector3 operator+=(const Vector3& other);
-    bool operator==(const Vector3& other) const;
-    bool operator!=(const Vector3& other) const;
-
-    float Magnitude() const;
-    float length() const; // Alias for Magnitude
-    Vector3 Normalized() const;
-    float Dot(const Vector3& other) const;
-    Vector3 Cross(const Vector3& other) const;
+    constexpr Vector3() noexcept : x(0.0f), y(0.0f), z(0.0f) {}
+    constexpr Vector3(float x_, float y_, float z_) noexcept : x(x_), y(y_), z(z_) {}
+
+    constexpr Vector3 operator+(const Vector3& other) const noexcept { return Vector3(x + other.x, y + other.y, z + other.z); }
+    constexpr Vector3 operator-(const Vector3& other) const noexcept { return Vector3(x - other.x, y - other.y, z - other.z); }
+    constexpr Vector3 operator*(float scalar) const noexcept { return Vector3(x * scalar, y * scalar, z * scalar); }
+    constexpr Vector3 operator+=(const Vector3& other) noexcept {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        return *this;
+    }
+    constexpr bool operator==(const Vector3& other) const noexcept { return x == other.x && y == other.y && z == other.z; }
+    constexpr bool operator!=(const Vector3& other) const noexcept { return !(*this == other); }
+
+    float Magnitude() const noexcept { return std::sqrt(x * x + y * y + z * z); }
+    float length() const noexcept { return Magnitude(); } // Alias for Magnitude
+    Vector3 Normalized() const noexcept {
+        float mag = Magnitude();
+        if (mag == 0) return Vector3(0, 0, 0); // Avoid division by zero
+        const float inv = 1.0f / mag;
+        return Vector3(x * inv, y * inv, z * inv);
+    }
+    constexpr float Dot(const Vector3& other) const noexcept { return x * other.x + y * other.y + z * other.z; }
+    constexpr Vector3 Cross(const Vector3& other) const noexcept {
+        return Vector3(
+            y * other.z - z * other.y,
+            z * other.x - x * other.z,
+            x * other.y - y * other.x
+        );
+    }
 };
 
+// Unit quaternion rotation (x, y, z vector part, w scalar part). The
+// product a * b applies b first, matching Matrix4 composition order.
+class Quaternion {
+public:
+    float x, y, z, w;
+
+    constexpr Quaternion() noexcept : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+    constexpr Quaternion(float x_, float y_, float z_, float w_) noexcept : x(x_), y(y_), z(z_), w(w_) {}
+
+    static constexpr Quaternion identity() noexcept { return Quaternion(); }
+    // `axis` must be unit length
+    static Quaternion fromAxisAngle(const Vector3& axis, float angle) noexcept {
+        float s, c;
+        SinCos(angle * 0.5f, s, c);
+        return Quaternion(axis.x * s, axis.y * s, axis.z * s, c);
+    }
+    static Quaternion rotationX(float angle) noexcept { return fromAxisAngle(Vector3(1.0f, 0.0f, 0.0f), angle); }
+    static Quaternion rotationY(float angle) noexcept { return fromAxisAngle(Vector3(0.0f, 1.0f, 0.0f), angle); }
+    static Quaternion rotationZ(float angle) noexcept { return fromAxisAngle(Vector3(0.0f, 0.0f, 1.0f), angle); }
+
+    constexpr Quaternion operator*(const Quaternion& o) const noexcept {
+        return Quaternion(w * o.x + x * o.w + y * o.z - z * o.y,
+                          w * o.y - x * o.z + y * o.w + z * o.x,
+                          w * o.z + x * o.y - y * o.x + z * o.w,
+                          w * o.w - x * o.x - y * o.y - z * o.z);
+    }
+    constexpr Quaternion operator+(const Quaternion& o) const noexcept { return Quaternion(x + o.x, y + o.y, z + o.z, w + o.w); }
+    constexpr Quaternion operator*(float scalar) const noexcept { return Quaternion(x * scalar, y * scalar, z * scalar, w * scalar); }
+    constexpr Quaternion operator-() const noexcept { return Quaternion(-x, -y, -z, -w); }
+    constexpr bool operator==(const Quaternion& o) const noexcept { return x == o.x && y == o.y && z == o.z && w == o.w; }
+    constexpr bool operator!=(const Quaternion& o) const noexcept { return !(*this == o); }
+
+    constexpr float Dot(const Quaternion& o) const noexcept { return x * o.x + y * o.y + z * o.z + w * o.w; }
+    float Magnitude() const noexcept { return std::sqrt(Dot(*this)); }
+    Quaternion Normalized() const noexcept {
+        float mag = Magnitude();
+        if (mag == 0) return Quaternion(); // Degenerate input maps to identity
+        return *this * (1.0f / mag);
+    }
+    constexpr Quaternion Conjugate() const noexcept { return Quaternion(-x, -y, -z, w); }
+    // Equal to Conjugate() for unit quaternions
+    constexpr Quaternion Inverse() const noexcept { return Conjugate() * (1.0f / Dot(*this)); }
+
+    // v' = v + 2w(q x v) + 2q x (q x v), cheaper than building a matrix
+    constexpr Vector3 Rotate(const Vector3& v) const noexcept {
+        const Vector3 q(x, y, z);
+        const Vector3 t = q.Cross(v) * 2.0f;
+        return v + t * w + q.Cross(t);
+    }
+
+    // Normalized linear interpolation along the shortest arc. Cheap and
+    // accurate enough for animation blending at small angular steps.
+    static Quaternion Nlerp(const Quaternion& a, const Quaternion& b, float t) noexcept {
+        const Quaternion end = a.Dot(b) < 0.0f ? -b : b;
+        return (a * (1.0f - t) + end * t).Normalized();
+    }
+
+    // Spherical interpolation along the shortest arc (constant angular
+    // velocity). Falls back to Nlerp when the inputs are nearly parallel.
+    static Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t) noexcept {
+        float cosTheta = a.Dot(b);
+        const Quaternion end = cosTheta < 0.0f ? -b : b;
+        cosTheta = std::abs(cosTheta);
+        if (cosTheta > kSlerpNlerpThreshold) {
+            return Nlerp(a, end, t);
+        }
+        const float theta = std::acos(cosTheta);
+        const float invSin = 1.0f / std::sin(theta);
+        return a * (std::sin((1.0f - t) * theta) * invSin) + end * (std::sin(t * theta) * invSin);
+    }
+
+    static constexpr float kSlerpNlerpThreshold = 0.9995f;
+};
+
+namespace Detail {
+// Runs the active SIMD backend's 4x4 multiply (SimdDispatch.cpp).
+void MultiplyMatrix4(const float* a, const float* b, float* out) noexcept;
+} // namespace Detail
+
+// Column-major 4x4 matrix: element (row, col) is m[row + col * 4].
 class Matrix4 {
 private:
     float m[16];
 public:
-    Matrix4();
-    Matrix4(const float values[16]);
+    constexpr Matrix4() noexcept : m{1.0f, 0.0f, 0.0f, 0.0f,
+                                     0.0f, 1.0f, 0.0f, 0.0f,
+                                     0.0f, 0.0f, 1.0f, 0.0f,
+                                     0.0f, 0.0f, 0.0f, 1.0f} {}
+    constexpr Matrix4(const float values[16]) noexcept : m{} {
+        for (int i = 0; i < 16; ++i) {
+            m[i] = values[i];
+        }
+    }
+
+    static constexpr Matrix4 identity() noexcept { return Matrix4(); }
+    static constexpr Matrix4 translation(float x, float y, float z) noexcept {
+        Matrix4 result;
+        result.m[12] = x; // Column 3, Row 0
+        result.m[13] = y; // Column 3, Row 1
+        result.m[14] = z; // Column 3, Row 2
+        return result;
+    }
+    static constexpr Matrix4 translation(const Vector3& position) noexcept {
+        return translation(position.x, position.y, position.z);
+    }
+    static constexpr Matrix4 scale(float x, float y, float z) noexcept {
+        Matrix4 result;
+        result.m[0] = x; // Scale X
+        result.m[5] = y; // Scale Y
+        result.m[10] = z; // Scale Z
+        return result;
+    }
+    static constexpr Matrix4 scale(const Vector3& scale) noexcept { return Matrix4::scale(scale.x, scale.y, scale.z); }
+    static constexpr Matrix4 scale(float uniform) noexcept { return scale(uniform, uniform, uniform); }
+    static Matrix4 rotationX(float angle) noexcept;
+    static Matrix4 rotationY(float angle) noexcept;
+    static Matrix4 rotationZ(float angle) noexcept;
+    // `rotation` must be unit length
+    static constexpr Matrix4 rotation(const Quaternion& rotation) noexcept {
+        return trs(Vector3(), rotation, Vector3(1.0f, 1.0f, 1.0f));
+    }
+    // translation * rotation * scale, built directly without the products
+    static constexpr Matrix4 trs(const Vector3& position, const Quaternion& rotation, const Vector3& scale) noexcept {
+        const float x = rotation.x, y = rotation.y, z = rotation.z, w = rotation.w;
+        const float xx = x * x, yy = y * y, zz = z * z;
+        const float xy = x * y, xz = x * z, yz = y * z;
+        const float wx = w * x, wy = w * y, wz = w * z;
+
+        Matrix4 result;
+        result.m[0] = (1.0f - 2.0f * (yy + zz)) * scale.x;
+        result.m[1] = 2.0f * (xy + wz) * scale.x;
+        result.m[2] = 2.0f * (xz - wy) * scale.x;
+        result.m[4] = 2.0f * (xy - wz) * scale.y;
+        result.m[5] = (1.0f - 2.0f * (xx + zz)) * scale.y;
+        result.m[6] = 2.0f * (yz + wx) * scale.y;
+        result.m[8] = 2.0f * (xz + wy) * scale.z;
+        result.m[9] = 2.0f * (yz - wx) * scale.z;
+        result.m[10] = (1.0f - 2.0f * (xx + yy)) * scale.z;
+        result.m[12] = position.x;
+        result.m[13] = position.y;
+        result.m[14] = position.z;
+        return result;
+    }
+
+    // Reference product used for constant evaluation and by the scalar
+    // backend; the summation order is what the SIMD backends match.
+    static constexpr Matrix4 multiplyScalar(const Matrix4& a, const Matrix4& b) noexcept {
+        Matrix4 result;
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                float sum = 0.0f;
+                for (int k = 0; k < 4; ++k) {
+                    sum += a.m[row + k * 4] * b.m[k + col * 4];
+                }
+                result.m[row + col * 4] = sum;
+            }
+        }
+        return result;
+    }
+
+    GE_MATH_CONSTEXPR_DISPATCH Matrix4 operator*(const Matrix4& other) const noexcept {
+#if GE_MATH_HAS_CONSTANT_EVALUATED
+        if (__builtin_is_constant_evaluated()) {
+            return multiplyScalar(*this, other);
+        }
+#endif
+        Matrix4 result;
+        Detail::MultiplyMatrix4(m, other.m, result.m);
+        return result;
+    }
 
-    static Matrix4 identity();
-    static Matrix4 translation(float x, float y, float z);
-    static Matrix4 translation(const Vector3& position);
-    static Matrix4 scale(float x, float y, float z);
-    static Matrix4 scale(const Vector3& scale);
-    static Matrix4 scale(float uniform);
-    static Matrix4 rotationX(float angle);
-    static Matrix4 rotationY(float angle);
-    static Matrix4 rotationZ(float angle);
+    constexpr float& operator()(int row, int col) noexcept { return m[row + col * 4]; }
+    constexpr const float& operator()(int row, int col) const noexcept { return m[row + col * 4]; }
 
-    Matrix4 operator*(const Matrix4& other) const;
+    constexpr float* data() noexcept { return m; }
+    constexpr const float* data() const noexcept { return m; }
 
-    float& operator()(int row, int col);
-    const float& operator()(int row, int col) const;
+    // True when the bottom row is exactly (0, 0, 0, 1), i.e. the matrix
+    // can be handled by AffineTransform and inverseAffine().
+    constexpr bool isAffine() const noexcept {
+        return m[3] == 0.0f && m[7] == 0.0f && m[11] == 0.0f && m[15] == 1.0f;
+    }
 
-    float* data();
-    const float* data() const;
+    // General 4x4 inverse via cofactor expansion. Empty when singular.
+    constexpr std::optional<Matrix4> inverse() const noexcept;
+    // Cheaper inverse for matrices where isAffine() holds.
+    constexpr std::optional<Matrix4> inverseAffine() const noexcept;
 
-    Vector3 transformPoint(const Vector3& point) const;
-    Vector3 transformDirection(const Vector3& direction) const;
+    // Single-element transforms stay scalar and inline: for one point a
+    // call into a SIMD kernel costs more than the nine multiplies.
+    constexpr Vector3 transformPoint(const Vector3& point) const noexcept {
+        return Vector3(m[0] * point.x + m[4] * point.y + m[8] * point.z + m[12],
+                       m[1] * point.x + m[5] * point.y + m[9] * point.z + m[13],
+                       m[2] * point.x + m[6] * point.y + m[10] * point.z + m[14]);
+    }
+    constexpr Vector3 transformDirection(const Vector3& direction) const noexcept {
+        return Vector3(m[0] * direction.x + m[4] * direction.y + m[8] * direction.z,
+                       m[1] * direction.x + m[5] * direction.y + m[9] * direction.z,
+                       m[2] * direction.x + m[6] * direction.y + m[10] * direction.z);
+    }
+
+    // Batch transforms. These stream through the arrays with the active
+    // SIMD backend and should be preferred over per-element calls.
+    // `in` and `out` may be the same array; other overlaps are undefined.
+    void transformPoints(const Vector3* in, Vector3* out, size_t count) const;
+    void transformDirections(const Vector3* in, Vector3* out, size_t count) const;
+    void transformPointsInPlace(Vector3* points, size_t count) const;
+    void transformDirectionsInPlace(Vector3* directions, size_t count) const;
+
+    // Strided variants for interleaved buffers (e.g. vertex position in a
+    // larger vertex struct). Strides are in bytes and point at x, y, z floats.
+    void transformPoints(const float* in, size_t inStride, float* out, size_t outStride, size_t count) const;
+    void transformDirections(const float* in, size_t inStride, float* out, size_t outStride, size_t count) const;
+
+    // Structure-of-arrays variants: separate x, y, z streams.
+    void transformPoints(const float* inX, const float* inY, const float* inZ,
+                         float* outX, float* outY, float* outZ, size_t count) const;
+    void transformDirections(const float* inX, const float* inY, const float* inZ,
+                             float* outX, float* outY, float* outZ, size_t count) const;
 };
 
+inline Matrix4 Matrix4::rotationX(float angle) noexcept {
+    Matrix4 result;
+    float s, c;
+    SinCos(angle, s, c);
+    result.m[5] = c; // cos(angle)
+    result.m[6] = s; // sin(angle), column 1 row 2
+    result.m[9] = -s; // -sin(angle), column 2 row 1
+    result.m[10] = c; // cos(angle)
+    return result;
+}
+
+inline Matrix4 Matrix4::rotationY(float angle) noexcept {
+    Matrix4 result;
+    float s, c;
+    SinCos(angle, s, c);
+    result.m[0] = c; // cos(angle)
+    result.m[2] = -s; // -sin(angle), column 0 row 2
+    result.m[8] = s; // sin(angle), column 2 row 0
+    result.m[10] = c; // cos(angle)
+    return result;
+}
+
+inline Matrix4 Matrix4::rotationZ(float angle) noexcept {
+    Matrix4 result;
+    float s, c;
+    SinCos(angle, s, c);
+    result.m[0] = c; // cos(angle)
+    result.m[1] = s; // sin(angle), column 0 row 1
+    result.m[4] = -s; // -sin(angle), column 1 row 0
+    result.m[5] = c; // cos(angle)
+    return result;
+}
+
+// Affine transform stored as the top three rows of a column-major 4x4
+// matrix; the bottom row is implicitly (0, 0, 0, 1). Translation, scale
+// and rotation chains stay affine, and composing two of them costs 36
+// multiplies instead of the 64 of a full Matrix4 product.
+class AffineTransform {
+private:
+    float m[12]; // Element (row, col) is m[row + col * 3]; column 3 is translation
+public:
+    constexpr AffineTransform() noexcept : m{1.0f, 0.0f, 0.0f,
+                                             0.0f, 1.0f, 0.0f,
+                                             0.0f, 0.0f, 1.0f,
+                                             0.0f, 0.0f, 0.0f} {}
+    // Drops the bottom row; only meaningful when matrix.isAffine().
+    constexpr explicit AffineTransform(const Matrix4& matrix) noexcept : m{} {
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 3; ++row) {
+                m[row + col * 3] = matrix(row, col);
+            }
+        }
+    }
+
+    static constexpr AffineTransform identity() noexcept { return AffineTransform(); }
+    static constexpr AffineTransform translation(float x, float y, float z) noexcept {
+        AffineTransform result;
+        result.m[9] = x;
+        result.m[10] = y;
+        result.m[11] = z;
+        return result;
+    }
+    static constexpr AffineTransform translation(const Vector3& position) noexcept {
+        return translation(position.x, position.y, position.z);
+    }
+    static constexpr AffineTransform scale(float x, float y, float z) noexcept {
+        AffineTransform result;
+        result.m[0] = x;
+        result.m[4] = y;
+        result.m[8] = z;
+        return result;
+    }
+    static constexpr AffineTransform scale(const Vector3& scale) noexcept { return AffineTransform::scale(scale.x, scale.y, scale.z); }
+    static constexpr AffineTransform scale(float uniform) noexcept { return scale(uniform, uniform, uniform); }
+    static AffineTransform rotationX(float angle) noexcept { return AffineTransform(Matrix4::rotationX(angle)); }
+    static AffineTransform rotationY(float angle) noexcept { return AffineTransform(Matrix4::rotationY(angle)); }
+    static AffineTransform rotationZ(float angle) noexcept { return AffineTransform(Matrix4::rotationZ(angle)); }
+
+    constexpr AffineTransform operator*(const AffineTransform& other) const noexcept {
+        AffineTransform result;
+        // Linear part: 3x3 * 3x3 (27 multiplies)
+        for (int col = 0; col < 3; ++col) {
+            const float b0 = other.m[col * 3], b1 = other.m[col * 3 + 1], b2 = other.m[col * 3 + 2];
+            for (int row = 0; row < 3; ++row) {
+                result.m[row + col * 3] = m[row] * b0 + m[row + 3] * b1 + m[row + 6] * b2;
+            }
+        }
+        // Translation: this.linear * other.translation + this.translation (9 multiplies)
+        const float tx = other.m[9], ty = other.m[10], tz = other.m[11];
+        for (int row = 0; row < 3; ++row) {
+            result.m[row + 9] = m[row] * tx + m[row + 3] * ty + m[row + 6] * tz + m[row + 9];
+        }
+        return result;
+    }
+
+    constexpr float& operator()(int row, int col) noexcept { return m[row + col * 3]; }
+    constexpr const float& operator()(int row, int col) const noexcept { return m[row + col * 3]; }
+
+    constexpr float* data() noexcept { return m; }
+    constexpr const float* data() const noexcept { return m; }
+
+    constexpr Vector3 transformPoint(const Vector3& point) const noexcept {
+        return Vector3(m[0] * point.x + m[3] * point.y + m[6] * point.z + m[9],
+                       m[1] * point.x + m[4] * point.y + m[7] * point.z + m[10],
+                       m[2] * point.x + m[5] * point.y + m[8] * point.z + m[11]);
+    }
+    constexpr Vector3 transformDirection(const Vector3& direction) const noexcept {
+        return Vector3(m[0] * direction.x + m[3] * direction.y + m[6] * direction.z,
+                       m[1] * direction.x + m[4] * direction.y + m[7] * direction.z,
+                       m[2] * direction.x + m[5] * direction.y + m[8] * direction.z);
+    }
+
+    constexpr Matrix4 toMatrix4() const noexcept {
+        Matrix4 result;
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 3; ++row) {
+                result(row, col) = m[row + col * 3];
+            }
+        }
+        return result;
+    }
+
+    // Inverts the 3x3 linear part by cofactors and maps the translation
+    // through it. Empty when the linear part is singular (e.g. zero scale).
+    constexpr std::optional<AffineTransform> inverse() const noexcept {
+        // Cofactors of the linear part, laid out as the inverse's columns
+        const float c00 = m[4] * m[8] - m[7] * m[5];
+        const float c01 = m[7] * m[2] - m[1] * m[8];
+        const float c02 = m[1] * m[5] - m[4] * m[2];
+        const float det = m[0] * c00 + m[3] * c01 + m[6] * c02;
+        if (det == 0.0f) {
+            return std::nullopt;
+        }
+        const float invDet = 1.0f / det;
+
+        AffineTransform result;
+        result.m[0] = c00 * invDet;
+        result.m[1] = c01 * invDet;
+        result.m[2] = c02 * invDet;
+        result.m[3] = (m[6] * m[5] - m[3] * m[8]) * invDet;
+        result.m[4] = (m[0] * m[8] - m[6] * m[2]) * invDet;
+        result.m[5] = (m[3] * m[2] - m[0] * m[5]) * invDet;
+        result.m[6] = (m[3] * m[7] - m[6] * m[4]) * invDet;
+        result.m[7] = (m[6] * m[1] - m[0] * m[7]) * invDet;
+        result.m[8] = (m[0] * m[4] - m[3] * m[1]) * invDet;
+        result.setInverseTranslation(m[9], m[10], m[11]);
+        return result;
+    }
+
+    // Inverse for rotation + translation only (no scale or shear): the
+    // linear part is orthonormal, so its inverse is its transpose.
+    constexpr AffineTransform inverseRigid() const noexcept {
+        AffineTransform result;
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                result.m[row + col * 3] = m[col + row * 3];
+            }
+        }
+        result.setInverseTranslation(m[9], m[10], m[11]);
+        return result;
+    }
+
+private:
+    // Given this transform's inverted linear part, sets t' = -L^-1 * t.
+    constexpr void setInverseTranslation(float tx, float ty, float tz) noexcept {
+        for (int row = 0; row < 3; ++row) {
+            m[row + 9] = -(m[row] * tx + m[row + 3] * ty + m[row + 6] * tz);
+        }
+    }
+};
+
+constexpr std::optional<Matrix4> Matrix4::inverse() const noexcept {
+    // Adjugate via 2x2 sub-determinants of the first/last two columns.
+    // The formula is layout-agnostic: inverse(transpose(A)) is
+    // transpose(inverse(A)), so indexing m[] row-major is fine here.
+    const float s0 = m[0] * m[5] - m[4] * m[1];
+    const float s1 = m[0] * m[6] - m[4] * m[2];
+    const float s2 = m[0] * m[7] - m[4] * m[3];
+    const float s3 = m[1] * m[6] - m[5] * m[2];
+    const float s4 = m[1] * m[7] - m[5] * m[3];
+    const float s5 = m[2] * m[7] - m[6] * m[3];
+    const float c5 = m[10] * m[15] - m[14] * m[11];
+    const float c4 = m[9] * m[15] - m[13] * m[11];
+    const float c3 = m[9] * m[14] - m[13] * m[10];
+    const float c2 = m[8] * m[15] - m[12] * m[11];
+    const float c1 = m[8] * m[14] - m[12] * m[10];
+    const float c0 = m[8] * m[13] - m[12] * m[9];
+
+    const float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    if (det == 0.0f) {
+        return std::nullopt;
+    }
+    const float invDet = 1.0f / det;
+
+    Matrix4 result;
+    result.m[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) * invDet;
+    result.m[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * invDet;
+    result.m[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+    result.m[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+
+    result.m[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * invDet;
+    result.m[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) * invDet;
+    result.m[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+    result.m[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+
+    result.m[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) * invDet;
+    result.m[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * invDet;
+    result.m[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+    result.m[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * invDet;
+
+    result.m[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * invDet;
+    result.m[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * invDet;
+    result.m[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+    result.m[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * invDet;
+    return result;
+}
+
+constexpr std::optional<Matrix4> Matrix4::inverseAffine() const noexcept {
+    std::optional<AffineTransform> inv = AffineTransform(*this).inverse();
+    if (!inv) {
+        return std::nullopt;
+    }
+    return inv->toMatrix4();
+}
+
+// Instruction set used by the Matrix4 multiply/transform kernels.
+// The best supported backend is picked from CPUID on first use.
+//
+// Scalar and SSE41 produce bit-identical results. AVX2 contracts the
+// multiply-adds into FMA, so each output element may differ from the
+// scalar result by up to 4 * FLT_EPSILON * sum(|a_ik * b_kj|), i.e. a few
+// ULP relative to the magnitude of the products that were summed.
+enum class SimdBackend {
+    Scalar = 0,
+    SSE41 = 1,
+    AVX2 = 2
+};
+
+// Batch quaternion/TRS helpers running on the active SIMD backend. The
+// SIMD slerp evaluates acos/sin with polynomials and stays within 1e-5 of
+// Quaternion::Slerp per component; the scalar backend matches it exactly.
+// Inputs must be unit quaternions.
+void NlerpBatch(const Quaternion* a, const Quaternion* b, const float* t, Quaternion* out, size_t count);
+void SlerpBatch(const Quaternion* a, const Quaternion* b, const float* t, Quaternion* out, size_t count);
+// out[i] = Matrix4::trs(positions[i], rotations[i], scales[i])
+void ComposeTRS(const Vector3* positions, const Quaternion* rotations, const Vector3* scales,
+                Matrix4* out, size_t count);
+
+SimdBackend GetSimdBackend();
+bool IsSimdBackendSupported(SimdBackend backend);
+// Pins a backend (tests/benchmarks). Returns false if the CPU lacks it.
+bool SetSimdBackend(SimdBackend backend);
+const char* GetSimdBackendName(SimdBackend backend);
+
 }} // namespace GameEngine::Math
\ No newline at end of file
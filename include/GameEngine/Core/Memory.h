@@ -1,38 +1,104 @@
 #pragma once
+#include "GameEngine/Core/MemoryTracker.h"
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <vector>
 #include <cstddef>
 
 namespace GameEngine {
 namespace Core {
 
-// Simple memory pool for fixed-size allocations
+namespace Detail {
+
+// Pool storage slot. While a slot is free it holds the link to the next
+// free slot, so free lists need no memory of their own.
+template<typename T>
+union PoolSlot {
+    PoolSlot* next;
+    alignas(T) unsigned char storage[sizeof(T)];
+};
+
+// Small per-process index for the calling thread, used to pick a
+// per-thread cache inside a pool without a thread_local per pool
+// instance. Indices are recycled when threads exit; threads beyond
+// kMaxThreadSlots get kMaxThreadSlots and must take a locked path.
+constexpr size_t kMaxThreadSlots = 64;
+size_t AcquireThreadSlot();
+void ReleaseThreadSlot(size_t slot);
+
+inline size_t CurrentThreadSlot() {
+    struct Holder {
+        size_t slot = AcquireThreadSlot();
+        ~Holder() { ReleaseThreadSlot(slot); }
+    };
+    thread_local Holder holder;
+    return holder.slot;
+}
+
+} // namespace Detail
+
+// Simple memory pool for fixed-size allocations. Slots are handed out from
+// a bump index first and recycled through an intrusive free list, so
+// construction is O(1) and a slot costs max(sizeof(T), sizeof(void*)).
+// Pools constructed with a tag report to MemoryTracker in tracking builds.
 template<typename T, size_t PoolSize = 1024>
 class MemoryPool {
 private:
-    alignas(T) char pool[sizeof(T) * PoolSize];
-    std::vector<T*> freeList;
-    size_t nextFree;
+    using Slot = Detail::PoolSlot<T>;
+
+    // Bookkeeping first so it shares a cache line
+    Slot* freeHead;
+    size_t nextFree;   // Slots at or past this index have never been used
+    size_t usedCount;
+#if GE_MEMORY_TRACKING
+    std::unique_ptr<AllocationTracker> tracker;
+#endif
+    Slot pool[PoolSize];
 
 public:
-    MemoryPool() : nextFree(0) {
-        // Initialize free list
-        for (size_t i = 0; i < PoolSize; ++i) {
-            freeList.push_back(reinterpret_cast<T*>(&pool[i * sizeof(T)]));
+    MemoryPool() : freeHead(nullptr), nextFree(0), usedCount(0) {}
+
+    explicit MemoryPool(const char* tag) : MemoryPool() {
+#if GE_MEMORY_TRACKING
+        if (tag != nullptr) {
+            tracker = std::make_unique<AllocationTracker>(
+                tag, [](const void*) { return sizeof(Slot) * PoolSize; }, this);
         }
+#else
+        (void)tag;
+#endif
     }
 
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
     template<typename... Args>
     T* Allocate(Args&&... args) {
-        if (freeList.empty()) {
+        Slot* slot;
+        if (freeHead != nullptr) {
+            slot = freeHead;
+            freeHead = slot->next;
+        } else if (nextFree < PoolSize) {
+            slot = &pool[nextFree++];
+        } else {
             return nullptr; // No free memory available
         }
 
-        T* ptr = freeList.back();
-        freeList.pop_back();
-
         // Placement new
-        new(ptr) T(std::forward<Args>(args)...);
+        T* ptr;
+        try {
+            ptr = new(slot->storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            slot->next = freeHead;
+            freeHead = slot;
+            throw;
+        }
+        ++usedCount;
+#if GE_MEMORY_TRACKING
+        if (tracker) tracker->OnAllocate(sizeof(Slot), sizeof(T));
+#endif
         return ptr;
     }
 
@@ -43,31 +109,48 @@ public:
         ptr->~T();
 
         // Return to free list
-        freeList.push_back(ptr);
+        Slot* slot = reinterpret_cast<Slot*>(ptr);
+        slot->next = freeHead;
+        freeHead = slot;
+        --usedCount;
+#if GE_MEMORY_TRACKING
+        if (tracker) tracker->OnFree(sizeof(Slot), sizeof(T));
+#endif
     }
 
-    size_t AvailableCount() const { return freeList.size(); }
-    size_t UsedCount() const { return PoolSize - freeList.size(); }
+    size_t AvailableCount() const { return PoolSize - usedCount; }
+    size_t UsedCount() const { return usedCount; }
 };
 
-// RAII wrapper for memory pool
+// RAII wrapper for memory pool. Works with any pool that has
+// Deallocate(T*), whatever its size: the pool type is erased into a
+// function pointer.
 template<typename T>
 class PoolPtr {
 private:
+    using DeallocateFn = void (*)(void*, T*);
+
     T* ptr;
-    MemoryPool<T>* pool;
+    void* pool;
+    DeallocateFn deallocate;
+
+    template<typename Pool>
+    static void DeallocateFrom(void* pool, T* ptr) {
+        static_cast<Pool*>(pool)->Deallocate(ptr);
+    }
 
 public:
-    PoolPtr(T* p, MemoryPool<T>* pool_) : ptr(p), pool(pool_) {}
+    template<typename Pool>
+    PoolPtr(T* p, Pool* pool_) : ptr(p), pool(pool_), deallocate(&DeallocateFrom<Pool>) {}
 
     ~PoolPtr() {
         if (ptr && pool) {
-            pool->Deallocate(ptr);
+            deallocate(pool, ptr);
         }
     }
 
     // Move semantics
-    PoolPtr(PoolPtr&& other) noexcept : ptr(other.ptr), pool(other.pool) {
+    PoolPtr(PoolPtr&& other) noexcept : ptr(other.ptr), pool(other.pool), deallocate(other.deallocate) {
         other.ptr = nullptr;
         other.pool = nullptr;
     }
@@ -75,10 +158,11 @@ public:
     PoolPtr& operator=(PoolPtr&& other) noexcept {
         if (this != &other) {
             if (ptr && pool) {
-                pool->Deallocate(ptr);
+                deallocate(pool, ptr);
             }
             ptr = other.ptr;
             pool = other.pool;
+            deallocate = other.deallocate;
             other.ptr = nullptr;
             other.pool = nullptr;
         }
@@ -94,4 +178,252 @@ public:
     bool isValid() const { return ptr != nullptr; }
 };
 
+// Thread-safe pool that grows by ChunkSize objects at a time instead of
+// returning nullptr. Chunks are never moved or released before the pool
+// is destroyed, so live objects keep their addresses. Each thread
+// allocates from and frees to its own cache of free slots; the shared
+// mutex is only taken to move a batch between a cache and the shared
+// free list, or to add a chunk. Objects may be freed on any thread.
+// Pools constructed with a tag report to MemoryTracker in tracking builds.
+template<typename T, size_t ChunkSize = 256>
+class GrowableMemoryPool {
+private:
+    static_assert(ChunkSize > 0, "ChunkSize must be positive");
+
+    using Slot = Detail::PoolSlot<T>;
+
+    static constexpr size_t kBatchSize = ChunkSize < 32 ? ChunkSize : 32;
+
+    struct alignas(64) ThreadCache {
+        Slot* head = nullptr;
+        size_t count = 0;
+        // Allocations minus frees on this thread; only the owner writes it
+        std::atomic<std::ptrdiff_t> live{0};
+    };
+
+    ThreadCache caches[Detail::kMaxThreadSlots];
+
+    std::mutex mutex;
+    std::vector<Slot*> chunks;
+    Slot* freeHead = nullptr;
+    Slot* bumpNext = nullptr;
+    Slot* bumpEnd = nullptr;
+    std::atomic<size_t> chunkCount{0};
+    std::atomic<size_t> drawn{0};       // Slots handed to threads (live or cached)
+    std::atomic<size_t> highWater{0};
+    std::atomic<std::ptrdiff_t> uncachedLive{0};
+#if GE_MEMORY_TRACKING
+    // Last member, so it unregisters before the rest of the pool is torn down
+    std::unique_ptr<AllocationTracker> tracker;
+#endif
+
+public:
+    GrowableMemoryPool() = default;
+
+    explicit GrowableMemoryPool(const char* tag) {
+#if GE_MEMORY_TRACKING
+        if (tag != nullptr) {
+            tracker = std::make_unique<AllocationTracker>(
+                tag,
+                [](const void* owner) {
+                    return static_cast<const GrowableMemoryPool*>(owner)->CapacityCount() * sizeof(Slot);
+                },
+                this);
+        }
+#else
+        (void)tag;
+#endif
+    }
+
+    ~GrowableMemoryPool() {
+        for (Slot* chunk : chunks) {
+            ::operator delete(chunk, std::align_val_t(alignof(Slot)));
+        }
+    }
+
+    GrowableMemoryPool(const GrowableMemoryPool&) = delete;
+    GrowableMemoryPool& operator=(const GrowableMemoryPool&) = delete;
+
+    template<typename... Args>
+    T* Allocate(Args&&... args) {
+        Slot* slot = PopSlot();
+        T* ptr;
+        try {
+            ptr = new(slot->storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            PushSlot(slot);
+            throw;
+        }
+#if GE_MEMORY_TRACKING
+        if (tracker) tracker->OnAllocate(sizeof(Slot), sizeof(T));
+#endif
+        return ptr;
+    }
+
+    void Deallocate(T* ptr) {
+        if (ptr == nullptr) return;
+        ptr->~T();
+        PushSlot(reinterpret_cast<Slot*>(ptr));
+#if GE_MEMORY_TRACKING
+        if (tracker) tracker->OnFree(sizeof(Slot), sizeof(T));
+#endif
+    }
+
+    // Counts are exact when no other thread is allocating concurrently
+    size_t UsedCount() const {
+        std::ptrdiff_t used = uncachedLive.load(std::memory_order_relaxed);
+        for (const ThreadCache& cache : caches) {
+            used += cache.live.load(std::memory_order_relaxed);
+        }
+        return used > 0 ? static_cast<size_t>(used) : 0;
+    }
+    size_t CapacityCount() const { return chunkCount.load(std::memory_order_relaxed) * ChunkSize; }
+    size_t AvailableCount() const { return CapacityCount() - UsedCount(); }
+    size_t ChunkCount() const { return chunkCount.load(std::memory_order_relaxed); }
+
+    // Peak number of slots out of the shared pool at once, i.e. live
+    // objects plus slots parked in per-thread caches (at most
+    // 2 * 32 per thread). This is the capacity a fixed pool would need.
+    size_t HighWaterMark() const { return highWater.load(std::memory_order_relaxed); }
+    void ResetHighWaterMark() {
+        std::lock_guard<std::mutex> lock(mutex);
+        highWater.store(drawn.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+private:
+    Slot* PopSlot() {
+        const size_t thread = Detail::CurrentThreadSlot();
+        if (thread >= Detail::kMaxThreadSlots) {
+            size_t count = 0;
+            std::lock_guard<std::mutex> lock(mutex);
+            uncachedLive.fetch_add(1, std::memory_order_relaxed);
+            return TakeLocked(1, count);
+        }
+
+        ThreadCache& cache = caches[thread];
+        if (cache.head == nullptr) {
+            std::lock_guard<std::mutex> lock(mutex);
+            cache.head = TakeLocked(kBatchSize, cache.count);
+        }
+        Slot* slot = cache.head;
+        cache.head = slot->next;
+        --cache.count;
+        cache.live.store(cache.live.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return slot;
+    }
+
+    void PushSlot(Slot* slot) {
+        const size_t thread = Detail::CurrentThreadSlot();
+        if (thread >= Detail::kMaxThreadSlots) {
+            slot->next = nullptr;
+            std::lock_guard<std::mutex> lock(mutex);
+            uncachedLive.fetch_sub(1, std::memory_order_relaxed);
+            ReturnLocked(slot, slot, 1);
+            return;
+        }
+
+        ThreadCache& cache = caches[thread];
+        slot->next = cache.head;
+        cache.head = slot;
+        ++cache.count;
+        cache.live.store(cache.live.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+
+        if (cache.count >= 2 * kBatchSize) {
+            // Keep the most recently freed (cache-warm) batch, return the rest
+            Slot* keepTail = cache.head;
+            for (size_t i = 1; i < kBatchSize; ++i) {
+                keepTail = keepTail->next;
+            }
+            Slot* returnHead = keepTail->next;
+            keepTail->next = nullptr;
+            Slot* returnTail = returnHead;
+            const size_t returnCount = cache.count - kBatchSize;
+            for (size_t i = 1; i < returnCount; ++i) {
+                returnTail = returnTail->next;
+            }
+            cache.count = kBatchSize;
+            std::lock_guard<std::mutex> lock(mutex);
+            ReturnLocked(returnHead, returnTail, returnCount);
+        }
+    }
+
+    // Links up to `want` slots (at least one) into a list; grows if needed
+    Slot* TakeLocked(size_t want, size_t& got) {
+        Slot* head = nullptr;
+        got = 0;
+        while (got < want) {
+            Slot* slot;
+            if (freeHead != nullptr) {
+                slot = freeHead;
+                freeHead = slot->next;
+            } else if (bumpNext != bumpEnd) {
+                slot = bumpNext++;
+            } else if (got > 0) {
+                break;
+            } else {
+                Grow();
+                continue;
+            }
+            slot->next = head;
+            head = slot;
+            ++got;
+        }
+        const size_t nowDrawn = drawn.load(std::memory_order_relaxed) + got;
+        drawn.store(nowDrawn, std::memory_order_relaxed);
+        if (nowDrawn > highWater.load(std::memory_order_relaxed)) {
+            highWater.store(nowDrawn, std::memory_order_relaxed);
+        }
+        return head;
+    }
+
+    void ReturnLocked(Slot* head, Slot* tail, size_t count) {
+        tail->next = freeHead;
+        freeHead = head;
+        drawn.store(drawn.load(std::memory_order_relaxed) - count, std::memory_order_relaxed);
+    }
+
+    void Grow() {
+        chunks.reserve(chunks.size() + 1);
+        Slot* chunk = static_cast<Slot*>(::operator new(sizeof(Slot) * ChunkSize, std::align_val_t(alignof(Slot))));
+        chunks.push_back(chunk);
+        bumpNext = chunk;
+        bumpEnd = chunk + ChunkSize;
+        chunkCount.store(chunks.size(), std::memory_order_relaxed);
+    }
+};
+
+// STL allocator that aligns every allocation to `Alignment` bytes, e.g. for
+// float streams consumed by SIMD loads.
+template<typename T, size_t Alignment = alignof(T)>
+class AlignedAllocator {
+    static_assert(Alignment >= alignof(T), "Alignment must satisfy alignof(T)");
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t(Alignment));
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    template<typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
 }} // namespace GameEngine::Core
\ No newline at end of file
@@ -0,0 +1,146 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Engine allocators feed MemoryTracker only when built with
+// GE_MEMORY_TRACKING=1 (CMake option GAMEENGINE_MEMORY_TRACKING). Otherwise
+// their hooks are compiled out and they hold no tracker at all, so the
+// allocation path is exactly the untracked one. The macro changes class
+// layouts and must be the same in every translation unit.
+#ifndef GE_MEMORY_TRACKING
+#define GE_MEMORY_TRACKING 0
+#endif
+
+namespace GameEngine {
+namespace Core {
+
+// Snapshot of one tracked allocator
+struct MemoryStats {
+    std::string tag;
+    size_t bytesInUse = 0;       // Bytes handed out, including rounding and padding
+    size_t requestedBytes = 0;   // Bytes callers asked for
+    size_t peakBytes = 0;        // Peak bytesInUse
+    size_t reservedBytes = 0;    // Memory the allocator holds, in use or not
+    size_t liveAllocations = 0;
+    size_t totalAllocations = 0;
+    size_t totalFrees = 0;
+    // Activity between the last two MemoryTracker::BeginFrame() calls
+    size_t allocationsLastFrame = 0;
+    size_t bytesAllocatedLastFrame = 0;
+
+    // Share of in-use bytes lost to size-class rounding and alignment padding
+    double InternalFragmentation() const;
+    // Share of reserved bytes currently handed out
+    double Utilization() const;
+};
+
+// Counters for one allocator, registered with MemoryTracker for its
+// lifetime. Hooks are lock-free and may be called from any thread.
+class AllocationTracker {
+public:
+    // Called when a snapshot is taken; must be safe to call from any thread
+    using ReservedBytesFn = size_t (*)(const void* owner);
+
+    // `reportsLeaks` is false for arenas, which release everything when
+    // destroyed and so never leak
+    AllocationTracker(std::string tag, ReservedBytesFn reservedBytes, const void* owner, bool reportsLeaks = true);
+    ~AllocationTracker();
+
+    AllocationTracker(const AllocationTracker&) = delete;
+    AllocationTracker& operator=(const AllocationTracker&) = delete;
+
+    void OnAllocate(size_t bytes, size_t requested) noexcept {
+        const size_t inUse = bytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        requestedBytes.fetch_add(requested, std::memory_order_relaxed);
+        liveAllocations.fetch_add(1, std::memory_order_relaxed);
+        totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        totalBytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+        size_t peak = peakBytes.load(std::memory_order_relaxed);
+        while (inUse > peak && !peakBytes.compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) {
+        }
+    }
+
+    void OnFree(size_t bytes, size_t requested) noexcept {
+        bytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+        requestedBytes.fetch_sub(requested, std::memory_order_relaxed);
+        liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+        totalFrees.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Arena rewind: everything past `newBytesInUse` was released at once.
+    // Requested bytes are clamped, as the arena does not know them per
+    // allocation; the live count drops to zero only on a full reset.
+    void OnRewind(size_t newBytesInUse) noexcept;
+
+    const std::string& Tag() const { return tag; }
+    MemoryStats Snapshot() const;
+
+private:
+    friend class MemoryTracker;
+
+    std::string tag;
+    ReservedBytesFn reservedBytes;
+    const void* owner;
+    bool reportsLeaks;
+
+    std::atomic<size_t> bytesInUse{0};
+    std::atomic<size_t> requestedBytes{0};
+    std::atomic<size_t> peakBytes{0};
+    std::atomic<size_t> liveAllocations{0};
+    std::atomic<size_t> totalAllocations{0};
+    std::atomic<size_t> totalFrees{0};
+    std::atomic<size_t> totalBytesAllocated{0};
+
+    // Written by MemoryTracker::BeginFrame()
+    std::atomic<size_t> frameStartAllocations{0};
+    std::atomic<size_t> frameStartBytes{0};
+    std::atomic<size_t> lastFrameAllocations{0};
+    std::atomic<size_t> lastFrameBytes{0};
+};
+
+// Process-wide registry of tracked allocators. Queryable at runtime,
+// dumpable to a file, and keeps a record of every allocator destroyed
+// with live allocations for the leak report at shutdown.
+class MemoryTracker {
+public:
+    static MemoryTracker& GetInstance();
+
+    MemoryTracker(const MemoryTracker&) = delete;
+    MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+    // Call once per frame; closes the per-frame allocation counters
+    void BeginFrame();
+
+    std::vector<MemoryStats> Snapshot() const;
+    // First live allocator registered under `tag`
+    std::optional<MemoryStats> Query(const std::string& tag) const;
+    size_t TotalBytesInUse() const;
+
+    // Live allocators that still have allocations out, followed by the
+    // ones destroyed with allocations out
+    std::vector<MemoryStats> Leaks() const;
+
+    void WriteReport(std::ostream& out) const;
+    bool DumpToFile(const std::string& filepath) const;
+    // Writes one line per leak; returns the number of leaks
+    size_t ReportLeaks(std::ostream& out) const;
+
+private:
+    friend class AllocationTracker;
+
+    MemoryTracker() = default;
+
+    void Register(AllocationTracker* tracker);
+    void Unregister(AllocationTracker* tracker);
+
+    mutable std::mutex mutex;
+    std::vector<AllocationTracker*> trackers;
+    std::vector<MemoryStats> destroyedLeaks;
+};
+
+}} // namespace GameEngine::Core
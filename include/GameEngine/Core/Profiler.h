@@ -0,0 +1,171 @@
+#pragma once
+#include "GameEngine/Core/BinaryLog.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Instrumentation macros expand to code only when built with GE_PROFILER=1
+// (CMake option GAMEENGINE_PROFILER). With 0 they compile to nothing and
+// their arguments are never evaluated. Unlike GE_MEMORY_TRACKING it changes
+// no layouts, so it only needs to be consistent within a translation unit.
+#ifndef GE_PROFILER
+#define GE_PROFILER 1
+#endif
+
+namespace GameEngine {
+namespace Core {
+
+namespace Detail {
+
+// One recorded event. Fields are relaxed atomics so an export can read a
+// ring while its thread keeps writing; on x86 they are plain moves.
+struct ProfileEvent {
+    enum Kind : uint64_t { Zone, Counter, Frame };
+
+    std::atomic<uint64_t> kind;
+    std::atomic<const char*> name;
+    std::atomic<uint64_t> begin;   // ReadTimestamp() ticks
+    std::atomic<uint64_t> end;     // Zone end ticks, counter value bits or frame number
+};
+
+// Events of one thread, overwriting the oldest once full. Only the owning
+// thread writes.
+struct ProfileThreadBuffer {
+    static constexpr size_t kCapacity = size_t(1) << 16;
+    static constexpr size_t kMask = kCapacity - 1;
+
+    void Push(uint64_t kind, const char* name, uint64_t begin, uint64_t end) {
+        const uint64_t index = head.load(std::memory_order_relaxed);
+        ProfileEvent& event = events[index & kMask];
+        event.kind.store(kind, std::memory_order_relaxed);
+        event.name.store(name, std::memory_order_relaxed);
+        event.begin.store(begin, std::memory_order_relaxed);
+        event.end.store(end, std::memory_order_relaxed);
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    std::atomic<uint64_t> head{0};   // Events ever pushed
+    uint32_t threadId = 0;
+    std::string threadName;          // Guarded by the profiler's registry mutex
+    bool retired = false;            // Owning thread exited; reusable
+    ProfileEvent events[kCapacity];
+};
+
+inline thread_local ProfileThreadBuffer* currentProfileBuffer = nullptr;
+
+// Registers a buffer for the calling thread (slow path of the first event)
+ProfileThreadBuffer* AcquireProfileBuffer();
+
+inline ProfileThreadBuffer& CurrentProfileBuffer() {
+    ProfileThreadBuffer* buffer = currentProfileBuffer;
+    return buffer != nullptr ? *buffer : *AcquireProfileBuffer();
+}
+
+} // namespace Detail
+
+// Frame profiler. Zones, counters and frame markers are appended to a
+// ring buffer of the calling thread with no locking, stamped with
+// BinaryLog::ReadTimestamp() (the TSC on x86). Exports read all rings and
+// convert ticks to time, so they may run while other threads record.
+//
+// Names are stored as pointers and must outlive the export: use string
+// literals, or InternName() for runtime strings.
+class Profiler {
+public:
+    // Aggregate of one zone name over a frame
+    struct ZoneStats {
+        std::string name;
+        uint32_t calls = 0;
+        double totalMs = 0.0;   // Summed over calls and threads
+        double maxMs = 0.0;     // Longest single call
+    };
+
+    struct FrameSummary {
+        uint64_t frame = 0;             // Number of the frame's closing FrameMark()
+        double frameMs = 0.0;           // Stays empty until two frames were marked
+        std::vector<ZoneStats> zones;   // By totalMs, descending
+
+        // One line per zone, for logs and the console
+        std::string ToString() const;
+    };
+
+    // Recording is off until enabled; a disabled zone costs one relaxed
+    // load and a branch
+    static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+    static void SetEnabled(bool enable) { enabled.store(enable, std::memory_order_relaxed); }
+
+    static void RecordZone(const char* name, uint64_t begin, uint64_t end) {
+        Detail::CurrentProfileBuffer().Push(Detail::ProfileEvent::Zone, name, begin, end);
+    }
+    static void RecordCounter(const char* name, double value);
+    // Ends the current frame; call once per frame from the main thread
+    static void FrameMark();
+    // Label for the calling thread in exported traces
+    static void SetThreadName(std::string name);
+    // Stable copy of a runtime string to use as a zone or counter name
+    static const char* InternName(std::string_view name);
+
+    // Zones that ended within the last complete frame
+    static FrameSummary SummarizeLastFrame();
+
+    // Everything still in the rings as Chrome trace event JSON, loadable
+    // in chrome://tracing and ui.perfetto.dev
+    static void WriteChromeTrace(std::ostream& out);
+    static bool WriteChromeTrace(const std::string& path, std::string* error = nullptr);
+
+    // Drops all recorded events and frames
+    static void Clear();
+
+private:
+    static inline std::atomic<bool> enabled{false};
+};
+
+// Times its enclosing scope; see PROFILE_SCOPE
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name_)
+        : name(name_), begin(Profiler::IsEnabled() ? BinaryLog::ReadTimestamp() : 0) {}
+    ~ProfileZone() {
+        if (begin != 0) {
+            Profiler::RecordZone(name, begin, BinaryLog::ReadTimestamp());
+        }
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name;
+    uint64_t begin;
+};
+
+}} // namespace GameEngine::Core
+
+#if GE_PROFILER
+#define GE_PROFILE_CONCAT_INNER(a, b) a##b
+#define GE_PROFILE_CONCAT(a, b) GE_PROFILE_CONCAT_INNER(a, b)
+// Times the rest of the enclosing scope as a zone called `name`
+#define PROFILE_SCOPE(name) ::GameEngine::Core::ProfileZone GE_PROFILE_CONCAT(geProfileZone, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+#define PROFILE_FRAME()                                  \
+    do {                                                 \
+        if (::GameEngine::Core::Profiler::IsEnabled()) { \
+            ::GameEngine::Core::Profiler::FrameMark();   \
+        }                                                \
+    } while (0)
+#define PROFILE_COUNTER(name, value)                                                          \
+    do {                                                                                      \
+        if (::GameEngine::Core::Profiler::IsEnabled()) {                                      \
+            ::GameEngine::Core::Profiler::RecordCounter((name), static_cast<double>(value)); \
+        }                                                                                     \
+    } while (0)
+#else
+#define PROFILE_SCOPE(name) static_cast<void>(sizeof(name))
+#define PROFILE_FUNCTION() static_cast<void>(0)
+#define PROFILE_FRAME() static_cast<void>(0)
+#define PROFILE_COUNTER(name, value) static_cast<void>(sizeof(name) + sizeof(value))
+#endif
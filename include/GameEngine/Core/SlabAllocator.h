@@ -0,0 +1,84 @@
+#pragma once
+#include "GameEngine/Core/MemoryTracker.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace GameEngine {
+namespace Core {
+
+// General-purpose allocator for mixed-size engine allocations. Requests
+// of up to kMaxSmallSize bytes are rounded up to one of kSizeClassCount
+// size classes (16-byte steps up to 128, then four classes per power of
+// two) and served from a GrowableMemoryPool per class, so the common path
+// is a pop from the calling thread's cache with no lock. Larger requests,
+// and alignments above kSmallAlignment, go to aligned ::operator new.
+//
+// Deallocation is sized: pass the size and alignment used to allocate.
+// Thread-safe; memory may be freed on any thread. Slabs are kept until the
+// allocator is destroyed. An allocator constructed with a tag reports to
+// MemoryTracker in tracking builds, with requested versus size-class bytes
+// as its internal fragmentation.
+class SlabAllocator : public std::pmr::memory_resource {
+public:
+    static constexpr size_t kMaxSmallSize = 4096;
+    static constexpr size_t kSmallAlignment = 16;
+    static constexpr size_t kSizeClassCount = 28;
+
+    SlabAllocator();
+    explicit SlabAllocator(const char* tag);
+    ~SlabAllocator() override;
+
+    SlabAllocator(const SlabAllocator&) = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+    // Throws std::bad_alloc like operator new; `alignment` must be a power of two
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    void Deallocate(void* ptr, size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template<typename T, typename... Args>
+    T* New(Args&&... args) {
+        void* memory = Allocate(sizeof(T), alignof(T));
+        try {
+            return new(memory) T(std::forward<Args>(args)...);
+        } catch (...) {
+            Deallocate(memory, sizeof(T), alignof(T));
+            throw;
+        }
+    }
+
+    template<typename T>
+    void Delete(T* ptr) {
+        if (ptr == nullptr) return;
+        ptr->~T();
+        Deallocate(ptr, sizeof(T), alignof(T));
+    }
+
+    // Size class serving `size` bytes (size <= kMaxSmallSize), and the
+    // number of bytes a block of that class holds
+    static size_t SizeClassIndex(size_t size);
+    static size_t SizeClassSize(size_t index);
+
+    // Bytes handed out and not yet freed, counting small allocations at
+    // their size-class size. Exact when no other thread is allocating.
+    size_t UsedBytes() const;
+    size_t LargeAllocationCount() const { return largeCount.load(std::memory_order_relaxed); }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    struct ClassPools;
+    std::unique_ptr<ClassPools> pools;
+    std::atomic<size_t> largeBytes{0};
+    std::atomic<size_t> largeCount{0};
+#if GE_MEMORY_TRACKING
+    std::unique_ptr<AllocationTracker> tracker;
+#endif
+};
+
+}} // namespace GameEngine::Core
@@ -0,0 +1,179 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace GameEngine {
+namespace Core {
+
+// Container addressed by 32-bit generational handles. Values are stored
+// densely in one array, so iterating all live objects is a linear walk;
+// Insert, Erase and Get are O(1).
+//
+// A handle packs a slot index (low kIndexBits) and the slot's generation.
+// Erasing bumps the generation, so Get() on a handle to an erased object
+// returns nullptr instead of aliasing whatever reuses the slot. A slot
+// whose generation would wrap is retired rather than reused, so a stale
+// handle can never become valid again. Freed slots are reused oldest
+// first to spread generations out.
+//
+// Erase moves the last value into the hole: iteration order is not
+// stable and T* / iterators are invalidated by Insert and Erase. Hold
+// handles, not pointers.
+template<typename T>
+class SlotMap {
+public:
+    static constexpr uint32_t kIndexBits = 20;
+    static constexpr uint32_t kMaxSlots = (1u << kIndexBits) - 1;
+
+    class Handle {
+    public:
+        Handle() = default;
+
+        uint32_t Index() const { return value & kIndexMask; }
+        uint32_t Generation() const { return value >> kIndexBits; }
+        uint32_t Value() const { return value; }
+        // Default-constructed handles never refer to a live object
+        bool IsNull() const { return value == 0; }
+
+        bool operator==(const Handle& other) const { return value == other.value; }
+        bool operator!=(const Handle& other) const { return value != other.value; }
+
+    private:
+        friend class SlotMap;
+        Handle(uint32_t index, uint32_t generation) : value(index | (generation << kIndexBits)) {}
+
+        uint32_t value = 0;
+    };
+
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    SlotMap() = default;
+
+    // Returns a null handle when all kMaxSlots slots are in use or retired
+    Handle Insert(const T& value) { return Emplace(value); }
+    Handle Insert(T&& value) { return Emplace(std::move(value)); }
+
+    template<typename... Args>
+    Handle Emplace(Args&&... args) {
+        uint32_t slotIndex;
+        if (freeHead != kNoSlot) {
+            slotIndex = freeHead;
+            freeHead = slots[slotIndex].link;
+            if (freeHead == kNoSlot) {
+                freeTail = kNoSlot;
+            }
+        } else if (slots.size() < kMaxSlots) {
+            slotIndex = static_cast<uint32_t>(slots.size());
+            slots.push_back({0, 1});
+        } else {
+            return Handle();
+        }
+
+        values.emplace_back(std::forward<Args>(args)...);
+        slotOfDense.push_back(slotIndex);
+        slots[slotIndex].link = static_cast<uint32_t>(values.size() - 1);
+        return Handle(slotIndex, slots[slotIndex].generation);
+    }
+
+    // Returns false if the handle is stale or null
+    bool Erase(Handle handle) {
+        if (!Contains(handle)) {
+            return false;
+        }
+        const uint32_t slotIndex = handle.Index();
+        const uint32_t dense = slots[slotIndex].link;
+        const uint32_t last = static_cast<uint32_t>(values.size() - 1);
+        if (dense != last) {
+            values[dense] = std::move(values[last]);
+            slotOfDense[dense] = slotOfDense[last];
+            slots[slotOfDense[dense]].link = dense;
+        }
+        values.pop_back();
+        slotOfDense.pop_back();
+        ReleaseSlot(slotIndex);
+        return true;
+    }
+
+    bool Contains(Handle handle) const {
+        const uint32_t slotIndex = handle.Index();
+        return slotIndex < slots.size() && slots[slotIndex].generation == handle.Generation() &&
+               slots[slotIndex].generation != kRetiredGeneration;
+    }
+
+    // nullptr if the handle is stale or null
+    T* Get(Handle handle) { return Contains(handle) ? &values[slots[handle.Index()].link] : nullptr; }
+    const T* Get(Handle handle) const { return Contains(handle) ? &values[slots[handle.Index()].link] : nullptr; }
+
+    // Erases every value; all outstanding handles become stale
+    void Clear() {
+        for (uint32_t slotIndex : slotOfDense) {
+            ReleaseSlot(slotIndex);
+        }
+        values.clear();
+        slotOfDense.clear();
+    }
+
+    void Reserve(size_t count) {
+        values.reserve(count);
+        slotOfDense.reserve(count);
+        slots.reserve(count);
+    }
+
+    size_t Size() const { return values.size(); }
+    bool Empty() const { return values.empty(); }
+
+    // Dense view: index i of Data() belongs to HandleAt(i)
+    T* Data() { return values.data(); }
+    const T* Data() const { return values.data(); }
+    Handle HandleAt(size_t denseIndex) const {
+        const uint32_t slotIndex = slotOfDense[denseIndex];
+        return Handle(slotIndex, slots[slotIndex].generation);
+    }
+
+    iterator begin() { return values.begin(); }
+    iterator end() { return values.end(); }
+    const_iterator begin() const { return values.begin(); }
+    const_iterator end() const { return values.end(); }
+
+private:
+    static constexpr uint32_t kIndexMask = kMaxSlots;
+    static constexpr uint32_t kMaxGeneration = (1u << (32 - kIndexBits)) - 1;
+    // Generation of a retired slot; no live handle carries it
+    static constexpr uint32_t kRetiredGeneration = 0;
+    static constexpr uint32_t kNoSlot = ~0u;
+
+    struct Slot {
+        uint32_t link;        // Dense index while live, next free slot while free
+        uint32_t generation;  // Generation of the live value or of the next one
+    };
+
+    void ReleaseSlot(uint32_t slotIndex) {
+        Slot& slot = slots[slotIndex];
+        if (slot.generation == kMaxGeneration) {
+            // Retired: reusing it would bring old handles back to life
+            slot.generation = kRetiredGeneration;
+            return;
+        }
+        // Bumped now rather than on reuse, so handles to the erased value
+        // already mismatch while the slot sits in the free list
+        ++slot.generation;
+        slot.link = kNoSlot;
+        if (freeTail == kNoSlot) {
+            freeHead = slotIndex;
+        } else {
+            slots[freeTail].link = slotIndex;
+        }
+        freeTail = slotIndex;
+    }
+
+    std::vector<T> values;
+    std::vector<uint32_t> slotOfDense;
+    std::vector<Slot> slots;
+    uint32_t freeHead = kNoSlot;
+    uint32_t freeTail = kNoSlot;
+};
+
+}} // namespace GameEngine::Core
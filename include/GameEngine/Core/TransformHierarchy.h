@@ -0,0 +1,109 @@
+#pragma once
+#include "GameEngine/Core/Math.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GameEngine {
+namespace Math {
+
+// Parent/child transform tree. Nodes live in depth-first order in
+// parallel arrays, so every subtree is one contiguous index range and a
+// parent always precedes its children: world transforms are rebuilt with
+// a linear pass over only the dirty subtrees, and a frame with no changes
+// costs one empty-vector check.
+//
+// NodeIds are stable across structural edits (ids of destroyed nodes are
+// reused). Creating, destroying or reparenting nodes shifts the arrays and
+// is O(nodes after the insertion point); appending whole trees in
+// depth-first order, as scene loading does, is O(depth) per node.
+class TransformHierarchy {
+public:
+    using NodeId = uint32_t;
+    static constexpr NodeId kInvalidNode = ~0u;
+    // Subtrees at most this large are never split across tasks
+    static constexpr size_t kDefaultMinTaskSize = 256;
+
+    TransformHierarchy() = default;
+
+    // Returns kInvalidNode if `parent` is neither kInvalidNode nor a live node
+    NodeId CreateNode(NodeId parent = kInvalidNode, const AffineTransform& local = AffineTransform());
+    // Destroys the node and its whole subtree
+    void DestroyNode(NodeId id);
+    // Moves the subtree under `newParent` (kInvalidNode makes it a root).
+    // Returns false if `newParent` is invalid or inside the subtree.
+    bool SetParent(NodeId id, NodeId newParent);
+    void Clear();
+
+    bool IsValid(NodeId id) const { return id < idToIndex.size() && idToIndex[id] != kNoIndex; }
+    size_t Size() const { return nodeIds.size(); }
+    bool Empty() const { return nodeIds.empty(); }
+    NodeId GetParent(NodeId id) const;
+
+    void SetLocalTransform(NodeId id, const AffineTransform& local);
+    void SetLocalTRS(NodeId id, const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+    const AffineTransform& GetLocalTransform(NodeId id) const;
+    // World transform as of the last UpdateWorldTransforms()
+    const AffineTransform& GetWorldTransform(NodeId id) const;
+
+    bool HasPendingUpdates() const { return !dirtyRoots.empty(); }
+
+    void UpdateWorldTransforms();
+
+    // Same result as UpdateWorldTransforms(), with independent subtrees
+    // handed out as tasks. `parallelFor(count, task)` must call task(i)
+    // for every i in [0, count), in any order and on any threads, and
+    // return once all calls have finished. Dirty subtrees larger than
+    // `minTaskSize` are split at their root into per-child tasks.
+    template<typename ParallelFor>
+    void UpdateWorldTransforms(ParallelFor&& parallelFor, size_t minTaskSize = kDefaultMinTaskSize) {
+        CollectDirtyRanges(minTaskSize);
+        if (!tasks.empty()) {
+            parallelFor(tasks.size(), [this](size_t task) { UpdateRange(tasks[task]); });
+        }
+    }
+
+    // Nodes recomputed by the last update (0 for an unchanged scene)
+    size_t GetLastUpdateCount() const { return lastUpdateCount; }
+
+    // Depth-first views: index i of both belongs to GetNodeAt(i)
+    const std::vector<AffineTransform>& GetWorldTransforms() const { return worldTransforms; }
+    NodeId GetNodeAt(size_t index) const { return nodeIds[index]; }
+    size_t GetIndex(NodeId id) const;
+
+private:
+    static constexpr uint32_t kNoIndex = ~0u;
+
+    struct Range {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    void MarkDirty(uint32_t index);
+    // Inserts `count` nodes at `position` as a subtree of `parentIndex`.
+    // relativeParents/relativeEnds are offsets within the block; entry 0
+    // is the block root.
+    void InsertNodes(uint32_t position, uint32_t parentIndex, const NodeId* ids, const AffineTransform* locals,
+                     const uint32_t* relativeParents, const uint32_t* relativeEnds, uint32_t count);
+    void EraseNodes(uint32_t begin, uint32_t end);
+    void CollectDirtyRanges(size_t minTaskSize);
+    void UpdateNode(uint32_t index);
+    void UpdateRange(Range range);
+
+    std::vector<AffineTransform> localTransforms;
+    std::vector<AffineTransform> worldTransforms;
+    std::vector<uint32_t> parents;      // kNoIndex for roots
+    std::vector<uint32_t> subtreeEnds;  // one past the last descendant
+    std::vector<NodeId> nodeIds;
+    std::vector<uint8_t> dirtyFlags;
+
+    std::vector<uint32_t> idToIndex;
+    std::vector<NodeId> freeIds;
+
+    std::vector<NodeId> dirtyRoots;
+    std::vector<Range> tasks;
+    std::vector<uint32_t> scratchIndices;
+    size_t lastUpdateCount = 0;
+};
+
+}} // namespace GameEngine::Math
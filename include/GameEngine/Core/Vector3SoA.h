@@ -0,0 +1,58 @@
+#pragma once
+#include "GameEngine/Core/Math.h"
+#include "GameEngine/Core/Memory.h"
+#include <vector>
+#include <cstddef>
+
+namespace GameEngine {
+namespace Math {
+
+// Structure-of-arrays container for many Vector3s. The x, y and z
+// components live in separate 32-byte aligned streams so bulk operations
+// process 4-8 vectors per instruction instead of one.
+class Vector3SoA {
+public:
+    using Stream = std::vector<float, Core::AlignedAllocator<float, 32>>;
+
+    Vector3SoA() = default;
+    explicit Vector3SoA(size_t count);
+    explicit Vector3SoA(const std::vector<Vector3>& vectors);
+
+    size_t Size() const { return xs.size(); }
+    bool Empty() const { return xs.empty(); }
+    void Resize(size_t count);
+    void Reserve(size_t count);
+    void Clear();
+    void PushBack(const Vector3& v);
+
+    Vector3 Get(size_t index) const { return Vector3(xs[index], ys[index], zs[index]); }
+    void Set(size_t index, const Vector3& v);
+
+    float* X() { return xs.data(); }
+    float* Y() { return ys.data(); }
+    float* Z() { return zs.data(); }
+    const float* X() const { return xs.data(); }
+    const float* Y() const { return ys.data(); }
+    const float* Z() const { return zs.data(); }
+
+    // Conversion from/to array-of-structures storage
+    void FromAoS(const Vector3* vectors, size_t count);
+    void ToAoS(Vector3* out) const;
+    std::vector<Vector3> ToAoS() const;
+
+    // Bulk operations. Operands must have the same Size() and may be
+    // *this; `out` containers are resized and must not be one of the
+    // operands.
+    void Add(const Vector3SoA& other);                        // this += other
+    void Scale(float scalar);                                 // this *= scalar
+    void MultiplyAdd(const Vector3SoA& other, float scalar);  // this += other * scalar
+    void Dot(const Vector3SoA& other, float* out) const;
+    void Cross(const Vector3SoA& other, Vector3SoA& out) const;
+    void Length(float* out) const;
+    void Normalize(); // Zero-length vectors stay zero, as in Vector3::Normalized
+
+private:
+    Stream xs, ys, zs;
+};
+
+}} // namespace GameEngine::Math
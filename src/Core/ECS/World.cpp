@@ -0,0 +1,385 @@
+#include "GameEngine/Core/ECS.h"
+#include "GameEngine/Core/Profiler.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace GameEngine {
+namespace Core {
+
+namespace Detail {
+
+namespace {
+
+// Entries are written before their id is handed out and never change,
+// so lookups need no lock
+struct ComponentRegistry {
+    std::mutex mutex;
+    size_t count = 0;
+    ComponentInfo infos[kMaxComponentTypes];
+};
+
+ComponentRegistry& Registry() {
+    static ComponentRegistry registry;
+    return registry;
+}
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+// Limits that would otherwise corrupt memory; checked in every build type
+[[noreturn]] void Fatal(const char* message) {
+    std::fprintf(stderr, "ECS: %s\n", message);
+    std::abort();
+}
+
+ComponentId RegisterComponent(const ComponentInfo& info) {
+    ComponentRegistry& registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (registry.count >= kMaxComponentTypes) {
+        Fatal("more than kMaxComponentTypes component types registered");
+    }
+    if (info.alignment > kColumnAlignment) {
+        Fatal("component alignment exceeds the chunk column alignment");
+    }
+    registry.infos[registry.count] = info;
+    return static_cast<ComponentId>(registry.count++);
+}
+
+const ComponentInfo& GetComponentInfo(ComponentId id) {
+    return Registry().infos[id];
+}
+
+} // namespace Detail
+
+namespace {
+
+unsigned char* AllocateChunk() {
+    return static_cast<unsigned char*>(
+        ::operator new(Detail::kChunkBytes, std::align_val_t(Detail::kColumnAlignment)));
+}
+
+void FreeChunk(unsigned char* data) {
+    ::operator delete(data, std::align_val_t(Detail::kColumnAlignment));
+}
+
+// Bytes a chunk of `capacity` rows needs with every column aligned
+size_t ChunkLayoutBytes(size_t capacity, const std::vector<Detail::ComponentInfo>& infos) {
+    size_t offset = capacity * sizeof(Entity);
+    for (const Detail::ComponentInfo& info : infos) {
+        offset = Detail::AlignUp(offset, Detail::kColumnAlignment) + capacity * info.size;
+    }
+    return offset;
+}
+
+} // namespace
+
+World::~World() {
+    for (const auto& archetype : archetypes) {
+        for (const Detail::Chunk& chunk : archetype->chunks) {
+            FreeChunk(chunk.data);
+        }
+    }
+    for (unsigned char* data : freeChunks) {
+        FreeChunk(data);
+    }
+}
+
+uint32_t World::FindOrCreateArchetype(ComponentMask mask) {
+    const auto found = archetypeByMask.find(mask);
+    if (found != archetypeByMask.end()) {
+        return found->second;
+    }
+
+    auto archetype = std::make_unique<Detail::Archetype>();
+    archetype->mask = mask;
+    std::vector<Detail::ComponentInfo> infos;
+    size_t rowBytes = sizeof(Entity);
+    for (ComponentId id = 0; id < kMaxComponentTypes; ++id) {
+        if ((mask & (ComponentMask(1) << id)) != 0) {
+            archetype->components.push_back(id);
+            infos.push_back(Detail::GetComponentInfo(id));
+            rowBytes += infos.back().size;
+        }
+    }
+
+    // As many rows as fit once each column is padded to its alignment
+    size_t capacity = Detail::kChunkBytes / rowBytes;
+    while (capacity > 1 && ChunkLayoutBytes(capacity, infos) > Detail::kChunkBytes) {
+        --capacity;
+    }
+    if (capacity == 0 || ChunkLayoutBytes(capacity, infos) > Detail::kChunkBytes) {
+        Detail::Fatal("archetype row too large for a chunk");
+    }
+    archetype->capacity = static_cast<uint32_t>(capacity);
+
+    size_t offset = capacity * sizeof(Entity);
+    for (size_t i = 0; i < infos.size(); ++i) {
+        offset = Detail::AlignUp(offset, Detail::kColumnAlignment);
+        archetype->columnOffset[archetype->components[i]] = static_cast<uint32_t>(offset);
+        offset += capacity * infos[i].size;
+    }
+
+    const uint32_t index = static_cast<uint32_t>(archetypes.size());
+    archetypes.push_back(std::move(archetype));
+    archetypeByMask.emplace(mask, index);
+    return index;
+}
+
+Detail::EntityRecord World::AppendRow(uint32_t archetypeIndex, Entity entity) {
+    Detail::Archetype& archetype = *archetypes[archetypeIndex];
+    if (archetype.chunks.empty() || archetype.chunks.back().count == archetype.capacity) {
+        unsigned char* data;
+        if (!freeChunks.empty()) {
+            data = freeChunks.back();
+            freeChunks.pop_back();
+        } else {
+            data = AllocateChunk();
+        }
+        archetype.chunks.push_back(Detail::Chunk{data, 0});
+    }
+    Detail::Chunk& chunk = archetype.chunks.back();
+    const uint32_t row = chunk.count++;
+    archetype.Entities(chunk)[row] = entity;
+    ++archetype.entityCount;
+    return Detail::EntityRecord{archetypeIndex, static_cast<uint32_t>(archetype.chunks.size() - 1), row};
+}
+
+void World::RemoveRow(const Detail::EntityRecord& location) {
+    Detail::Archetype& archetype = *archetypes[location.archetype];
+    Detail::Chunk& chunk = archetype.chunks[location.chunk];
+    Detail::Chunk& last = archetype.chunks.back();
+    const uint32_t lastRow = last.count - 1;
+
+    if (&chunk != &last || location.row != lastRow) {
+        const Entity moved = archetype.Entities(last)[lastRow];
+        archetype.Entities(chunk)[location.row] = moved;
+        for (ComponentId id : archetype.components) {
+            const size_t size = Detail::GetComponentInfo(id).size;
+            std::memcpy(static_cast<unsigned char*>(archetype.Column(chunk, id)) + location.row * size,
+                        static_cast<unsigned char*>(archetype.Column(last, id)) + lastRow * size, size);
+        }
+        Detail::EntityRecord* movedRecord = records.Get(moved);
+        movedRecord->chunk = location.chunk;
+        movedRecord->row = location.row;
+    }
+
+    --archetype.entityCount;
+    if (--last.count == 0) {
+        freeChunks.push_back(last.data);
+        archetype.chunks.pop_back();
+    }
+}
+
+void World::MoveEntity(Detail::EntityRecord& record, uint32_t targetArchetype) {
+    const Detail::EntityRecord source = record;
+    const Detail::Archetype& from = *archetypes[source.archetype];
+    const Detail::Chunk& fromChunk = from.chunks[source.chunk];
+    const Detail::EntityRecord target = AppendRow(targetArchetype, from.Entities(fromChunk)[source.row]);
+
+    const Detail::Archetype& to = *archetypes[targetArchetype];
+    const Detail::Chunk& toChunk = to.chunks[target.chunk];
+    for (ComponentId id : to.components) {
+        if ((from.mask & (ComponentMask(1) << id)) == 0) {
+            continue;
+        }
+        const size_t size = Detail::GetComponentInfo(id).size;
+        std::memcpy(static_cast<unsigned char*>(to.Column(toChunk, id)) + target.row * size,
+                    static_cast<unsigned char*>(from.Column(fromChunk, id)) + source.row * size, size);
+    }
+    RemoveRow(source);
+    record = target;
+}
+
+Entity World::CreateEntityRaw(ComponentMask mask, const ComponentId* ids, const void* const* values, size_t count) {
+    const Entity entity = records.Insert(Detail::EntityRecord{0, 0, 0});
+    if (entity.IsNull()) {
+        return entity;
+    }
+    const Detail::EntityRecord location = AppendRow(FindOrCreateArchetype(mask), entity);
+    *records.Get(entity) = location;
+
+    const Detail::Archetype& archetype = *archetypes[location.archetype];
+    const Detail::Chunk& chunk = archetype.chunks[location.chunk];
+    for (size_t i = 0; i < count; ++i) {
+        const size_t size = Detail::GetComponentInfo(ids[i]).size;
+        std::memcpy(static_cast<unsigned char*>(archetype.Column(chunk, ids[i])) + location.row * size, values[i],
+                    size);
+    }
+    return entity;
+}
+
+bool World::DestroyEntity(Entity entity) {
+    const Detail::EntityRecord* record = records.Get(entity);
+    if (record == nullptr) {
+        return false;
+    }
+    RemoveRow(*record);
+    records.Erase(entity);
+    return true;
+}
+
+void* World::GetRaw(Entity entity, ComponentId id) {
+    const Detail::EntityRecord* record = records.Get(entity);
+    if (record == nullptr) {
+        return nullptr;
+    }
+    const Detail::Archetype& archetype = *archetypes[record->archetype];
+    if ((archetype.mask & (ComponentMask(1) << id)) == 0) {
+        return nullptr;
+    }
+    return static_cast<unsigned char*>(archetype.Column(archetype.chunks[record->chunk], id)) +
+           record->row * Detail::GetComponentInfo(id).size;
+}
+
+bool World::AddRaw(Entity entity, ComponentId id, const void* value) {
+    Detail::EntityRecord* record = records.Get(entity);
+    if (record == nullptr) {
+        return false;
+    }
+    const ComponentMask mask = archetypes[record->archetype]->mask;
+    const ComponentMask bit = ComponentMask(1) << id;
+    if ((mask & bit) == 0) {
+        MoveEntity(*record, FindOrCreateArchetype(mask | bit));
+    }
+    std::memcpy(GetRaw(entity, id), value, Detail::GetComponentInfo(id).size);
+    return true;
+}
+
+bool World::RemoveRaw(Entity entity, ComponentId id) {
+    Detail::EntityRecord* record = records.Get(entity);
+    if (record == nullptr) {
+        return false;
+    }
+    const ComponentMask mask = archetypes[record->archetype]->mask;
+    const ComponentMask bit = ComponentMask(1) << id;
+    if ((mask & bit) != 0) {
+        MoveEntity(*record, FindOrCreateArchetype(mask & ~bit));
+    }
+    return true;
+}
+
+void World::CollectChunks(ComponentMask required, std::vector<ChunkRef>& out) const {
+    for (const auto& archetype : archetypes) {
+        if ((archetype->mask & required) != required) {
+            continue;
+        }
+        for (const Detail::Chunk& chunk : archetype->chunks) {
+            out.push_back(ChunkRef{archetype.get(), &chunk});
+        }
+    }
+}
+
+void CommandBuffer::AppendHeader(Op op, Entity entity, ComponentId component, uint32_t size) {
+    const Header header{op, component, entity, size};
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&header);
+    stream.insert(stream.end(), bytes, bytes + sizeof(header));
+}
+
+void CommandBuffer::AppendComponent(Op op, Entity entity, ComponentId component, const void* value, size_t size) {
+    AppendHeader(op, entity, component, static_cast<uint32_t>(size));
+    const unsigned char* bytes = static_cast<const unsigned char*>(value);
+    stream.insert(stream.end(), bytes, bytes + size);
+}
+
+void CommandBuffer::Playback(World& world) {
+    std::vector<ComponentId> ids;
+    std::vector<const void*> values;
+    size_t position = 0;
+    auto readHeader = [&]() {
+        Header header;
+        std::memcpy(&header, stream.data() + position, sizeof(header));
+        position += sizeof(header);
+        return header;
+    };
+
+    while (position < stream.size()) {
+        const Header header = readHeader();
+        switch (header.op) {
+        case Op::Create: {
+            ids.clear();
+            values.clear();
+            ComponentMask mask = 0;
+            for (uint32_t i = 0; i < header.size; ++i) {
+                const Header component = readHeader();
+                ids.push_back(component.component);
+                values.push_back(stream.data() + position);
+                mask |= ComponentMask(1) << component.component;
+                position += component.size;
+            }
+            world.CreateEntityRaw(mask, ids.data(), values.data(), ids.size());
+            break;
+        }
+        case Op::Destroy:
+            world.DestroyEntity(header.entity);
+            break;
+        case Op::Add:
+            world.AddRaw(header.entity, header.component, stream.data() + position);
+            position += header.size;
+            break;
+        case Op::Remove:
+            world.RemoveRaw(header.entity, header.component);
+            break;
+        default:
+            assert(false && "Corrupt command buffer");
+            position = stream.size();
+            break;
+        }
+    }
+    Clear();
+}
+
+void SystemScheduler::Add(std::string name, ComponentMask reads, ComponentMask writes, SystemFunction system) {
+    size_t stage = 0;
+    for (const System& earlier : systems) {
+        // A kAllComponents writer may change anything structurally, so it
+        // conflicts even with systems that declare no components
+        const bool conflicts = writes == kAllComponents || earlier.writes == kAllComponents ||
+                               (writes & (earlier.reads | earlier.writes)) != 0 || (earlier.writes & reads) != 0;
+        if (conflicts) {
+            stage = std::max(stage, earlier.stage + 1);
+        }
+    }
+    if (stage == stages.size()) {
+        stages.emplace_back();
+    }
+    stages[stage].push_back(systems.size());
+    const char* profileName = Profiler::InternName(name);
+    systems.push_back(
+        System{std::move(name), profileName, reads, writes, std::move(system), stage, CommandBuffer()});
+}
+
+void SystemScheduler::Run(World& world, JobSystem& jobs, float deltaTime) {
+    for (const std::vector<size_t>& stage : stages) {
+        if (stage.size() == 1) {
+            System& system = systems[stage.front()];
+            PROFILE_SCOPE(system.profileName);
+            SystemContext context{world, system.commands, jobs, deltaTime};
+            system.function(context);
+        } else {
+            JobCounter counter;
+            for (size_t index : stage) {
+                System& system = systems[index];
+                jobs.Run([&world, &jobs, &system, deltaTime] {
+                    PROFILE_SCOPE(system.profileName);
+                    SystemContext context{world, system.commands, jobs, deltaTime};
+                    system.function(context);
+                }, &counter);
+            }
+            jobs.Wait(counter);
+        }
+        PROFILE_SCOPE("SystemScheduler::Playback");
+        for (size_t index : stage) {
+            systems[index].commands.Playback(world);
+        }
+    }
+}
+
+} // namespace Core
+} // namespace GameEngine
@@ -0,0 +1,332 @@
+#include "GameEngine/Core/AssetArchive.h"
+#include "Lz4Block.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace GameEngine {
+namespace Core {
+
+namespace AssetPack {
+
+uint64_t HashPath(std::string_view path) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : path) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string NormalizePath(std::string_view path) {
+    std::string normalized(path);
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    size_t start = 0;
+    for (;;) {
+        if (normalized.compare(start, 2, "./") == 0) {
+            start += 2;
+        } else if (normalized.compare(start, 1, "/") == 0) {
+            start += 1;
+        } else {
+            break;
+        }
+    }
+    return normalized.substr(start);
+}
+
+} // namespace AssetPack
+
+using AssetPack::Compression;
+
+namespace {
+
+bool IsPowerOfTwo(uint64_t value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Entries and the hash table are read in place from the mapping
+constexpr uint64_t kTableAlignment = alignof(AssetPack::Entry);
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// AssetArchive
+
+std::shared_ptr<AssetArchive> AssetArchive::Open(const std::string& filepath, std::string* error) {
+    auto fail = [error](const char* message) -> std::shared_ptr<AssetArchive> {
+        if (error) *error = message;
+        return nullptr;
+    };
+
+    // Lookups jump around the index; payloads are read as needed
+    auto mapped = MappedFile::Open(filepath, MappedFile::Access::Random);
+    if (!mapped) {
+        return fail("cannot open archive");
+    }
+    std::shared_ptr<AssetArchive> archive(new AssetArchive());
+    archive->path = filepath;
+    archive->file = std::move(*mapped);
+
+    const char* base = archive->file.Data();
+    const uint64_t fileSize = archive->file.Size();
+    AssetPack::Header& header = archive->header;
+    if (fileSize < sizeof(header)) {
+        return fail("file too short for an archive header");
+    }
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, AssetPack::kMagic, sizeof(AssetPack::kMagic)) != 0) {
+        return fail("not an asset archive (bad magic)");
+    }
+    if (header.version != AssetPack::kVersion) {
+        return fail("unsupported archive version");
+    }
+
+    auto inFile = [fileSize](uint64_t offset, uint64_t size) { return offset <= fileSize && size <= fileSize - offset; };
+    const uint64_t entriesSize = uint64_t(header.entryCount) * sizeof(AssetPack::Entry);
+    const uint64_t hashTableSize = uint64_t(header.hashTableSize) * sizeof(uint32_t);
+    if (!IsPowerOfTwo(header.alignment) || !IsPowerOfTwo(header.hashTableSize) ||
+        header.hashTableSize < uint64_t(header.entryCount) * 2 || header.entriesOffset % kTableAlignment != 0 ||
+        header.hashTableOffset % kTableAlignment != 0 || !inFile(header.entriesOffset, entriesSize) ||
+        !inFile(header.hashTableOffset, hashTableSize) || !inFile(header.stringsOffset, header.stringsSize)) {
+        return fail("corrupt archive index");
+    }
+    archive->entries = reinterpret_cast<const AssetPack::Entry*>(base + header.entriesOffset);
+    archive->hashTable = reinterpret_cast<const uint32_t*>(base + header.hashTableOffset);
+    archive->strings = base + header.stringsOffset;
+
+    // Validate once here so lookups and reads can trust the index
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        const AssetPack::Entry& entry = archive->entries[i];
+        const bool knownCompression = entry.compression == Compression::None || entry.compression == Compression::Lz4;
+        if (!inFile(entry.offset, entry.storedSize) ||
+            uint64_t(entry.pathOffset) + entry.pathLength > header.stringsSize || !knownCompression ||
+            (entry.compression == Compression::None && entry.storedSize != entry.size) ||
+            entry.pathHash != AssetPack::HashPath(archive->EntryPath(entry))) {
+            return fail("corrupt archive entry");
+        }
+    }
+    // Every entry in exactly one bucket. With the table at least twice the
+    // entry count, that leaves empty buckets to end every probe.
+    std::vector<bool> indexed(header.entryCount, false);
+    uint32_t occupied = 0;
+    for (uint32_t i = 0; i < header.hashTableSize; ++i) {
+        const uint32_t index = archive->hashTable[i];
+        if (index == AssetPack::kEmptyBucket) {
+            continue;
+        }
+        if (index >= header.entryCount || indexed[index]) {
+            return fail("corrupt archive hash table");
+        }
+        indexed[index] = true;
+        ++occupied;
+    }
+    if (occupied != header.entryCount) {
+        return fail("corrupt archive hash table");
+    }
+    return archive;
+}
+
+std::string_view AssetArchive::EntryPath(const AssetPack::Entry& entry) const {
+    return std::string_view(strings + entry.pathOffset, entry.pathLength);
+}
+
+const AssetPack::Entry* AssetArchive::Find(std::string_view entryPath) const {
+    const uint64_t hash = AssetPack::HashPath(entryPath);
+    const uint32_t mask = header.hashTableSize - 1;
+    // Open() guarantees an empty bucket; the bound is a second line of defence
+    uint32_t bucket = static_cast<uint32_t>(hash) & mask;
+    for (uint32_t probes = 0; probes < header.hashTableSize; ++probes, bucket = (bucket + 1) & mask) {
+        const uint32_t index = hashTable[bucket];
+        if (index == AssetPack::kEmptyBucket) {
+            return nullptr;
+        }
+        const AssetPack::Entry& entry = entries[index];
+        if (entry.pathHash == hash && EntryPath(entry) == entryPath) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+std::string_view AssetArchive::StoredData(const AssetPack::Entry& entry) const {
+    return std::string_view(file.Data() + entry.offset, static_cast<size_t>(entry.storedSize));
+}
+
+bool AssetArchive::ReadInto(const AssetPack::Entry& entry, char* destination) const {
+    const std::string_view stored = StoredData(entry);
+    if (entry.compression == Compression::None) {
+        std::memcpy(destination, stored.data(), stored.size());
+        return true;
+    }
+    return Detail::Lz4Decompress(stored.data(), stored.size(), destination, static_cast<size_t>(entry.size));
+}
+
+std::optional<MappedFile> AssetArchive::Map(const AssetPack::Entry& entry) const {
+    if (entry.compression == Compression::None) {
+        const std::string_view stored = StoredData(entry);
+        return MappedFile::FromView(stored.data(), stored.size(), shared_from_this());
+    }
+    auto data = Read(entry);
+    if (!data) {
+        return std::nullopt;
+    }
+    return MappedFile::FromBuffer(std::move(*data));
+}
+
+std::optional<std::vector<char>> AssetArchive::Read(const AssetPack::Entry& entry) const {
+    std::vector<char> data(static_cast<size_t>(entry.size));
+    if (!ReadInto(entry, data.data())) {
+        return std::nullopt;
+    }
+    return data;
+}
+
+// ---------------------------------------------------------------------------
+// AssetArchiveBuilder
+
+AssetArchiveBuilder::AssetArchiveBuilder(uint32_t alignment_)
+    : alignment(IsPowerOfTwo(alignment_) ? alignment_ : AssetPack::kDefaultAlignment) {}
+
+void AssetArchiveBuilder::AddData(const std::string& entryPath, std::vector<char> data, Compression compression) {
+    pending[AssetPack::NormalizePath(entryPath)] = Pending{std::string(), std::move(data), compression};
+}
+
+void AssetArchiveBuilder::AddFile(const std::string& entryPath, const std::string& sourceFile,
+                                  Compression compression) {
+    pending[AssetPack::NormalizePath(entryPath)] = Pending{sourceFile, {}, compression};
+}
+
+size_t AssetArchiveBuilder::AddDirectory(const std::string& directory, Compression compression) {
+    namespace fs = std::filesystem;
+    std::error_code error;
+    size_t added = 0;
+    for (fs::recursive_directory_iterator it(directory, error), end; !error && it != end; it.increment(error)) {
+        if (it->is_regular_file(error)) {
+            AddFile(fs::relative(it->path(), directory, error).generic_string(), it->path().string(), compression);
+            ++added;
+        }
+    }
+    return added;
+}
+
+bool AssetArchiveBuilder::Write(const std::string& outputPath, std::string* error) const {
+    auto fail = [error](const std::string& message) {
+        if (error) *error = message;
+        return false;
+    };
+    if (pending.size() > AssetPack::kEmptyBucket / 2) {
+        return fail("too many entries");
+    }
+
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return fail("cannot write " + outputPath);
+    }
+
+    std::vector<AssetPack::Entry> entries;
+    entries.reserve(pending.size());
+    std::string strings;
+    uint64_t offset = 0;
+    std::vector<char> compressed;
+    static const char kPadding[4096] = {};
+    auto pad = [&](uint64_t to) {
+        for (uint64_t gap = to - offset; gap > 0;) {
+            const uint64_t chunk = std::min<uint64_t>(gap, sizeof(kPadding));
+            out.write(kPadding, static_cast<std::streamsize>(chunk));
+            gap -= chunk;
+        }
+        offset = to;
+    };
+    // The header is written last, once the index offsets are known
+    pad(sizeof(AssetPack::Header));
+
+    // Payloads, in path order
+    for (const auto& [entryPath, item] : pending) {
+        std::optional<MappedFile> source;
+        std::string_view data(item.data.data(), item.data.size());
+        if (!item.sourceFile.empty()) {
+            source = MappedFile::Open(item.sourceFile, MappedFile::Access::Sequential);
+            if (!source) {
+                return fail("cannot read " + item.sourceFile);
+            }
+            data = source->View();
+        }
+
+        AssetPack::Entry entry{};
+        entry.pathHash = AssetPack::HashPath(entryPath);
+        entry.size = data.size();
+        entry.pathOffset = static_cast<uint32_t>(strings.size());
+        entry.pathLength = static_cast<uint32_t>(entryPath.size());
+        strings += entryPath;
+
+        const char* stored = data.data();
+        entry.storedSize = data.size();
+        entry.compression = Compression::None;
+        // Positions in the compressor are 32-bit
+        if (item.compression == Compression::Lz4 && !data.empty() && data.size() < (uint64_t(1) << 32)) {
+            compressed.resize(Detail::Lz4CompressBound(data.size()));
+            const size_t size = Detail::Lz4Compress(data.data(), data.size(), compressed.data(), compressed.size());
+            if (size > 0 && size <= data.size() - data.size() / 16) {
+                stored = compressed.data();
+                entry.storedSize = size;
+                entry.compression = Compression::Lz4;
+            }
+        }
+
+        pad(AlignUp(offset, alignment));
+        entry.offset = offset;
+        out.write(stored, static_cast<std::streamsize>(entry.storedSize));
+        offset += entry.storedSize;
+        entries.push_back(entry);
+    }
+
+    AssetPack::Header header{};
+    std::memcpy(header.magic, AssetPack::kMagic, sizeof(header.magic));
+    header.version = AssetPack::kVersion;
+    header.alignment = alignment;
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.hashTableSize = 2;
+    while (header.hashTableSize < header.entryCount * 2) {
+        header.hashTableSize *= 2;
+    }
+
+    std::vector<uint32_t> hashTable(header.hashTableSize, AssetPack::kEmptyBucket);
+    const uint32_t mask = header.hashTableSize - 1;
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        uint32_t bucket = static_cast<uint32_t>(entries[i].pathHash) & mask;
+        while (hashTable[bucket] != AssetPack::kEmptyBucket) {
+            bucket = (bucket + 1) & mask;
+        }
+        hashTable[bucket] = i;
+    }
+
+    pad(AlignUp(offset, kTableAlignment));
+    header.entriesOffset = offset;
+    out.write(reinterpret_cast<const char*>(entries.data()),
+              static_cast<std::streamsize>(entries.size() * sizeof(AssetPack::Entry)));
+    offset += entries.size() * sizeof(AssetPack::Entry);
+    header.hashTableOffset = offset;
+    out.write(reinterpret_cast<const char*>(hashTable.data()),
+              static_cast<std::streamsize>(hashTable.size() * sizeof(uint32_t)));
+    offset += hashTable.size() * sizeof(uint32_t);
+    header.stringsOffset = offset;
+    header.stringsSize = strings.size();
+    out.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), static_cast<std::streamsize>(sizeof(header)));
+    out.close();
+    if (!out) {
+        return fail("error writing " + outputPath);
+    }
+    return true;
+}
+
+} // namespace Core
+} // namespace GameEngine
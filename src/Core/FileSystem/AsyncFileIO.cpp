@@ -0,0 +1,571 @@
+#include "GameEngine/Core/AsyncFileIO.h"
+#include "IoUring.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+#if GE_HAS_IO_URING
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GameEngine {
+namespace Core {
+
+namespace Detail {
+
+struct ReadState {
+    std::string path;
+    uint64_t offset = 0;
+    size_t length = 0;
+    IOPriority priority = IOPriority::Normal;
+    AsyncFileIO::Callback onComplete;
+    AsyncFileIO::Impl* owner = nullptr;
+
+    std::atomic<IOStatus> status{IOStatus::Queued};
+    ReadResult result;
+    std::mutex mutex;
+    std::condition_variable doneSignal;
+    bool done = false;
+
+    // Queued -> InFlight; only one of the I/O thread and Cancel() wins
+    bool Claim() {
+        IOStatus expected = IOStatus::Queued;
+        return status.compare_exchange_strong(expected, IOStatus::InFlight, std::memory_order_acq_rel);
+    }
+};
+
+} // namespace Detail
+
+using Detail::ReadState;
+
+struct AsyncFileIO::Impl {
+    std::mutex mutex;
+    std::condition_variable workAvailable;   // Thread pool backend
+    std::condition_variable idle;
+    // One FIFO per IOPriority
+    std::deque<std::shared_ptr<ReadState>> queues[static_cast<size_t>(IOPriority::High) + 1];
+    size_t outstanding = 0;
+    bool stopping = false;
+    unsigned queueDepth = kDefaultQueueDepth;
+    unsigned workerThreads = 1;
+
+    std::unique_ptr<UringBackend> uring;
+    std::unique_ptr<ThreadPoolBackend> pool;
+    // Set when the ring fails; `pool` then serves every later request
+    std::atomic<bool> uringFailed{false};
+
+    void Wake();
+
+    // Caller holds `mutex` for both. Cancelled requests count as queued
+    // until PopLocked() skips them.
+    bool HasQueuedLocked() const {
+        for (const auto& queue : queues) {
+            if (!queue.empty()) return true;
+        }
+        return false;
+    }
+
+    // Oldest request of the highest priority, claimed for issue
+    std::shared_ptr<ReadState> PopLocked() {
+        for (size_t level = std::size(queues); level > 0; --level) {
+            auto& queue = queues[level - 1];
+            while (!queue.empty()) {
+                std::shared_ptr<ReadState> state = std::move(queue.front());
+                queue.pop_front();
+                if (state->Claim()) {
+                    return state;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    // Runs the callback, then releases waiters. Called once per request.
+    void Finish(ReadState& state, IOStatus status, int error = 0) {
+        state.result.status = status;
+        state.result.error = error;
+        if (status != IOStatus::Completed) {
+            state.result.data.clear();
+            state.result.data.shrink_to_fit();
+        }
+        if (state.onComplete) {
+            state.onComplete(state.result);
+            state.onComplete = nullptr;
+        }
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.done = true;
+            state.status.store(status, std::memory_order_release);
+            state.doneSignal.notify_all();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--outstanding == 0) {
+            idle.notify_all();
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Thread pool backend: blocking reads on worker threads
+
+class AsyncFileIO::ThreadPoolBackend {
+public:
+    ThreadPoolBackend(Impl& impl_, unsigned threadCount) : impl(impl_) {
+        for (unsigned i = 0; i < threadCount; ++i) {
+            workers.emplace_back([this] { Run(); });
+        }
+    }
+
+    ~ThreadPoolBackend() {
+        impl.workAvailable.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+private:
+    void Run() {
+        for (;;) {
+            std::shared_ptr<ReadState> state;
+            {
+                std::unique_lock<std::mutex> lock(impl.mutex);
+                impl.workAvailable.wait(lock, [&] { return impl.stopping || impl.HasQueuedLocked(); });
+                state = impl.PopLocked();
+                if (!state) {
+                    if (impl.stopping) {
+                        return;
+                    }
+                    continue;
+                }
+            }
+            ReadBlocking(*state);
+        }
+    }
+
+    void ReadBlocking(ReadState& state) {
+        std::ifstream file(state.path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            impl.Finish(state, IOStatus::Failed, errno != 0 ? errno : ENOENT);
+            return;
+        }
+        const std::streamoff fileSize = file.tellg();
+        if (fileSize < 0) {
+            impl.Finish(state, IOStatus::Failed, EIO);
+            return;
+        }
+        const uint64_t available =
+            state.offset < static_cast<uint64_t>(fileSize) ? static_cast<uint64_t>(fileSize) - state.offset : 0;
+        const size_t length = static_cast<size_t>(std::min<uint64_t>(state.length, available));
+        state.result.data.resize(length);
+        if (length > 0) {
+            file.seekg(static_cast<std::streamoff>(state.offset));
+            if (!file.read(state.result.data.data(), static_cast<std::streamsize>(length))) {
+                impl.Finish(state, IOStatus::Failed, EIO);
+                return;
+            }
+        }
+        impl.Finish(state, IOStatus::Completed);
+    }
+
+    Impl& impl;
+    std::vector<std::thread> workers;
+};
+
+// ---------------------------------------------------------------------------
+// io_uring backend: one thread keeps up to queueDepth reads in the ring
+
+#if GE_HAS_IO_URING
+
+class AsyncFileIO::UringBackend {
+public:
+    static std::unique_ptr<UringBackend> Create(Impl& impl) {
+        std::unique_ptr<UringBackend> backend(new UringBackend(impl));
+        // One extra entry for the wakeup read
+        if (backend->wakeFd < 0 || !backend->ring.Init(impl.queueDepth + 1)) {
+            return nullptr;
+        }
+        backend->thread = std::thread([raw = backend.get()] { raw->Run(); });
+        return backend;
+    }
+
+    ~UringBackend() {
+        if (thread.joinable()) {
+            Wake();
+            thread.join();
+        }
+        // Run() only returns once every slot is free, so the kernel holds
+        // no buffer of ours any more
+        if (wakeFd >= 0) {
+            ::close(wakeFd);
+        }
+    }
+
+    // Called after queueing work; at most one eventfd write per wakeup
+    void Wake() {
+        if (!wakePending.exchange(true)) {
+            const uint64_t one = 1;
+            ssize_t written = ::write(wakeFd, &one, sizeof(one));
+            (void)written;
+        }
+    }
+
+private:
+    // Largest single read; longer requests continue as short reads do
+    static constexpr size_t kMaxReadChunk = size_t(1) << 30;
+    static constexpr uint64_t kWakeTag = ~uint64_t(0);
+    // How long Fail() waits for reads already in the kernel
+    static constexpr int kDrainMilliseconds = 2000;
+
+    struct Slot {
+        std::shared_ptr<ReadState> state;
+        int fd = -1;
+        size_t done = 0;
+    };
+
+    explicit UringBackend(Impl& impl_)
+        : impl(impl_), wakeFd(::eventfd(0, EFD_CLOEXEC)), slots(impl_.queueDepth) {
+        for (size_t i = slots.size(); i > 0; --i) {
+            freeSlots.push_back(static_cast<uint32_t>(i - 1));
+        }
+    }
+
+    void ArmWake() {
+        ring.PrepareRead(wakeFd, &wakeValue, sizeof(wakeValue), 0, kWakeTag);
+        wakeArmed = true;
+    }
+
+    void Run() {
+        ArmWake();
+        std::vector<std::shared_ptr<ReadState>> batch;
+        for (;;) {
+            bool stopping;
+            {
+                std::lock_guard<std::mutex> lock(impl.mutex);
+                while (batch.size() < freeSlots.size()) {
+                    std::shared_ptr<ReadState> state = impl.PopLocked();
+                    if (!state) {
+                        break;
+                    }
+                    batch.push_back(std::move(state));
+                }
+                stopping = impl.stopping;
+            }
+            for (std::shared_ptr<ReadState>& state : batch) {
+                Issue(std::move(state));
+            }
+            batch.clear();
+            if (stopping && freeSlots.size() == slots.size()) {
+                return;
+            }
+
+            // Issues the whole batch at once and sleeps until a read
+            // completes or more work is queued
+            if (!ring.SubmitAndWait(1)) {
+                Fail(errno != 0 ? errno : EIO);
+                return;
+            }
+            ring.Reap([this](uint64_t tag, int result) { OnCompletion(tag, result); });
+            if (failure != 0) {
+                Fail(failure);
+                return;
+            }
+        }
+    }
+
+    // The ring is unusable. Waits for the reads the kernel already has,
+    // fails every request in a slot, and hands the queue to a thread pool.
+    void Fail(int error) {
+        std::vector<bool> inKernel(slots.size());
+        for (size_t i = 0; i < slots.size(); ++i) {
+            inKernel[i] = slots[i].state != nullptr;
+        }
+        ring.ForEachUnsubmitted([&](uint64_t tag) {
+            if (tag == kWakeTag) {
+                wakeArmed = false;
+            } else {
+                inKernel[tag] = false;
+            }
+        });
+        if (wakeArmed) {
+            // Lets the pending wakeup read complete
+            const uint64_t one = 1;
+            ssize_t written = ::write(wakeFd, &one, sizeof(one));
+            (void)written;
+        }
+        // Completions still arrive in the mapped ring without entering the
+        // kernel, so poll it rather than call SubmitAndWait() again
+        auto anyInKernel = [&] { return wakeArmed || std::find(inKernel.begin(), inKernel.end(), true) != inKernel.end(); };
+        for (int waited = 0; anyInKernel() && waited < kDrainMilliseconds; ++waited) {
+            const unsigned reaped = ring.Reap([&](uint64_t tag, int) {
+                if (tag == kWakeTag) {
+                    wakeArmed = false;
+                } else {
+                    inKernel[tag] = false;
+                }
+            });
+            if (reaped == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        ring.Close();
+
+        for (size_t i = 0; i < slots.size(); ++i) {
+            Slot& slot = slots[i];
+            if (!slot.state) {
+                continue;
+            }
+            if (inKernel[i]) {
+                // The kernel may still write into this buffer after the
+                // ring is gone; leaking it is the only safe option
+                new std::vector<char>(std::move(slot.state->result.data));
+            }
+            std::shared_ptr<ReadState> state = std::move(slot.state);
+            ::close(slot.fd);
+            slot = Slot{};
+            freeSlots.push_back(static_cast<uint32_t>(i));
+            impl.Finish(*state, IOStatus::Failed, error);
+        }
+
+        // Requests still queued were never issued; the pool serves them
+        impl.uringFailed.store(true);
+        std::lock_guard<std::mutex> lock(impl.mutex);
+        impl.pool = std::make_unique<ThreadPoolBackend>(impl, impl.workerThreads);
+    }
+
+    void Issue(std::shared_ptr<ReadState> state) {
+        const int fd = ::open(state->path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            impl.Finish(*state, IOStatus::Failed, errno);
+            return;
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            const int error = errno;
+            ::close(fd);
+            impl.Finish(*state, IOStatus::Failed, error);
+            return;
+        }
+        const uint64_t fileSize = static_cast<uint64_t>(info.st_size);
+        const uint64_t available = state->offset < fileSize ? fileSize - state->offset : 0;
+        const size_t length = static_cast<size_t>(std::min<uint64_t>(state->length, available));
+        if (length == 0) {
+            ::close(fd);
+            impl.Finish(*state, IOStatus::Completed);
+            return;
+        }
+        state->result.data.resize(length);
+
+        const uint32_t index = freeSlots.back();
+        freeSlots.pop_back();
+        slots[index] = Slot{std::move(state), fd, 0};
+        Continue(index);
+    }
+
+    void Continue(uint32_t index) {
+        Slot& slot = slots[index];
+        std::vector<char>& data = slot.state->result.data;
+        const size_t chunk = std::min(data.size() - slot.done, kMaxReadChunk);
+        // Never full: the ring has a free entry for every slot
+        ring.PrepareRead(slot.fd, data.data() + slot.done, static_cast<uint32_t>(chunk),
+                         slot.state->offset + slot.done, index);
+    }
+
+    void OnCompletion(uint64_t tag, int result) {
+        if (tag == kWakeTag) {
+            wakeArmed = false;
+            wakePending.store(false);
+            if (result < 0 && result != -EINTR && result != -EAGAIN) {
+                // Re-arming would fail again at once and spin
+                failure = -result;
+                return;
+            }
+            ArmWake();
+            return;
+        }
+        const uint32_t index = static_cast<uint32_t>(tag);
+        Slot& slot = slots[index];
+        std::vector<char>& data = slot.state->result.data;
+        if (result == -EINTR || result == -EAGAIN) {
+            Continue(index);
+            return;
+        }
+        if (result > 0) {
+            slot.done += static_cast<size_t>(result);
+            if (slot.done < data.size()) {
+                Continue(index);
+                return;
+            }
+        } else if (result == 0) {
+            // The file shrank since fstat(): keep what was read
+            data.resize(slot.done);
+        }
+
+        std::shared_ptr<ReadState> state = std::move(slot.state);
+        ::close(slot.fd);
+        slot = Slot{};
+        freeSlots.push_back(index);
+        if (result < 0) {
+            impl.Finish(*state, IOStatus::Failed, -result);
+        } else {
+            impl.Finish(*state, IOStatus::Completed);
+        }
+    }
+
+    Impl& impl;
+    int wakeFd;
+    uint64_t wakeValue = 0;
+    bool wakeArmed = false;
+    std::atomic<bool> wakePending{false};
+    int failure = 0;   // errno from a failed wakeup read
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+    Detail::IoUring ring;
+    std::thread thread;
+};
+
+#else
+
+class AsyncFileIO::UringBackend {
+public:
+    static std::unique_ptr<UringBackend> Create(Impl&) { return nullptr; }
+    void Wake() {}
+};
+
+#endif
+
+void AsyncFileIO::Impl::Wake() {
+    if (uring && !uringFailed.load()) {
+        uring->Wake();
+    } else {
+        workAvailable.notify_all();
+    }
+}
+
+// ---------------------------------------------------------------------------
+
+IOStatus ReadHandle::Status() const {
+    return state ? state->status.load(std::memory_order_acquire) : IOStatus::Failed;
+}
+
+bool ReadHandle::IsDone() const {
+    if (!state) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->done;
+}
+
+ReadResult& ReadHandle::Wait() const {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->doneSignal.wait(lock, [this] { return state->done; });
+    return state->result;
+}
+
+bool ReadHandle::Cancel() const {
+    if (!state || !state->Claim()) {
+        return false;
+    }
+    // Left in the queue; the I/O thread skips it
+    state->owner->Finish(*state, IOStatus::Cancelled);
+    return true;
+}
+
+AsyncFileIO::AsyncFileIO(Backend backend, unsigned queueDepth, unsigned workerThreads)
+    : impl(std::make_unique<Impl>()) {
+    impl->queueDepth = std::max(queueDepth, 1u);
+    if (backend != Backend::ThreadPool) {
+        impl->uring = UringBackend::Create(*impl);
+    }
+    if (workerThreads == 0) {
+        workerThreads = std::min(std::max(std::thread::hardware_concurrency(), 1u), impl->queueDepth);
+    }
+    impl->workerThreads = workerThreads;
+    if (!impl->uring) {
+        impl->pool = std::make_unique<ThreadPoolBackend>(*impl, workerThreads);
+    }
+}
+
+AsyncFileIO::~AsyncFileIO() {
+    std::vector<std::shared_ptr<ReadState>> queued;
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->stopping = true;
+        while (std::shared_ptr<ReadState> state = impl->PopLocked()) {
+            queued.push_back(std::move(state));
+        }
+    }
+    for (const std::shared_ptr<ReadState>& state : queued) {
+        impl->Finish(*state, IOStatus::Cancelled);
+    }
+    // Backends finish their in-flight reads before joining
+    impl->uring.reset();
+    impl->pool.reset();
+    WaitIdle();
+}
+
+ReadHandle AsyncFileIO::Read(const std::string& path, IOPriority priority, Callback onComplete) {
+    ReadRequest request;
+    request.path = path;
+    request.priority = priority;
+    request.onComplete = std::move(onComplete);
+    return Read(std::move(request));
+}
+
+ReadHandle AsyncFileIO::Read(ReadRequest request) {
+    std::vector<ReadRequest> requests;
+    requests.push_back(std::move(request));
+    return ReadBatch(std::move(requests)).front();
+}
+
+std::vector<ReadHandle> AsyncFileIO::ReadBatch(std::vector<ReadRequest> requests) {
+    std::vector<ReadHandle> handles;
+    handles.reserve(requests.size());
+    std::vector<std::shared_ptr<ReadState>> states;
+    states.reserve(requests.size());
+    for (ReadRequest& request : requests) {
+        auto state = std::make_shared<ReadState>();
+        state->path = std::move(request.path);
+        state->offset = request.offset;
+        state->length = request.length;
+        state->priority = request.priority;
+        state->onComplete = std::move(request.onComplete);
+        state->owner = impl.get();
+        handles.push_back(ReadHandle(state));
+        states.push_back(std::move(state));
+    }
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        for (std::shared_ptr<ReadState>& state : states) {
+            impl->queues[static_cast<size_t>(state->priority)].push_back(std::move(state));
+        }
+        impl->outstanding += states.size();
+    }
+    impl->Wake();
+    return handles;
+}
+
+void AsyncFileIO::WaitIdle() {
+    std::unique_lock<std::mutex> lock(impl->mutex);
+    impl->idle.wait(lock, [this] { return impl->outstanding == 0; });
+}
+
+AsyncFileIO::Backend AsyncFileIO::GetBackend() const {
+    return impl->uring && !impl->uringFailed.load() ? Backend::IoUring : Backend::ThreadPool;
+}
+
+unsigned AsyncFileIO::GetQueueDepth() const {
+    return impl->queueDepth;
+}
+
+} // namespace Core
+} // namespace GameEngine
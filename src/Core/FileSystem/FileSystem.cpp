@@ -0,0 +1,245 @@
+#include "GameEngine/Core/FileSystem.h"
+#include "GameEngine/Core/AssetArchive.h"
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GE_HAS_POSIX_READ 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define GE_HAS_POSIX_READ 0
+#include <iterator>
+#endif
+
+namespace GameEngine {
+namespace Core {
+
+namespace {
+
+constexpr const char* kSeparators = "/\\";
+
+size_t FileNameStart(const std::string& filepath) {
+    const size_t separator = filepath.find_last_of(kSeparators);
+    return separator == std::string::npos ? 0 : separator + 1;
+}
+
+struct Mount {
+    std::string prefix;   // Normalized mount point plus '/', or empty
+    std::shared_ptr<AssetArchive> archive;
+};
+
+struct MountTable {
+    std::shared_mutex mutex;
+    std::vector<Mount> mounts;   // Searched back to front
+};
+
+MountTable& Mounts() {
+    static MountTable table;
+    return table;
+}
+
+// An archive entry found for `filepath`; `archive` keeps `entry` valid
+struct ArchiveHit {
+    std::shared_ptr<AssetArchive> archive;
+    const AssetPack::Entry* entry = nullptr;
+};
+
+ArchiveHit FindInArchives(const std::string& filepath) {
+    MountTable& table = Mounts();
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+    if (table.mounts.empty()) {
+        return {};
+    }
+    const std::string path = AssetPack::NormalizePath(filepath);
+    for (auto mount = table.mounts.rbegin(); mount != table.mounts.rend(); ++mount) {
+        if (path.compare(0, mount->prefix.size(), mount->prefix) != 0) {
+            continue;
+        }
+        const std::string_view entryPath = std::string_view(path).substr(mount->prefix.size());
+        if (const AssetPack::Entry* entry = mount->archive->Find(entryPath)) {
+            return {mount->archive, entry};
+        }
+    }
+    return {};
+}
+
+// Copies a whole file with read() rather than through a mapping: files
+// that report size 0 (procfs, pipes) still come back whole, and a file
+// truncated during the copy ends it early instead of raising SIGBUS.
+// Buffer is std::string or std::vector<char>.
+template<typename Buffer>
+bool ReadWholeFile(const std::string& filepath, Buffer& out) {
+#if GE_HAS_POSIX_READ
+    const int fd = ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        out.resize(static_cast<size_t>(info.st_size));
+    }
+    size_t size = 0;
+    bool ok = true;
+    for (;;) {
+        ssize_t result;
+        if (size < out.size()) {
+            result = ::read(fd, &out[size], out.size() - size);
+        } else {
+            // Full (or the size is unknown): read on in chunks until EOF
+            char chunk[4096];
+            result = ::read(fd, chunk, sizeof(chunk));
+            if (result > 0) {
+                out.insert(out.end(), chunk, chunk + result);
+            }
+        }
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            ok = result == 0;
+            break;
+        }
+        size += static_cast<size_t>(result);
+    }
+    ::close(fd);
+    out.resize(size);
+    return ok;
+#else
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+#endif
+}
+
+} // namespace
+
+bool FileSystem::MountArchive(const std::string& archivePath, const std::string& mountPoint) {
+    std::shared_ptr<AssetArchive> archive = AssetArchive::Open(archivePath);
+    if (!archive) {
+        return false;
+    }
+    std::string prefix = AssetPack::NormalizePath(mountPoint);
+    while (!prefix.empty() && prefix.back() == '/') {
+        prefix.pop_back();
+    }
+    if (!prefix.empty()) {
+        prefix += '/';
+    }
+    MountTable& table = Mounts();
+    std::unique_lock<std::shared_mutex> lock(table.mutex);
+    table.mounts.push_back(Mount{std::move(prefix), std::move(archive)});
+    return true;
+}
+
+bool FileSystem::UnmountArchive(const std::string& archivePath) {
+    MountTable& table = Mounts();
+    std::unique_lock<std::shared_mutex> lock(table.mutex);
+    auto found = std::find_if(table.mounts.rbegin(), table.mounts.rend(),
+                              [&](const Mount& mount) { return mount.archive->GetPath() == archivePath; });
+    if (found == table.mounts.rend()) {
+        return false;
+    }
+    table.mounts.erase(std::next(found).base());
+    return true;
+}
+
+void FileSystem::UnmountAllArchives() {
+    MountTable& table = Mounts();
+    std::unique_lock<std::shared_mutex> lock(table.mutex);
+    table.mounts.clear();
+}
+
+std::optional<MappedFile> FileSystem::MapFile(const std::string& filepath, MappedFile::Access access) {
+    if (ArchiveHit hit = FindInArchives(filepath); hit.entry) {
+        return hit.archive->Map(*hit.entry);
+    }
+    return MappedFile::Open(filepath, access);
+}
+
+std::optional<std::string> FileSystem::ReadTextFile(const std::string& filepath) {
+    if (ArchiveHit hit = FindInArchives(filepath); hit.entry) {
+        std::string text(static_cast<size_t>(hit.entry->size), '\0');
+        if (!hit.archive->ReadInto(*hit.entry, text.data())) {
+            return std::nullopt;
+        }
+        return text;
+    }
+    std::string text;
+    if (!ReadWholeFile(filepath, text)) {
+        return std::nullopt;
+    }
+    return text;
+}
+
+std::optional<std::vector<char>> FileSystem::ReadBinaryFile(const std::string& filepath) {
+    if (ArchiveHit hit = FindInArchives(filepath); hit.entry) {
+        return hit.archive->Read(*hit.entry);
+    }
+    std::vector<char> data;
+    if (!ReadWholeFile(filepath, data)) {
+        return std::nullopt;
+    }
+    return data;
+}
+
+bool FileSystem::WriteTextFile(const std::string& filepath, const std::string& content) {
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return static_cast<bool>(file);
+}
+
+bool FileSystem::WriteBinaryFile(const std::string& filepath, const std::vector<char>& data) {
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(file);
+}
+
+bool FileSystem::FileExists(const std::string& filepath) {
+    if (FindInArchives(filepath).entry) {
+        return true;
+    }
+    std::error_code error;
+    return std::filesystem::is_regular_file(filepath, error);
+}
+
+bool FileSystem::CreateDirectory(const std::string& path) {
+    std::error_code error;
+    std::filesystem::create_directories(path, error);
+    return std::filesystem::is_directory(path, error);
+}
+
+std::string FileSystem::GetFileExtension(const std::string& filepath) {
+    const size_t dot = filepath.find_last_of('.');
+    if (dot == std::string::npos || dot < FileNameStart(filepath)) {
+        return "";
+    }
+    return filepath.substr(dot + 1);
+}
+
+std::string FileSystem::GetFileName(const std::string& filepath) {
+    return filepath.substr(FileNameStart(filepath));
+}
+
+std::string FileSystem::GetDirectoryPath(const std::string& filepath) {
+    const size_t start = FileNameStart(filepath);
+    return start == 0 ? "" : filepath.substr(0, start - 1);
+}
+
+} // namespace Core
+} // namespace GameEngine
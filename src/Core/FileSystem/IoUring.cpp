@@ -0,0 +1,152 @@
+#include "IoUring.h"
+
+#if GE_HAS_IO_URING
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace GameEngine {
+namespace Core {
+namespace Detail {
+
+namespace {
+
+unsigned* RingField(void* ring, uint32_t offset) {
+    return reinterpret_cast<unsigned*>(static_cast<char*>(ring) + offset);
+}
+
+// IORING_OP_READ arrived in 5.6, as did IORING_REGISTER_PROBE itself, so a
+// failed probe also means the opcode is missing
+bool SupportsRead(int ringFd) {
+    constexpr unsigned kProbeOps = 256;
+    alignas(io_uring_probe) unsigned char buffer[sizeof(io_uring_probe) + kProbeOps * sizeof(io_uring_probe_op)];
+    std::memset(buffer, 0, sizeof(buffer));
+    io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(buffer);
+    if (::syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_PROBE, probe, kProbeOps) < 0) {
+        return false;
+    }
+    return IORING_OP_READ < probe->ops_len && (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) != 0;
+}
+
+} // namespace
+
+IoUring::~IoUring() {
+    Close();
+}
+
+void IoUring::Close() {
+    if (sqes != nullptr) {
+        ::munmap(sqes, sqesSize);
+        sqes = nullptr;
+    }
+    if (cqRing != nullptr && cqRing != sqRing) {
+        ::munmap(cqRing, cqRingSize);
+    }
+    cqRing = nullptr;
+    if (sqRing != nullptr) {
+        ::munmap(sqRing, sqRingSize);
+        sqRing = nullptr;
+    }
+    if (ringFd >= 0) {
+        ::close(ringFd);
+        ringFd = -1;
+    }
+}
+
+bool IoUring::Init(unsigned entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    const long fd = ::syscall(__NR_io_uring_setup, entries, &params);
+    if (fd < 0) {
+        return false;
+    }
+    ringFd = static_cast<int>(fd);
+    if (!SupportsRead(ringFd)) {
+        Close();
+        return false;
+    }
+
+    sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMap) {
+        sqRingSize = cqRingSize = sqRingSize > cqRingSize ? sqRingSize : cqRingSize;
+    }
+
+    void* sq = ::mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd,
+                      IORING_OFF_SQ_RING);
+    if (sq == MAP_FAILED) {
+        return false;
+    }
+    sqRing = sq;
+    if (singleMap) {
+        cqRing = sqRing;
+    } else {
+        void* cq = ::mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd,
+                          IORING_OFF_CQ_RING);
+        if (cq == MAP_FAILED) {
+            return false;
+        }
+        cqRing = cq;
+    }
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* entriesMap = ::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd,
+                              IORING_OFF_SQES);
+    if (entriesMap == MAP_FAILED) {
+        return false;
+    }
+    sqes = static_cast<io_uring_sqe*>(entriesMap);
+
+    sqHead = RingField(sqRing, params.sq_off.head);
+    sqTail = RingField(sqRing, params.sq_off.tail);
+    sqMask = RingField(sqRing, params.sq_off.ring_mask);
+    sqEntries = RingField(sqRing, params.sq_off.ring_entries);
+    sqArray = RingField(sqRing, params.sq_off.array);
+    cqHead = RingField(cqRing, params.cq_off.head);
+    cqTail = RingField(cqRing, params.cq_off.tail);
+    cqMask = RingField(cqRing, params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe*>(static_cast<char*>(cqRing) + params.cq_off.cqes);
+    return true;
+}
+
+bool IoUring::PrepareRead(int fd, void* buffer, uint32_t length, uint64_t offset, uint64_t tag) {
+    const unsigned tail = *sqTail;
+    if (tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= *sqEntries) {
+        return false;
+    }
+    const unsigned index = tail & *sqMask;
+    io_uring_sqe& sqe = sqes[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_READ;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<uint64_t>(buffer);
+    sqe.len = length;
+    sqe.off = offset;
+    sqe.user_data = tag;
+    sqArray[index] = index;
+    __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+    ++toSubmit;
+    return true;
+}
+
+bool IoUring::SubmitAndWait(unsigned minComplete) {
+    for (;;) {
+        const long result = ::syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, IORING_ENTER_GETEVENTS,
+                                      nullptr, 0);
+        if (result >= 0) {
+            toSubmit -= static_cast<unsigned>(result);
+            return true;
+        }
+        if (errno != EINTR) {
+            return false;
+        }
+    }
+}
+
+} // namespace Detail
+} // namespace Core
+} // namespace GameEngine
+
+#endif
@@ -0,0 +1,95 @@
+#pragma once
+// Minimal io_uring wrapper over the raw system calls (no liburing
+// dependency). Private to the engine; used by AsyncFileIO.
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define GE_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#else
+#define GE_HAS_IO_URING 0
+#endif
+
+#if GE_HAS_IO_URING
+
+namespace GameEngine {
+namespace Core {
+namespace Detail {
+
+// Single-threaded: one thread prepares, submits and reaps
+class IoUring {
+public:
+    IoUring() = default;
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    // False if the kernel lacks io_uring, is older than 5.6 (no
+    // IORING_OP_READ) or blocks it (e.g. seccomp)
+    bool Init(unsigned entries);
+    // Unmaps the rings and closes the ring fd; the kernel cancels whatever
+    // is still in flight, but may finish doing so after this returns
+    void Close();
+
+    // Queues a read; false if the submission ring is full
+    bool PrepareRead(int fd, void* buffer, uint32_t length, uint64_t offset, uint64_t tag);
+
+    // Submits every prepared entry and waits for at least `minComplete`
+    // completions. Returns false on an unexpected error.
+    bool SubmitAndWait(unsigned minComplete);
+
+    // Calls fn(tag) for each prepared entry the kernel has not consumed.
+    // Without SQPOLL those reads never start unless SubmitAndWait() is
+    // called again.
+    template<typename Fn>
+    void ForEachUnsubmitted(Fn&& fn) const {
+        const unsigned tail = *sqTail;
+        for (unsigned head = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE); head != tail; ++head) {
+            fn(sqes[sqArray[head & *sqMask]].user_data);
+        }
+    }
+
+    // Calls fn(tag, result) for each completion; result is bytes read or
+    // -errno
+    template<typename Fn>
+    unsigned Reap(Fn&& fn) {
+        unsigned head = *cqHead;
+        const unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+        unsigned count = 0;
+        for (; head != tail; ++head, ++count) {
+            const io_uring_cqe& cqe = cqes[head & *cqMask];
+            fn(cqe.user_data, cqe.res);
+        }
+        __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+        return count;
+    }
+
+private:
+    int ringFd = -1;
+    unsigned toSubmit = 0;
+
+    void* sqRing = nullptr;
+    size_t sqRingSize = 0;
+    void* cqRing = nullptr;   // Same mapping as sqRing with IORING_FEAT_SINGLE_MMAP
+    size_t cqRingSize = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqesSize = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned* sqMask = nullptr;
+    unsigned* sqEntries = nullptr;
+    unsigned* sqArray = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned* cqMask = nullptr;
+    io_uring_cqe* cqes = nullptr;
+};
+
+} // namespace Detail
+} // namespace Core
+} // namespace GameEngine
+
+#endif
@@ -0,0 +1,187 @@
+#include "Lz4Block.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace GameEngine {
+namespace Core {
+namespace Detail {
+
+namespace {
+
+// Format constants from the LZ4 block specification
+constexpr size_t kMinMatch = 4;
+constexpr size_t kLastLiterals = 5;       // The block always ends in literals
+constexpr size_t kMatchStartLimit = 12;   // No match starts in the last 12 bytes
+constexpr size_t kMaxOffset = 65535;
+constexpr unsigned kRunMask = 15;
+
+constexpr int kHashLog = 14;
+
+uint32_t Read32(const unsigned char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+uint32_t Hash(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashLog);
+}
+
+// Lengths of 15 and up continue in extra bytes of 255 plus a remainder
+unsigned char* WriteLength(unsigned char* out, size_t length) {
+    for (; length >= 255; length -= 255) {
+        *out++ = 255;
+    }
+    *out++ = static_cast<unsigned char>(length);
+    return out;
+}
+
+bool ReadLength(const unsigned char*& in, const unsigned char* end, size_t& length) {
+    unsigned char byte;
+    do {
+        if (in == end) {
+            return false;
+        }
+        byte = *in++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+} // namespace
+
+size_t Lz4Compress(const char* source, size_t sourceSize, char* destination, size_t capacity) {
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(source);
+    unsigned char* out = reinterpret_cast<unsigned char*>(destination);
+    unsigned char* const outEnd = out + capacity;
+
+    // Writes literals [anchor, position) and, if matchLength > 0, a match;
+    // false if it would not fit
+    auto emit = [&](size_t anchor, size_t position, size_t offset, size_t matchLength) {
+        const size_t literals = position - anchor;
+        const size_t worst = 1 + literals / 255 + 1 + literals + 2 + matchLength / 255 + 1;
+        if (static_cast<size_t>(outEnd - out) < worst) {
+            return false;
+        }
+        unsigned char* token = out++;
+        *token = static_cast<unsigned char>((literals < kRunMask ? literals : kRunMask) << 4);
+        if (literals >= kRunMask) {
+            out = WriteLength(out, literals - kRunMask);
+        }
+        std::memcpy(out, in + anchor, literals);
+        out += literals;
+        if (matchLength > 0) {
+            *out++ = static_cast<unsigned char>(offset & 0xFF);
+            *out++ = static_cast<unsigned char>(offset >> 8);
+            const size_t code = matchLength - kMinMatch;
+            *token = static_cast<unsigned char>(*token | (code < kRunMask ? code : kRunMask));
+            if (code >= kRunMask) {
+                out = WriteLength(out, code - kRunMask);
+            }
+        }
+        return true;
+    };
+
+    size_t anchor = 0;
+    if (sourceSize > kMatchStartLimit) {
+        // Positions of the last occurrence of each hashed 4-byte sequence
+        std::vector<uint32_t> table(size_t(1) << kHashLog, 0);
+        const size_t matchStartLimit = sourceSize - kMatchStartLimit;
+        const size_t matchEndLimit = sourceSize - kLastLiterals;
+        size_t position = 0;
+        size_t misses = 0;
+        while (position <= matchStartLimit) {
+            const uint32_t sequence = Read32(in + position);
+            uint32_t& slot = table[Hash(sequence)];
+            size_t candidate = slot;
+            slot = static_cast<uint32_t>(position);
+            if (candidate >= position || position - candidate > kMaxOffset || Read32(in + candidate) != sequence) {
+                // Skip faster through incompressible data
+                position += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+            while (position > anchor && candidate > 0 && in[position - 1] == in[candidate - 1]) {
+                --position;
+                --candidate;
+            }
+            size_t length = kMinMatch;
+            while (position + length < matchEndLimit && in[position + length] == in[candidate + length]) {
+                ++length;
+            }
+            if (!emit(anchor, position, position - candidate, length)) {
+                return 0;
+            }
+            position += length;
+            anchor = position;
+            if (position - 2 <= matchStartLimit) {
+                table[Hash(Read32(in + position - 2))] = static_cast<uint32_t>(position - 2);
+            }
+        }
+    }
+    if (!emit(anchor, sourceSize, 0, 0)) {
+        return 0;
+    }
+    return static_cast<size_t>(out - reinterpret_cast<unsigned char*>(destination));
+}
+
+bool Lz4Decompress(const char* source, size_t sourceSize, char* destination, size_t destinationSize) {
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(source);
+    const unsigned char* const inEnd = in + sourceSize;
+    unsigned char* const outBegin = reinterpret_cast<unsigned char*>(destination);
+    unsigned char* out = outBegin;
+    unsigned char* const outEnd = out + destinationSize;
+
+    for (;;) {
+        if (in == inEnd) {
+            return false;
+        }
+        const unsigned token = *in++;
+        size_t literals = token >> 4;
+        if (literals == kRunMask && !ReadLength(in, inEnd, literals)) {
+            return false;
+        }
+        if (literals > static_cast<size_t>(inEnd - in) || literals > static_cast<size_t>(outEnd - out)) {
+            return false;
+        }
+        std::memcpy(out, in, literals);
+        in += literals;
+        out += literals;
+        if (in == inEnd) {
+            // The last sequence has literals only
+            return out == outEnd;
+        }
+
+        if (inEnd - in < 2) {
+            return false;
+        }
+        const size_t offset = size_t(in[0]) | (size_t(in[1]) << 8);
+        in += 2;
+        if (offset == 0 || offset > static_cast<size_t>(out - outBegin)) {
+            return false;
+        }
+        size_t length = token & kRunMask;
+        if (length == kRunMask && !ReadLength(in, inEnd, length)) {
+            return false;
+        }
+        length += kMinMatch;
+        if (length > static_cast<size_t>(outEnd - out)) {
+            return false;
+        }
+        const unsigned char* match = out - offset;
+        if (offset >= length) {
+            std::memcpy(out, match, length);
+            out += length;
+        } else {
+            // Overlapping copy repeats the last `offset` bytes
+            for (size_t i = 0; i < length; ++i) {
+                *out++ = *match++;
+            }
+        }
+    }
+}
+
+} // namespace Detail
+} // namespace Core
+} // namespace GameEngine
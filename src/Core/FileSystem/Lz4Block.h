@@ -0,0 +1,26 @@
+#pragma once
+// LZ4 block format codec (no frame format, no external dependency). The
+// compressor is the single-pass greedy one of reference LZ4 "fast", so
+// packing is quick and decompression is a tight copy loop. Private to the
+// engine; used by AssetArchive.
+#include <cstddef>
+
+namespace GameEngine {
+namespace Core {
+namespace Detail {
+
+// Worst-case compressed size of `size` input bytes
+constexpr size_t Lz4CompressBound(size_t size) {
+    return size + size / 255 + 16;
+}
+
+// Returns the compressed size, or 0 if it does not fit in `capacity`
+size_t Lz4Compress(const char* source, size_t sourceSize, char* destination, size_t capacity);
+
+// Decodes exactly `destinationSize` bytes. Returns false on malformed or
+// truncated input; never reads or writes out of bounds.
+bool Lz4Decompress(const char* source, size_t sourceSize, char* destination, size_t destinationSize);
+
+} // namespace Detail
+} // namespace Core
+} // namespace GameEngine
@@ -0,0 +1,154 @@
+#include "GameEngine/Core/MappedFile.h"
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GE_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define GE_HAS_MMAP 0
+#include <fstream>
+#endif
+
+namespace GameEngine {
+namespace Core {
+
+namespace {
+
+#if GE_HAS_MMAP
+int ToAdvice(MappedFile::Access access) {
+    switch (access) {
+        case MappedFile::Access::Sequential: return MADV_SEQUENTIAL;
+        case MappedFile::Access::Random: return MADV_RANDOM;
+        case MappedFile::Access::WillNeed: return MADV_WILLNEED;
+        case MappedFile::Access::DontNeed: return MADV_DONTNEED;
+        case MappedFile::Access::Normal:
+        default: return MADV_NORMAL;
+    }
+}
+#endif
+
+} // namespace
+
+std::optional<MappedFile> MappedFile::Open(const std::string& filepath, Access access) {
+    MappedFile file;
+#if GE_HAS_MMAP
+    const int fd = ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        ::close(fd);
+        return std::nullopt;
+    }
+    file.size = static_cast<size_t>(info.st_size);
+    if (file.size > 0) {
+        void* address = ::mmap(nullptr, file.size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        file.data = static_cast<const char*>(address);
+        file.mapped = true;
+    }
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    if (access != Access::Normal) {
+        file.Advise(access);
+    }
+#else
+    (void)access;
+    std::ifstream in(filepath, std::ios::binary | std::ios::ate);
+    if (!in.is_open()) {
+        return std::nullopt;
+    }
+    const std::streamoff length = in.tellg();
+    if (length < 0) {
+        return std::nullopt;
+    }
+    std::vector<char> buffer(static_cast<size_t>(length));
+    in.seekg(0);
+    if (!in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+        return std::nullopt;
+    }
+    file = FromBuffer(std::move(buffer));
+#endif
+    return file;
+}
+
+MappedFile MappedFile::FromView(const char* data_, size_t size_, std::shared_ptr<const void> owner_) {
+    MappedFile file;
+    file.data = data_;
+    file.size = size_;
+    file.owner = std::move(owner_);
+    return file;
+}
+
+MappedFile MappedFile::FromBuffer(std::vector<char> buffer) {
+    auto shared = std::make_shared<std::vector<char>>(std::move(buffer));
+    MappedFile file;
+    file.data = shared->data();
+    file.size = shared->size();
+    file.owner = std::move(shared);
+    return file;
+}
+
+MappedFile::~MappedFile() {
+    Release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data(std::exchange(other.data, nullptr)),
+      size(std::exchange(other.size, 0)),
+      mapped(std::exchange(other.mapped, false)),
+      owner(std::move(other.owner)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Release();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        mapped = std::exchange(other.mapped, false);
+        owner = std::move(other.owner);
+    }
+    return *this;
+}
+
+bool MappedFile::Advise(Access access, size_t offset, size_t length) const {
+#if GE_HAS_MMAP
+    if (!mapped || offset >= size) {
+        return false;
+    }
+    if (length > size - offset) {
+        length = size - offset;
+    }
+    // madvise() wants a page-aligned start; the mapping itself is aligned
+    const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t alignedOffset = offset - offset % pageSize;
+    void* start = const_cast<char*>(data + alignedOffset);
+    return ::madvise(start, length + (offset - alignedOffset), ToAdvice(access)) == 0;
+#else
+    (void)access;
+    (void)offset;
+    (void)length;
+    return false;
+#endif
+}
+
+void MappedFile::Release() {
+#if GE_HAS_MMAP
+    if (mapped) {
+        ::munmap(const_cast<char*>(data), size);
+    }
+#endif
+    owner.reset();
+    data = nullptr;
+    size = 0;
+    mapped = false;
+}
+
+} // namespace Core
+} // namespace GameEngine
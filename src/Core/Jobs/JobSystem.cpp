@@ -0,0 +1,281 @@
+#include "GameEngine/Core/JobSystem.h"
+#include "GameEngine/Core/Memory.h"
+#include "GameEngine/Core/Profiler.h"
+#include "WorkStealingDeque.h"
+#include <condition_variable>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace GameEngine {
+namespace Core {
+
+namespace {
+
+constexpr size_t kNoDeque = static_cast<size_t>(-1);
+
+// The system and deque the calling thread owns, if any
+thread_local const void* currentSystem = nullptr;
+thread_local size_t currentIndex = kNoDeque;
+
+// Picks steal victims; quality is irrelevant, speed is not
+uint32_t NextRandom() {
+    thread_local uint32_t state = 0x9E3779B9u ^ static_cast<uint32_t>(currentIndex);
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+} // namespace
+
+struct JobSystem::Impl {
+    using Deque = Detail::WorkStealingDeque<Detail::Job>;
+
+    static constexpr size_t kDequeCapacity = 4096;
+    // Failed searches before a thread sleeps
+    static constexpr int kSpinAttempts = 64;
+
+    GrowableMemoryPool<Detail::Job> jobs{"Jobs"};
+    std::vector<std::unique_ptr<Deque>> deques;   // [0] belongs to the constructing thread
+    std::vector<std::thread> workers;
+
+    // Jobs from threads without a deque, and deque overflow
+    std::mutex injectMutex;
+    std::deque<Detail::Job*> injected;
+    std::atomic<size_t> injectedCount{0};
+
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::atomic<unsigned> sleepers{0};
+
+    std::atomic<size_t> outstanding{0};   // Submitted or deferred, and unfinished
+    std::atomic<bool> stopping{false};
+
+    size_t CurrentIndex() const { return currentSystem == this ? currentIndex : kNoDeque; }
+
+    void Push(Detail::Job* job) {
+        const size_t self = CurrentIndex();
+        if (self == kNoDeque || !deques[self]->Push(job)) {
+            std::lock_guard<std::mutex> lock(injectMutex);
+            injected.push_back(job);
+            injectedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        WakeOne();
+    }
+
+    Detail::Job* Find(size_t self) {
+        if (self != kNoDeque) {
+            if (Detail::Job* job = deques[self]->Pop()) {
+                return job;
+            }
+        }
+        if (injectedCount.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(injectMutex);
+            if (!injected.empty()) {
+                Detail::Job* job = injected.front();
+                injected.pop_front();
+                injectedCount.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+        const size_t count = deques.size();
+        const size_t start = NextRandom() % count;
+        for (size_t i = 0; i < count; ++i) {
+            const size_t victim = (start + i) % count;
+            if (victim == self) {
+                continue;
+            }
+            if (Detail::Job* job = deques[victim]->Steal()) {
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    bool HasWork() const {
+        if (injectedCount.load(std::memory_order_relaxed) > 0) {
+            return true;
+        }
+        for (const auto& deque : deques) {
+            if (!deque->Empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Execute(Detail::Job* job) {
+        job->invoke(*job);
+        JobCounter* counter = job->counter;
+        jobs.Deallocate(job);
+        if (counter != nullptr) {
+            FinishCounterJob(*counter);
+        }
+        if (outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            WakeAll();
+        }
+    }
+
+    void FinishCounterJob(JobCounter& counter) {
+        uint32_t value = counter.pending.load(std::memory_order_relaxed);
+        while (value > 1) {
+            if (counter.pending.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel,
+                                                      std::memory_order_relaxed)) {
+                return;
+            }
+        }
+        // Last job of the group. Take the continuations before the counter
+        // reads as done, since its owner may destroy it right after.
+        Detail::Job* continuation;
+        {
+            std::lock_guard<std::mutex> lock(counter.mutex);
+            counter.closing = true;
+            continuation = counter.continuations;
+            counter.continuations = nullptr;
+        }
+        counter.pending.fetch_sub(1, std::memory_order_acq_rel);
+        while (continuation != nullptr) {
+            Detail::Job* next = continuation->next;
+            Push(continuation);
+            continuation = next;
+        }
+        WakeAll();
+    }
+
+    // The fence pairs with the one a sleeper issues after registering, so
+    // either the sleeper sees the new state or this sees the sleeper
+    void WakeOne() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers.load(std::memory_order_relaxed) > 0) {
+            { std::lock_guard<std::mutex> lock(sleepMutex); }
+            wake.notify_one();
+        }
+    }
+
+    void WakeAll() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers.load(std::memory_order_relaxed) > 0) {
+            { std::lock_guard<std::mutex> lock(sleepMutex); }
+            wake.notify_all();
+        }
+    }
+
+    // Runs jobs on the calling thread until done() holds, sleeping when
+    // there is nothing to run
+    template<typename Done>
+    void HelpUntil(Done done) {
+        const size_t self = CurrentIndex();
+        int misses = 0;
+        while (!done()) {
+            if (Detail::Job* job = Find(self)) {
+                Execute(job);
+                misses = 0;
+                continue;
+            }
+            if (++misses < kSpinAttempts) {
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepers.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            wake.wait(lock, [&] { return done() || HasWork(); });
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            misses = 0;
+        }
+    }
+
+    void WorkerMain(size_t index) {
+        currentSystem = this;
+        currentIndex = index;
+        Profiler::SetThreadName("Worker " + std::to_string(index));
+        HelpUntil([this] { return stopping.load(std::memory_order_acquire); });
+    }
+};
+
+JobSystem::JobSystem(unsigned workerThreads) : impl(std::make_unique<Impl>()) {
+    if (workerThreads == 0) {
+        const unsigned cores = std::thread::hardware_concurrency();
+        workerThreads = cores > 2 ? cores - 1 : 1;
+    }
+    impl->deques.reserve(workerThreads + 1);
+    for (unsigned i = 0; i <= workerThreads; ++i) {
+        impl->deques.push_back(std::make_unique<Impl::Deque>(Impl::kDequeCapacity));
+    }
+    currentSystem = impl.get();
+    currentIndex = 0;
+
+    impl->workers.reserve(workerThreads);
+    Impl* state = impl.get();
+    for (size_t i = 1; i <= workerThreads; ++i) {
+        impl->workers.emplace_back([state, i] { state->WorkerMain(i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    WaitIdle();
+    impl->stopping.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(impl->sleepMutex);
+    }
+    impl->wake.notify_all();
+    for (std::thread& worker : impl->workers) {
+        worker.join();
+    }
+    if (currentSystem == impl.get()) {
+        currentSystem = nullptr;
+        currentIndex = kNoDeque;
+    }
+}
+
+unsigned JobSystem::GetWorkerCount() const {
+    return static_cast<unsigned>(impl->workers.size());
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    impl->HelpUntil([&counter] { return counter.IsDone(); });
+}
+
+void JobSystem::WaitIdle() {
+    Impl* state = impl.get();
+    state->HelpUntil([state] { return state->outstanding.load(std::memory_order_acquire) == 0; });
+}
+
+Detail::Job* JobSystem::AllocateJob() {
+    return impl->jobs.Allocate();
+}
+
+void JobSystem::AddToCounter(JobCounter& counter) {
+    if (counter.pending.fetch_add(1, std::memory_order_acq_rel) == 0) {
+        std::lock_guard<std::mutex> lock(counter.mutex);
+        counter.closing = false;
+    }
+}
+
+void JobSystem::Submit(Detail::Job* job) {
+    impl->outstanding.fetch_add(1, std::memory_order_relaxed);
+    impl->Push(job);
+}
+
+void JobSystem::SubmitAfter(JobCounter& dependency, Detail::Job* job) {
+    {
+        std::lock_guard<std::mutex> lock(dependency.mutex);
+        if (!dependency.closing && dependency.pending.load(std::memory_order_acquire) != 0) {
+            impl->outstanding.fetch_add(1, std::memory_order_relaxed);
+            job->next = dependency.continuations;
+            dependency.continuations = job;
+            return;
+        }
+    }
+    Submit(job);
+}
+
+size_t JobSystem::DefaultGrain(size_t count) const {
+    const size_t chunks = static_cast<size_t>(GetThreadCount()) * 8;
+    return count > chunks ? count / chunks : 1;
+}
+
+} // namespace Core
+} // namespace GameEngine
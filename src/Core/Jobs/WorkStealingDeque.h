@@ -0,0 +1,99 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace GameEngine {
+namespace Core {
+namespace Detail {
+
+// Chase-Lev work-stealing deque with the C11 orderings from Lê et al.,
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (2013).
+// One owner thread calls Push() and Pop() at the bottom; any thread may
+// Steal() from the top. Fixed capacity: Push() fails when full and the
+// caller queues the item elsewhere.
+template<typename T>
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(size_t capacity)
+        : mask(RoundUpToPowerOfTwo(capacity) - 1),
+          buffer(std::make_unique<std::atomic<T*>[]>(mask + 1)) {}
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only
+    bool Push(T* item) {
+        const int64_t b = bottom.load(std::memory_order_relaxed);
+        const int64_t t = top.load(std::memory_order_acquire);
+        if (static_cast<size_t>(b - t) > mask) {
+            return false;
+        }
+        buffer[static_cast<size_t>(b) & mask].store(item, std::memory_order_relaxed);
+        // A release store rather than the paper's release fence; equivalent
+        // here, and visible to ThreadSanitizer
+        bottom.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Owner only; nullptr when empty or the last item was stolen
+    T* Pop() {
+        const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T* item = buffer[static_cast<size_t>(b) & mask].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Last item: race the thieves for it
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread; nullptr when empty or another thread won the item
+    T* Steal() {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+        T* item = buffer[static_cast<size_t>(t) & mask].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    // Approximate when other threads are active
+    bool Empty() const {
+        return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+
+private:
+    static size_t RoundUpToPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    // Thieves write top, the owner writes bottom; keep them apart
+    alignas(64) std::atomic<int64_t> top{0};
+    alignas(64) std::atomic<int64_t> bottom{0};
+    alignas(64) const size_t mask;
+    std::unique_ptr<std::atomic<T*>[]> buffer;
+};
+
+} // namespace Detail
+} // namespace Core
+} // namespace GameEngine
@@ -0,0 +1,440 @@
+#include "GameEngine/Core/BinaryLog.h"
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace GameEngine {
+namespace Core {
+namespace BinaryLog {
+
+namespace {
+
+struct Definition {
+    uint32_t level = 0;
+    uint32_t line = 0;
+    std::string signature;
+    std::string format;
+    std::string file;
+};
+
+struct ClockSync {
+    uint64_t ticks;
+    int64_t systemNanos;
+};
+
+// One decoded argument
+struct Arg {
+    char code;
+    int64_t integer = 0;
+    uint64_t unsignedInteger = 0;
+    double real = 0.0;
+    std::string text;
+};
+
+const char* LevelName(uint32_t level) {
+    switch (level) {
+        case 0: return "DEBUG";
+        case 1: return "INFO";
+        case 2: return "WARNING";
+        case 3: return "ERROR";
+        default: return "UNKNOWN";
+    }
+}
+
+class Cursor {
+public:
+    Cursor(const char* data_, size_t size_) : data(data_), size(size_) {}
+
+    template<typename T>
+    bool Read(T& value) {
+        if (size - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string& value) {
+        uint32_t length;
+        if (!Read(length) || size - offset < length) {
+            return false;
+        }
+        value.assign(data + offset, length);
+        offset += length;
+        return true;
+    }
+
+private:
+    const char* data;
+    size_t size;
+    size_t offset = 0;
+};
+
+bool DecodeArgs(const Definition& definition, const char* payload, size_t size, std::vector<Arg>& args) {
+    Cursor cursor(payload, size);
+    args.clear();
+    for (char code : definition.signature) {
+        Arg arg;
+        arg.code = code;
+        bool ok = true;
+        switch (code) {
+            case kInt32: {
+                int32_t value = 0;
+                ok = cursor.Read(value);
+                arg.integer = value;
+                break;
+            }
+            case kInt64: ok = cursor.Read(arg.integer); break;
+            case kUInt32: {
+                uint32_t value = 0;
+                ok = cursor.Read(value);
+                arg.unsignedInteger = value;
+                break;
+            }
+            case kUInt64:
+            case kPointer: ok = cursor.Read(arg.unsignedInteger); break;
+            case kDouble: ok = cursor.Read(arg.real); break;
+            case kString: ok = cursor.ReadString(arg.text); break;
+            default: return false;
+        }
+        if (!ok) {
+            // Payloads are truncated at kMaxEventPayload; keep what arrived
+            break;
+        }
+        args.push_back(std::move(arg));
+    }
+    return true;
+}
+
+// Re-runs the printf format with decoded arguments. Length modifiers in
+// the format are replaced to match the stored width of each argument, so
+// the conversion specs passed to snprintf are necessarily built at run time.
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#endif
+std::string FormatMessage(const std::string& format, const std::vector<Arg>& args) {
+    std::string out;
+    size_t next = 0;
+    char buffer[512];
+    auto takeInt = [&]() -> int {
+        if (next >= args.size()) return 0;
+        const Arg& arg = args[next++];
+        return arg.code == kInt32 || arg.code == kInt64 ? static_cast<int>(arg.integer)
+                                                        : static_cast<int>(arg.unsignedInteger);
+    };
+
+    for (size_t i = 0; i < format.size(); ++i) {
+        if (format[i] != '%') {
+            out += format[i];
+            continue;
+        }
+        if (i + 1 < format.size() && format[i + 1] == '%') {
+            out += '%';
+            ++i;
+            continue;
+        }
+
+        std::string spec = "%";
+        size_t j = i + 1;
+        while (j < format.size() && std::strchr("-+ #0", format[j]) != nullptr) {
+            spec += format[j++];
+        }
+        for (int part = 0; part < 2; ++part) {
+            if (part == 1) {
+                if (j >= format.size() || format[j] != '.') break;
+                spec += format[j++];
+            }
+            if (j < format.size() && format[j] == '*') {
+                spec += std::to_string(takeInt());
+                ++j;
+            } else {
+                while (j < format.size() && format[j] >= '0' && format[j] <= '9') {
+                    spec += format[j++];
+                }
+            }
+        }
+        while (j < format.size() && std::strchr("hlLqjzt", format[j]) != nullptr) {
+            ++j;
+        }
+        if (j >= format.size()) {
+            out.append(format, i, std::string::npos);
+            break;
+        }
+        const char conversion = format[j];
+        i = j;
+
+        if (conversion == 'n') {
+            continue;
+        }
+        if (next >= args.size()) {
+            out += "<missing>";
+            continue;
+        }
+        const Arg& arg = args[next++];
+        const bool isSigned = arg.code == kInt32 || arg.code == kInt64;
+        const bool isInteger = isSigned || arg.code == kUInt32 || arg.code == kUInt64 || arg.code == kPointer;
+        int written = -1;
+        if (std::strchr("diouxXc", conversion) != nullptr && isInteger) {
+            if (conversion == 'c') {
+                written = std::snprintf(buffer, sizeof(buffer), (spec + 'c').c_str(),
+                                        static_cast<int>(isSigned ? arg.integer : static_cast<int64_t>(arg.unsignedInteger)));
+            } else if (isSigned) {
+                written = std::snprintf(buffer, sizeof(buffer), (spec + "ll" + conversion).c_str(),
+                                        static_cast<long long>(arg.integer));
+            } else {
+                written = std::snprintf(buffer, sizeof(buffer), (spec + "ll" + conversion).c_str(),
+                                        static_cast<unsigned long long>(arg.unsignedInteger));
+            }
+        } else if (std::strchr("fFeEgGaA", conversion) != nullptr && arg.code == kDouble) {
+            written = std::snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(), arg.real);
+        } else if (conversion == 's' && arg.code == kString) {
+            written = std::snprintf(buffer, sizeof(buffer), (spec + 's').c_str(), arg.text.c_str());
+            if (written >= static_cast<int>(sizeof(buffer))) {
+                out += arg.text;
+                continue;
+            }
+        } else if (conversion == 'p' && isInteger) {
+            written = std::snprintf(buffer, sizeof(buffer), "0x%llx", static_cast<unsigned long long>(arg.unsignedInteger));
+        } else {
+            // Conversion and stored type disagree: print the value plainly
+            if (arg.code == kString) {
+                out += arg.text;
+            } else if (arg.code == kDouble) {
+                written = std::snprintf(buffer, sizeof(buffer), "%g", arg.real);
+            } else if (isSigned) {
+                written = std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(arg.integer));
+            } else {
+                written = std::snprintf(buffer, sizeof(buffer), "%llu",
+                                        static_cast<unsigned long long>(arg.unsignedInteger));
+            }
+        }
+        if (written > 0) {
+            out.append(buffer, static_cast<size_t>(written) < sizeof(buffer) ? static_cast<size_t>(written)
+                                                                           : sizeof(buffer) - 1);
+        }
+    }
+    return out;
+}
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+void AppendJsonString(std::string& out, const std::string& text) {
+    out += '"';
+    for (char c : text) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    out += escaped;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
+
+// Maps ticks to system_clock nanoseconds by a line through the first and
+// last clock sync records
+class Clock {
+public:
+    explicit Clock(const std::vector<ClockSync>& syncs) {
+        if (syncs.size() >= 2 && syncs.back().ticks != syncs.front().ticks) {
+            first = syncs.front();
+            nanosPerTick = static_cast<double>(syncs.back().systemNanos - first.systemNanos) /
+                           static_cast<double>(syncs.back().ticks - first.ticks);
+            valid = true;
+        }
+    }
+
+    bool Valid() const { return valid; }
+
+    int64_t ToSystemNanos(uint64_t ticks) const {
+        const double delta = static_cast<double>(static_cast<int64_t>(ticks - first.ticks));
+        return first.systemNanos + static_cast<int64_t>(delta * nanosPerTick);
+    }
+
+private:
+    ClockSync first{0, 0};
+    double nanosPerTick = 0.0;
+    bool valid = false;
+};
+
+void AppendWallTime(std::string& out, int64_t systemNanos) {
+    const std::time_t second = static_cast<std::time_t>(systemNanos / 1000000000);
+    std::tm local{};
+#if defined(_WIN32)
+    localtime_s(&local, &second);
+#else
+    localtime_r(&second, &local);
+#endif
+    char text[32];
+    const size_t length = std::strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &local);
+    out.append(text, length);
+    std::snprintf(text, sizeof(text), ".%03d", static_cast<int>(systemNanos / 1000000 % 1000));
+    out += text;
+}
+
+} // namespace
+
+bool Decode(std::istream& in, std::ostream& out, DecodeFormat format, std::string* error) {
+    const std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    return Decode(data, out, format, error);
+}
+
+bool Decode(std::string_view data, std::ostream& out, DecodeFormat format, std::string* error) {
+    auto fail = [error](const char* message) {
+        if (error) *error = message;
+        return false;
+    };
+
+    FileHeader fileHeader;
+    if (data.size() < sizeof(fileHeader)) {
+        return fail("file too short for a binary log header");
+    }
+    std::memcpy(&fileHeader, data.data(), sizeof(fileHeader));
+    if (std::memcmp(fileHeader.magic, kMagic, sizeof(kMagic)) != 0) {
+        return fail("not a binary log (bad magic)");
+    }
+    if (fileHeader.version != kVersion) {
+        return fail("unsupported binary log version");
+    }
+
+    // First pass: clock syncs, so every event can be given a wall time
+    std::vector<ClockSync> syncs;
+    size_t end = data.size();
+    for (size_t offset = sizeof(fileHeader); offset < data.size();) {
+        RecordHeader header;
+        if (data.size() - offset < sizeof(header)) {
+            end = offset;
+            break;
+        }
+        std::memcpy(&header, data.data() + offset, sizeof(header));
+        if (data.size() - offset - sizeof(header) < header.size) {
+            end = offset;
+            break;
+        }
+        if (header.formatId == kClockSyncRecord && header.size >= sizeof(int64_t)) {
+            ClockSync sync{header.timestamp, 0};
+            std::memcpy(&sync.systemNanos, data.data() + offset + sizeof(header), sizeof(sync.systemNanos));
+            syncs.push_back(sync);
+        }
+        offset += sizeof(header) + header.size;
+    }
+    const Clock clock(syncs);
+
+    std::unordered_map<uint32_t, Definition> definitions;
+    std::vector<Arg> args;
+    std::string line;
+    for (size_t offset = sizeof(fileHeader); offset < end;) {
+        RecordHeader header;
+        std::memcpy(&header, data.data() + offset, sizeof(header));
+        const char* payload = data.data() + offset + sizeof(header);
+        offset += sizeof(header) + header.size;
+
+        if (header.formatId == kClockSyncRecord) {
+            continue;
+        }
+        if (header.formatId == kDefinitionRecord) {
+            Cursor cursor(payload, header.size);
+            uint32_t id;
+            Definition definition;
+            if (!cursor.Read(id) || !cursor.Read(definition.level) || !cursor.Read(definition.line) ||
+                !cursor.ReadString(definition.signature) || !cursor.ReadString(definition.format) ||
+                !cursor.ReadString(definition.file)) {
+                return fail("malformed format definition");
+            }
+            definitions[id] = std::move(definition);
+            continue;
+        }
+
+        auto found = definitions.find(header.formatId);
+        if (found == definitions.end()) {
+            return fail("event references an undefined format id");
+        }
+        const Definition& definition = found->second;
+        if (!DecodeArgs(definition, payload, header.size, args)) {
+            return fail("format definition has an unknown argument type");
+        }
+        const std::string message = FormatMessage(definition.format, args);
+
+        line.clear();
+        if (format == DecodeFormat::Text) {
+            line += '[';
+            if (clock.Valid()) {
+                AppendWallTime(line, clock.ToSystemNanos(header.timestamp));
+            } else {
+                line += "t=" + std::to_string(header.timestamp);
+            }
+            line += "] [";
+            line += LevelName(definition.level);
+            line += "] ";
+            line += message;
+        } else {
+            line += "{\"ticks\":" + std::to_string(header.timestamp);
+            if (clock.Valid()) {
+                line += ",\"time_ns\":" + std::to_string(clock.ToSystemNanos(header.timestamp));
+            }
+            line += ",\"level\":\"";
+            line += LevelName(definition.level);
+            line += "\",\"format_id\":" + std::to_string(header.formatId);
+            if (!definition.file.empty()) {
+                line += ",\"file\":";
+                AppendJsonString(line, definition.file);
+                line += ",\"line\":" + std::to_string(definition.line);
+            }
+            line += ",\"format\":";
+            AppendJsonString(line, definition.format);
+            line += ",\"args\":[";
+            for (size_t i = 0; i < args.size(); ++i) {
+                if (i > 0) line += ',';
+                switch (args[i].code) {
+                    case kInt32:
+                    case kInt64: line += std::to_string(args[i].integer); break;
+                    case kDouble: {
+                        // JSON has no NaN or infinity
+                        if (!std::isfinite(args[i].real)) {
+                            line += "null";
+                            break;
+                        }
+                        char number[32];
+                        std::snprintf(number, sizeof(number), "%.17g", args[i].real);
+                        line += number;
+                        break;
+                    }
+                    case kString: AppendJsonString(line, args[i].text); break;
+                    default: line += std::to_string(args[i].unsignedInteger); break;
+                }
+            }
+            line += "],\"message\":";
+            AppendJsonString(line, message);
+            line += '}';
+        }
+        line += '\n';
+        out.write(line.data(), static_cast<std::streamsize>(line.size()));
+    }
+
+    if (end != data.size()) {
+        return fail("truncated record at end of file");
+    }
+    return true;
+}
+
+} // namespace BinaryLog
+} // namespace Core
+} // namespace GameEngine
@@ -0,0 +1,127 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace GameEngine {
+namespace Core {
+namespace Detail {
+
+// Bounded multi-producer, single-consumer ring of fixed-size text
+// records (Vyukov's sequence-numbered cells). A message longer than one
+// record claims consecutive cells with a single CAS, so the consumer sees
+// every message contiguous and in claim order and simply concatenates
+// record payloads. Producers never lock; when the ring is full they yield
+// until the consumer frees space.
+class LogRing {
+public:
+    static constexpr size_t kRecordSize = 256;
+
+    struct alignas(64) Record {
+        std::atomic<size_t> sequence;
+        uint32_t length;
+        char text[kRecordSize - sizeof(std::atomic<size_t>) - sizeof(uint32_t)];
+    };
+    static constexpr size_t kPayloadSize = sizeof(Record::text);
+
+    // `capacity` is rounded up to a power of two
+    explicit LogRing(size_t capacity) {
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        mask = rounded - 1;
+        records = std::make_unique<Record[]>(rounded);
+        for (size_t i = 0; i < rounded; ++i) {
+            records[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    size_t Capacity() const { return mask + 1; }
+
+    // Copies `length` bytes into the ring, truncated to what fits in the
+    // whole ring. `onFull` is called before every wait for free space.
+    // Returns the position one past the message's last record.
+    template<typename OnFull>
+    size_t Push(const char* text, size_t length, OnFull&& onFull) {
+        size_t count = length == 0 ? 1 : (length + kPayloadSize - 1) / kPayloadSize;
+        if (count > Capacity()) {
+            count = Capacity();
+            length = count * kPayloadSize;
+        }
+
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            bool stale = false;
+            bool full = false;
+            for (size_t i = 0; i < count; ++i) {
+                const size_t seq = records[(pos + i) & mask].sequence.load(std::memory_order_acquire);
+                if (seq != pos + i) {
+                    // Behind the slot's lap: still unread. Ahead: `pos` is stale.
+                    full = static_cast<std::ptrdiff_t>(seq - (pos + i)) < 0;
+                    stale = !full;
+                    break;
+                }
+            }
+            if (!stale && !full &&
+                enqueuePos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                break;
+            }
+            if (full) {
+                onFull();
+                std::this_thread::yield();
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            } else if (stale) {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            Record& record = records[(pos + i) & mask];
+            const size_t chunk = length > kPayloadSize ? kPayloadSize : length;
+            std::memcpy(record.text, text, chunk);
+            record.length = static_cast<uint32_t>(chunk);
+            text += chunk;
+            length -= chunk;
+            record.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return pos + count;
+    }
+
+    // Consumer only. Appends the payloads of up to `maxRecords` published
+    // records to `out`, stopping at the first unpublished one.
+    size_t Drain(std::string& out, size_t maxRecords) {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        size_t drained = 0;
+        while (drained < maxRecords) {
+            Record& record = records[pos & mask];
+            if (record.sequence.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            out.append(record.text, record.length);
+            record.sequence.store(pos + Capacity(), std::memory_order_release);
+            ++pos;
+            ++drained;
+        }
+        dequeuePos.store(pos, std::memory_order_release);
+        return drained;
+    }
+
+    size_t EnqueuePosition() const { return enqueuePos.load(std::memory_order_acquire); }
+    size_t DequeuePosition() const { return dequeuePos.load(std::memory_order_acquire); }
+
+private:
+    std::unique_ptr<Record[]> records;
+    size_t mask;
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) std::atomic<size_t> dequeuePos{0};
+};
+
+static_assert(sizeof(LogRing::Record) == LogRing::kRecordSize, "Log records must be exactly kRecordSize");
+
+} // namespace Detail
+}} // namespace GameEngine::Core
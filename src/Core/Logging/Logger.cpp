@@ -0,0 +1,440 @@
+#include "GameEngine/Core/Logger.h"
+#include "LogRing.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+#include <signal.h>
+#include <time.h>
+
+namespace GameEngine {
+namespace Core {
+
+namespace {
+
+// Records drained per batch write, and how much may be written before the
+// writer flushes even though producers keep it busy
+constexpr size_t kMaxBatchRecords = 256;
+constexpr size_t kFlushBytes = 256 * 1024;
+// Writer poll interval while the ring is empty; producers never signal it
+// on the fast path
+constexpr std::chrono::milliseconds kIdleWait(1);
+// Longest a fatal signal waits for the writer to drain
+constexpr int kCrashDrainMillis = 1000;
+
+const char* LevelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info: return "INFO";
+        case LogLevel::Warning: return "WARNING";
+        case LogLevel::Error: return "ERROR";
+        default: return "UNKNOWN";
+    }
+}
+
+// "[YYYY-MM-DD HH:MM:SS.mmm] ". The date part is cached per thread and
+// only rebuilt when the second changes, so most lines skip localtime.
+void AppendTimestamp(std::string& out) {
+    struct SecondCache {
+        std::time_t second = -1;
+        char text[24] = {};
+    };
+    thread_local SecondCache cache;
+
+    const auto sinceEpoch = std::chrono::system_clock::now().time_since_epoch();
+    const long long millis = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count();
+    const std::time_t second = static_cast<std::time_t>(millis / 1000);
+    if (second != cache.second) {
+        std::tm local{};
+#if defined(_WIN32)
+        localtime_s(&local, &second);
+#else
+        localtime_r(&second, &local);
+#endif
+        std::strftime(cache.text, sizeof(cache.text), "%Y-%m-%d %H:%M:%S", &local);
+        cache.second = second;
+    }
+
+    const int ms = static_cast<int>(millis % 1000);
+    out += '[';
+    out += cache.text;
+    out += '.';
+    out += static_cast<char>('0' + ms / 100);
+    out += static_cast<char>('0' + ms / 10 % 10);
+    out += static_cast<char>('0' + ms % 10);
+    out += "] ";
+}
+
+// Reused per thread so formatting does not allocate once warmed up
+std::string& FormatLine(LogLevel level, const char* text, size_t length) {
+    thread_local std::string line;
+    line.clear();
+    AppendTimestamp(line);
+    line += '[';
+    line += LevelName(level);
+    line += "] ";
+    line.append(text, length);
+    line += '\n';
+    return line;
+}
+
+void AppendU32(std::string& out, uint32_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendString(std::string& out, const char* text) {
+    const size_t length = std::strlen(text);
+    AppendU32(out, static_cast<uint32_t>(length));
+    out.append(text, length);
+}
+
+// Serialized definition record (header included) for one format id
+std::string BuildDefinition(uint32_t id, LogLevel level, const char* format, const char* signature,
+                            const char* file, int line) {
+    std::string record(sizeof(BinaryLog::RecordHeader), '\0');
+    AppendU32(record, id);
+    AppendU32(record, static_cast<uint32_t>(level));
+    AppendU32(record, static_cast<uint32_t>(line));
+    AppendString(record, signature);
+    AppendString(record, format);
+    AppendString(record, file);
+    const BinaryLog::RecordHeader header{BinaryLog::kDefinitionRecord,
+                                         static_cast<uint32_t>(record.size() - sizeof(BinaryLog::RecordHeader)),
+                                         BinaryLog::ReadTimestamp()};
+    std::memcpy(&record[0], &header, sizeof(header));
+    return record;
+}
+
+// Every format id handed out in this process. Ids are never reused, and
+// all definitions are replayed into each newly opened binary log.
+struct FormatRegistry {
+    FormatRegistry() {
+        const LogLevel levels[] = {LogLevel::Debug, LogLevel::Info, LogLevel::Warning, LogLevel::Error};
+        for (LogLevel level : levels) {
+            definitions.push_back(BuildDefinition(BinaryLog::kFirstTextFormat + static_cast<uint32_t>(level), level,
+                                                  "%s", "s", "", 0));
+        }
+    }
+
+    std::mutex mutex;
+    std::vector<std::string> definitions;
+    uint32_t nextId = BinaryLog::kFirstEventFormat;
+};
+
+FormatRegistry& GetFormatRegistry() {
+    static FormatRegistry registry;
+    return registry;
+}
+
+constexpr int kFatalSignals[] = {SIGSEGV, SIGABRT, SIGFPE, SIGILL};
+constexpr size_t kFatalSignalCount = sizeof(kFatalSignals) / sizeof(kFatalSignals[0]);
+
+} // namespace
+
+struct Logger::AsyncBackend {
+    AsyncBackend(std::ostream& out_, size_t records) : ring(records), out(out_) {
+        writer = std::thread([this] { Run(); });
+    }
+
+    ~AsyncBackend() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        writer.join();
+    }
+
+    void Push(const char* data, size_t size) {
+        ring.Push(data, size, [this] { wake.notify_one(); });
+    }
+
+    void Flush() {
+        const size_t target = ring.EnqueuePosition();
+        wake.notify_one();
+        std::unique_lock<std::mutex> lock(mutex);
+        written.wait(lock, [&] { return writtenPos.load(std::memory_order_acquire) >= target; });
+    }
+
+    // Async-signal context: no locks, just wait for the writer to catch up
+    void DrainForCrash() {
+        if (std::this_thread::get_id() == writer.get_id()) {
+            return;
+        }
+        const size_t target = ring.EnqueuePosition();
+        const timespec oneMilli{0, 1000000};
+        for (int i = 0; i < kCrashDrainMillis && writtenPos.load(std::memory_order_acquire) < target; ++i) {
+            // nanosleep is async-signal-safe; std::this_thread::sleep_for is not
+            nanosleep(&oneMilli, nullptr);
+        }
+    }
+
+    void Run() {
+        std::string batch;
+        batch.reserve(kMaxBatchRecords * Detail::LogRing::kPayloadSize);
+        size_t unflushed = 0;
+        for (;;) {
+            const size_t drained = ring.Drain(batch, kMaxBatchRecords);
+            if (drained > 0) {
+                out.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+                unflushed += batch.size();
+                batch.clear();
+                if (drained == kMaxBatchRecords && unflushed < kFlushBytes) {
+                    continue;
+                }
+            }
+            if (unflushed > 0) {
+                out.flush();
+                unflushed = 0;
+                writtenPos.store(ring.DequeuePosition(), std::memory_order_release);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                }
+                written.notify_all();
+            }
+            if (drained > 0) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            if (stopping && ring.DequeuePosition() == ring.EnqueuePosition()) {
+                break;
+            }
+            wake.wait_for(lock, kIdleWait);
+        }
+    }
+
+    // Fatal signals wait for the writer to drain, then chain to whatever
+    // action was installed before, SA_SIGINFO handlers included
+    static void InstallCrashHandlers(AsyncBackend* backend) {
+        crashBackend.store(backend, std::memory_order_release);
+        struct sigaction action;
+        std::memset(&action, 0, sizeof(action));
+        action.sa_sigaction = &OnFatalSignal;
+        action.sa_flags = SA_SIGINFO;
+        sigemptyset(&action.sa_mask);
+        for (size_t i = 0; i < kFatalSignalCount; ++i) {
+            if (sigaction(kFatalSignals[i], &action, &previousActions[i]) != 0) {
+                std::memset(&previousActions[i], 0, sizeof(previousActions[i]));
+                previousActions[i].sa_handler = SIG_DFL;
+            }
+        }
+    }
+
+    static void RemoveCrashHandlers() {
+        crashBackend.store(nullptr, std::memory_order_release);
+        for (size_t i = 0; i < kFatalSignalCount; ++i) {
+            sigaction(kFatalSignals[i], &previousActions[i], nullptr);
+        }
+    }
+
+    static void OnFatalSignal(int signal, siginfo_t* info, void*) {
+        if (AsyncBackend* backend = crashBackend.load(std::memory_order_acquire)) {
+            backend->DrainForCrash();
+        }
+        for (size_t i = 0; i < kFatalSignalCount; ++i) {
+            if (kFatalSignals[i] == signal) {
+                sigaction(signal, &previousActions[i], nullptr);
+            }
+        }
+        // A fault raised by the kernel recurs when the handler returns, so
+        // the previous action sees the original siginfo and context. Sent
+        // signals (abort, kill) are sent again; this one is blocked until
+        // the handler returns.
+        if (info != nullptr && info->si_code > 0) {
+            return;
+        }
+        raise(signal);
+    }
+
+    static std::atomic<AsyncBackend*> crashBackend;
+    static struct sigaction previousActions[kFatalSignalCount];
+
+    Detail::LogRing ring;
+    std::ostream& out;
+    std::thread writer;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable written;
+    std::atomic<size_t> writtenPos{0};
+    bool stopping = false;
+};
+
+std::atomic<Logger::AsyncBackend*> Logger::AsyncBackend::crashBackend{nullptr};
+struct sigaction Logger::AsyncBackend::previousActions[kFatalSignalCount];
+
+Logger::Logger() : currentLevel(LogLevel::Debug), mode(LogMode::Synchronous) {}
+
+Logger::~Logger() {
+    Shutdown();
+}
+
+void Logger::Initialize(const std::string& filename, LogLevel level, LogMode mode_, size_t asyncRecords) {
+    Shutdown();
+
+    currentLevel.store(level, std::memory_order_relaxed);
+    if (mode_ == LogMode::Binary) {
+        logFile.open(filename, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!logFile.is_open()) {
+            // Binary records are useless on a console; fall back to text
+            mode_ = LogMode::Asynchronous;
+        } else {
+            BinaryLog::FileHeader header{};
+            std::memcpy(header.magic, BinaryLog::kMagic, sizeof(header.magic));
+            header.version = BinaryLog::kVersion;
+            logFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        }
+    } else {
+        logFile.open(filename, std::ios::out | std::ios::trunc);
+    }
+
+    if (mode_ != LogMode::Synchronous) {
+        std::ostream& out = logFile.is_open() ? static_cast<std::ostream&>(logFile) : std::clog;
+        async = std::make_unique<AsyncBackend>(out, asyncRecords);
+        AsyncBackend::InstallCrashHandlers(async.get());
+    }
+
+    if (mode_ == LogMode::Binary) {
+        FormatRegistry& registry = GetFormatRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        mode = mode_;
+        for (const std::string& definition : registry.definitions) {
+            PushRecord(definition.data(), definition.size());
+        }
+        EmitClockSync();
+    } else {
+        mode = mode_;
+    }
+}
+
+void Logger::Log(LogLevel level, const std::string& message) {
+    if (!IsEnabled(level)) {
+        return;
+    }
+    LogText(level, message.data(), message.size());
+}
+
+void Logger::Write(LogLevel level, const char* format, ...) {
+    if (!IsEnabled(level)) {
+        return;
+    }
+    char buffer[kMaxFormattedMessage];
+    va_list args;
+    va_start(args, format);
+    const int written = std::vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (written < 0) {
+        return;
+    }
+    size_t length = static_cast<size_t>(written);
+    if (length >= sizeof(buffer)) {
+        length = sizeof(buffer) - 1;
+        std::memcpy(buffer + length - 3, "...", 3);
+    }
+    LogText(level, buffer, length);
+}
+
+void Logger::LogText(LogLevel level, const char* text, size_t length) {
+    if (mode == LogMode::Binary) {
+        struct {
+            BinaryLog::RecordHeader header;
+            uint32_t length;
+            char text[BinaryLog::kMaxEventPayload - sizeof(uint32_t)];
+        } record;
+        if (length > sizeof(record.text)) {
+            length = sizeof(record.text);
+        }
+        record.header = {BinaryLog::kFirstTextFormat + static_cast<uint32_t>(level),
+                         static_cast<uint32_t>(sizeof(uint32_t) + length), BinaryLog::ReadTimestamp()};
+        record.length = static_cast<uint32_t>(length);
+        std::memcpy(record.text, text, length);
+        PushRecord(reinterpret_cast<const char*>(&record), sizeof(record.header) + record.header.size);
+        return;
+    }
+
+    const std::string& line = FormatLine(level, text, length);
+    if (async) {
+        async->Push(line.data(), line.size());
+    } else {
+        WriteLine(line);
+    }
+}
+
+void Logger::PushRecord(const char* record, size_t size) {
+    if (async) {
+        async->Push(record, size);
+    }
+}
+
+uint32_t Logger::RegisterEventSite(BinaryLog::Site& site, LogLevel level, const char* format,
+                                   const char* signature) {
+    FormatRegistry& registry = GetFormatRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    uint32_t id = site.id.load(std::memory_order_relaxed);
+    if (id != 0) {
+        return id;
+    }
+    id = registry.nextId++;
+    registry.definitions.push_back(BuildDefinition(id, level, format, signature, site.file, site.line));
+    // Pushed before the id is published, so the definition always precedes
+    // the site's first event in the ring
+    if (mode == LogMode::Binary) {
+        PushRecord(registry.definitions.back().data(), registry.definitions.back().size());
+    }
+    site.id.store(id, std::memory_order_release);
+    return id;
+}
+
+void Logger::EmitClockSync() {
+    struct {
+        BinaryLog::RecordHeader header;
+        int64_t systemNanos;
+    } record;
+    record.systemNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::system_clock::now().time_since_epoch())
+                             .count();
+    record.header = {BinaryLog::kClockSyncRecord, sizeof(record.systemNanos), BinaryLog::ReadTimestamp()};
+    PushRecord(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+void Logger::WriteLine(const std::string& line) {
+    std::lock_guard<std::mutex> lock(fileMutex);
+    std::ostream& out = logFile.is_open() ? static_cast<std::ostream&>(logFile) : std::clog;
+    out.write(line.data(), static_cast<std::streamsize>(line.size()));
+    out.flush();
+}
+
+void Logger::Flush() {
+    if (async) {
+        if (mode == LogMode::Binary) {
+            EmitClockSync();
+        }
+        async->Flush();
+        return;
+    }
+    std::lock_guard<std::mutex> lock(fileMutex);
+    logFile.flush();
+}
+
+void Logger::Shutdown() {
+    if (mode == LogMode::Binary) {
+        EmitClockSync();
+    }
+    if (async) {
+        AsyncBackend::RemoveCrashHandlers();
+        async.reset();
+    }
+    mode = LogMode::Synchronous;
+    std::lock_guard<std::mutex> lock(fileMutex);
+    if (logFile.is_open()) {
+        logFile.close();
+    }
+}
+
+} // namespace Core
+} // namespace GameEngine
@@ -0,0 +1,18 @@
+#include "GameEngine/Core/FastMath.h"
+#include "SimdKernels.h"
+
+namespace GameEngine {
+namespace Math {
+namespace Fast {
+
+void SinCosBatch(const float* angles, float* sines, float* cosines, size_t count) {
+    Math::Detail::GetMathKernels().fastSinCos(angles, sines, cosines, count);
+}
+
+void NormalizeBatch(const Vector3* in, Vector3* out, size_t count) {
+    Math::Detail::GetMathKernels().fastNormalize(reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count);
+}
+
+} // namespace Fast
+} // namespace Math
+} // namespace GameEngine
@@ -0,0 +1,27 @@
+#include "GameEngine/Core/Math.h"
+#include "SimdKernels.h"
+
+namespace GameEngine {
+namespace Math {
+
+static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Batch kernels expect tightly packed Quaternion");
+
+void NlerpBatch(const Quaternion* a, const Quaternion* b, const float* t, Quaternion* out, size_t count) {
+    Detail::GetMathKernels().nlerp(reinterpret_cast<const float*>(a), reinterpret_cast<const float*>(b), t,
+                                   reinterpret_cast<float*>(out), count);
+}
+
+void SlerpBatch(const Quaternion* a, const Quaternion* b, const float* t, Quaternion* out, size_t count) {
+    Detail::GetMathKernels().slerp(reinterpret_cast<const float*>(a), reinterpret_cast<const float*>(b), t,
+                                   reinterpret_cast<float*>(out), count);
+}
+
+void ComposeTRS(const Vector3* positions, const Quaternion* rotations, const Vector3* scales,
+                Matrix4* out, size_t count) {
+    static_assert(sizeof(Matrix4) == 16 * sizeof(float), "Batch kernels expect tightly packed Matrix4");
+    Detail::GetMathKernels().composeTRS(reinterpret_cast<const float*>(positions), reinterpret_cast<const float*>(rotations),
+                                        reinterpret_cast<const float*>(scales), reinterpret_cast<float*>(out), count);
+}
+
+} // namespace Math
+} // namespace GameEngine
@@ -0,0 +1,161 @@
+#include "SimdKernels.h"
+#include <atomic>
+
+#if GE_SIMD_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace GameEngine {
+namespace Math {
+
+namespace {
+
+#if GE_SIMD_X86
+struct CpuFeatures {
+    bool sse41 = false;
+    bool avx2 = false;
+    bool fma = false;
+};
+
+void QueryCpuid(unsigned leaf, unsigned subleaf, unsigned regs[4]) {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) {
+        regs[i] = static_cast<unsigned>(info[i]);
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// XCR0 tells whether the OS saves the YMM registers on context switch.
+unsigned long long ReadXcr0() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned eax = 0, edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+
+CpuFeatures DetectCpuFeatures() {
+    CpuFeatures features;
+    unsigned regs[4] = {0, 0, 0, 0};
+
+    QueryCpuid(0, 0, regs);
+    const unsigned maxLeaf = regs[0];
+    if (maxLeaf < 1) {
+        return features;
+    }
+
+    QueryCpuid(1, 0, regs);
+    const unsigned ecx1 = regs[2];
+    features.sse41 = (ecx1 & (1u << 19)) != 0;
+    features.fma = (ecx1 & (1u << 12)) != 0;
+    const bool osxsave = (ecx1 & (1u << 27)) != 0;
+    const bool avx = (ecx1 & (1u << 28)) != 0;
+    const bool ymmEnabled = osxsave && (ReadXcr0() & 0x6) == 0x6;
+
+    if (maxLeaf >= 7 && avx && ymmEnabled) {
+        QueryCpuid(7, 0, regs);
+        features.avx2 = (regs[1] & (1u << 5)) != 0;
+    }
+    return features;
+}
+
+const CpuFeatures& GetCpuFeatures() {
+    static const CpuFeatures features = DetectCpuFeatures();
+    return features;
+}
+#endif // GE_SIMD_X86
+
+const Detail::MathKernels& KernelsFor(SimdBackend backend) {
+    switch (backend) {
+#if GE_SIMD_X86
+        case SimdBackend::AVX2: return Detail::AVX2Kernels;
+        case SimdBackend::SSE41: return Detail::SSE41Kernels;
+#endif
+        case SimdBackend::Scalar:
+        default: return Detail::ScalarKernels;
+    }
+}
+
+SimdBackend DetectBestSimdBackend() {
+    if (IsSimdBackendSupported(SimdBackend::AVX2)) return SimdBackend::AVX2;
+    if (IsSimdBackendSupported(SimdBackend::SSE41)) return SimdBackend::SSE41;
+    return SimdBackend::Scalar;
+}
+
+struct ActiveBackend {
+    std::atomic<SimdBackend> backend;
+    std::atomic<const Detail::MathKernels*> kernels;
+
+    ActiveBackend() {
+        const SimdBackend best = DetectBestSimdBackend();
+        backend.store(best);
+        kernels.store(&KernelsFor(best));
+    }
+};
+
+// Function-local so kernels are usable from other static initializers.
+ActiveBackend& GetActiveBackend() {
+    static ActiveBackend active;
+    return active;
+}
+
+} // namespace
+
+namespace Detail {
+
+const MathKernels& GetMathKernels() {
+    return *GetActiveBackend().kernels.load(std::memory_order_relaxed);
+}
+
+void MultiplyMatrix4(const float* a, const float* b, float* out) noexcept {
+    GetMathKernels().multiply(a, b, out);
+}
+
+} // namespace Detail
+
+SimdBackend GetSimdBackend() {
+    return GetActiveBackend().backend.load(std::memory_order_relaxed);
+}
+
+bool IsSimdBackendSupported(SimdBackend backend) {
+    switch (backend) {
+        case SimdBackend::Scalar: return true;
+#if GE_SIMD_X86
+        case SimdBackend::SSE41: return GetCpuFeatures().sse41;
+        case SimdBackend::AVX2: return GetCpuFeatures().avx2 && GetCpuFeatures().fma;
+#endif
+        default: return false;
+    }
+}
+
+bool SetSimdBackend(SimdBackend backend) {
+    if (!IsSimdBackendSupported(backend)) {
+        return false;
+    }
+    ActiveBackend& active = GetActiveBackend();
+    active.backend.store(backend, std::memory_order_relaxed);
+    active.kernels.store(&KernelsFor(backend), std::memory_order_relaxed);
+    return true;
+}
+
+const char* GetSimdBackendName(SimdBackend backend) {
+    switch (backend) {
+        case SimdBackend::Scalar: return "Scalar";
+        case SimdBackend::SSE41: return "SSE4.1";
+        case SimdBackend::AVX2: return "AVX2";
+        default: return "Unknown";
+    }
+}
+
+} // namespace Math
+} // namespace GameEngine
@@ -0,0 +1,104 @@
+#pragma once
+#include "GameEngine/Core/Math.h"
+#include "GameEngine/Core/FastMath.h"
+#include <cstddef>
+
+// Internal to the math library: per-backend kernel tables and the
+// target attributes used to compile them without global -m flags.
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define GE_SIMD_X86 1
+#else
+#define GE_SIMD_X86 0
+#endif
+
+#if GE_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#define GE_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define GE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define GE_TARGET_SSE41
+#define GE_TARGET_AVX2
+#endif
+
+namespace GameEngine {
+namespace Math {
+namespace Detail {
+
+// Matrices are 16 column-major floats, points/directions are 3 floats,
+// quaternions are 4 floats (x, y, z, w).
+// Single-point transforms are inline in Math.h. Batch kernels take `w` = 1
+// for points and 0 for directions, which scales the translation column once
+// per call rather than per element.
+struct MathKernels {
+    void (*multiply)(const float* a, const float* b, float* out);
+
+    // Tightly packed xyz triples; in == out is allowed.
+    void (*transformPacked)(const float* m, const float* in, float* out, size_t count, float w);
+    // Byte strides between consecutive triples.
+    void (*transformStrided)(const float* m, const char* in, size_t inStride,
+                             char* out, size_t outStride, size_t count, float w);
+    // in/out hold the x, y and z streams.
+    void (*transformSoA)(const float* m, const float* const in[3], float* const out[3],
+                         size_t count, float w);
+
+    // out[i] = Nlerp/Slerp(a[i], b[i], t[i]); out may alias a or b.
+    void (*nlerp)(const float* a, const float* b, const float* t, float* out, size_t count);
+    void (*slerp)(const float* a, const float* b, const float* t, float* out, size_t count);
+    // out[i] = translation * rotation * scale as a column-major Matrix4.
+    void (*composeTRS)(const float* positions, const float* rotations, const float* scales,
+                       float* out, size_t count);
+
+    // Math::Fast batch paths (see FastMath.h for the error bounds).
+    void (*fastSinCos)(const float* angles, float* sines, float* cosines, size_t count);
+    // Packed xyz triples; in == out is allowed.
+    void (*fastNormalize)(const float* in, float* out, size_t count);
+};
+
+// Single-element reference paths, shared by the scalar kernels and the
+// SIMD tail loops.
+inline Quaternion LoadQuaternion(const float* q) {
+    return Quaternion(q[0], q[1], q[2], q[3]);
+}
+
+inline void StoreQuaternion(float* out, const Quaternion& q) {
+    out[0] = q.x;
+    out[1] = q.y;
+    out[2] = q.z;
+    out[3] = q.w;
+}
+
+inline void NlerpOne(const float* a, const float* b, float t, float* out) {
+    StoreQuaternion(out, Quaternion::Nlerp(LoadQuaternion(a), LoadQuaternion(b), t));
+}
+
+inline void SlerpOne(const float* a, const float* b, float t, float* out) {
+    StoreQuaternion(out, Quaternion::Slerp(LoadQuaternion(a), LoadQuaternion(b), t));
+}
+
+inline void FastNormalizeOne(const float* in, float* out) {
+    const Vector3 v = Fast::Normalized(Vector3(in[0], in[1], in[2]));
+    out[0] = v.x;
+    out[1] = v.y;
+    out[2] = v.z;
+}
+
+inline void ComposeTRSOne(const float* position, const float* rotation, const float* scale, float* out) {
+    const Matrix4 m = Matrix4::trs(Vector3(position[0], position[1], position[2]), LoadQuaternion(rotation),
+                                   Vector3(scale[0], scale[1], scale[2]));
+    const float* data = m.data();
+    for (int i = 0; i < 16; ++i) {
+        out[i] = data[i];
+    }
+}
+
+extern const MathKernels ScalarKernels;
+#if GE_SIMD_X86
+extern const MathKernels SSE41Kernels;
+extern const MathKernels AVX2Kernels;
+#endif
+
+const MathKernels& GetMathKernels();
+
+} // namespace Detail
+} // namespace Math
+} // namespace GameEngine
@@ -0,0 +1,413 @@
+#include "SimdKernels.h"
+
+#if GE_SIMD_X86
+#include <immintrin.h>
+
+namespace GameEngine {
+namespace Math {
+namespace Detail {
+
+namespace {
+
+GE_TARGET_AVX2 inline __m256 LoadColumnTwice(const float* column) {
+    const __m128 c = _mm_loadu_ps(column);
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(c), c, 1);
+}
+
+// Computes two result columns per iteration: each 128-bit lane holds one
+// column of b, and _mm256_permute_ps broadcasts its elements in-lane.
+GE_TARGET_AVX2 void MultiplyAVX2(const float* a, const float* b, float* out) {
+    const __m256 a0 = LoadColumnTwice(a);
+    const __m256 a1 = LoadColumnTwice(a + 4);
+    const __m256 a2 = LoadColumnTwice(a + 8);
+    const __m256 a3 = LoadColumnTwice(a + 12);
+
+    for (int pair = 0; pair < 2; ++pair) {
+        const __m256 bc = _mm256_loadu_ps(b + pair * 8);
+        __m256 r = _mm256_mul_ps(a0, _mm256_permute_ps(bc, 0x00));
+        r = _mm256_fmadd_ps(a1, _mm256_permute_ps(bc, 0x55), r);
+        r = _mm256_fmadd_ps(a2, _mm256_permute_ps(bc, 0xAA), r);
+        r = _mm256_fmadd_ps(a3, _mm256_permute_ps(bc, 0xFF), r);
+        _mm256_storeu_ps(out + pair * 8, r);
+    }
+}
+
+GE_TARGET_AVX2 inline void StoreVector3(float* out, __m128 v) {
+    out[0] = _mm_cvtss_f32(v);
+    out[1] = _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+    out[2] = _mm_cvtss_f32(_mm_movehl_ps(v, v));
+}
+
+GE_TARGET_AVX2 inline __m256 LoadLanes(const float* lo, const float* hi) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+}
+
+GE_TARGET_AVX2 inline void StoreLanes(float* lo, float* hi, __m256 v) {
+    _mm_storeu_ps(lo, _mm256_castps256_ps128(v));
+    _mm_storeu_ps(hi, _mm256_extractf128_ps(v, 1));
+}
+
+// Same blend/shuffle transpose as the SSE4.1 kernel, done in both 128-bit
+// lanes at once: points 0-3 in the low lane, 4-7 in the high lane.
+GE_TARGET_AVX2 inline void LoadPacked8(const float* in, __m256& x, __m256& y, __m256& z) {
+    const __m256 v0 = LoadLanes(in, in + 12);
+    const __m256 v1 = LoadLanes(in + 4, in + 16);
+    const __m256 v2 = LoadLanes(in + 8, in + 20);
+    const __m256 tx = _mm256_blend_ps(_mm256_blend_ps(v0, v1, 0x44), v2, 0x22);
+    const __m256 ty = _mm256_blend_ps(_mm256_blend_ps(v0, v1, 0x99), v2, 0x44);
+    const __m256 tz = _mm256_blend_ps(_mm256_blend_ps(v0, v1, 0x22), v2, 0x99);
+    x = _mm256_shuffle_ps(tx, tx, _MM_SHUFFLE(1, 2, 3, 0));
+    y = _mm256_shuffle_ps(ty, ty, _MM_SHUFFLE(2, 3, 0, 1));
+    z = _mm256_shuffle_ps(tz, tz, _MM_SHUFFLE(3, 0, 1, 2));
+}
+
+GE_TARGET_AVX2 inline void StorePacked8(float* out, __m256 x, __m256 y, __m256 z) {
+    const __m256 tx = _mm256_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+    const __m256 ty = _mm256_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+    const __m256 tz = _mm256_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+    StoreLanes(out, out + 12, _mm256_blend_ps(_mm256_blend_ps(tx, ty, 0x22), tz, 0x44));
+    StoreLanes(out + 4, out + 16, _mm256_blend_ps(_mm256_blend_ps(ty, tz, 0x22), tx, 0x44));
+    StoreLanes(out + 8, out + 20, _mm256_blend_ps(_mm256_blend_ps(tz, tx, 0x22), ty, 0x44));
+}
+
+struct BroadcastMatrix {
+    __m256 m[9];
+    __m256 t[3];
+};
+
+GE_TARGET_AVX2 inline BroadcastMatrix Broadcast(const float* m, float w) {
+    BroadcastMatrix b;
+    const int linear[9] = {0, 4, 8, 1, 5, 9, 2, 6, 10};
+    for (int i = 0; i < 9; ++i) {
+        b.m[i] = _mm256_set1_ps(m[linear[i]]);
+    }
+    for (int i = 0; i < 3; ++i) {
+        b.t[i] = _mm256_set1_ps(m[12 + i] * w);
+    }
+    return b;
+}
+
+GE_TARGET_AVX2 inline void TransformLanes(const BroadcastMatrix& b, __m256& x, __m256& y, __m256& z) {
+    const __m256 rx = _mm256_fmadd_ps(b.m[2], z, _mm256_fmadd_ps(b.m[1], y, _mm256_fmadd_ps(b.m[0], x, b.t[0])));
+    const __m256 ry = _mm256_fmadd_ps(b.m[5], z, _mm256_fmadd_ps(b.m[4], y, _mm256_fmadd_ps(b.m[3], x, b.t[1])));
+    const __m256 rz = _mm256_fmadd_ps(b.m[8], z, _mm256_fmadd_ps(b.m[7], y, _mm256_fmadd_ps(b.m[6], x, b.t[2])));
+    x = rx;
+    y = ry;
+    z = rz;
+}
+
+GE_TARGET_AVX2 inline void TransformOneAVX2(const float* m, __m128 t, const float* in, float* out) {
+    __m128 r = _mm_fmadd_ps(_mm_loadu_ps(m), _mm_set1_ps(in[0]), t);
+    r = _mm_fmadd_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(in[1]), r);
+    r = _mm_fmadd_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(in[2]), r);
+    StoreVector3(out, r);
+}
+
+GE_TARGET_AVX2 void TransformPackedAVX2(const float* m, const float* in, float* out, size_t count, float w) {
+    const BroadcastMatrix b = Broadcast(m, w);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 x, y, z;
+        LoadPacked8(in + i * 3, x, y, z);
+        TransformLanes(b, x, y, z);
+        StorePacked8(out + i * 3, x, y, z);
+    }
+    const __m128 t = _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(w));
+    for (; i < count; ++i) {
+        TransformOneAVX2(m, t, in + i * 3, out + i * 3);
+    }
+}
+
+GE_TARGET_AVX2 void TransformStridedAVX2(const float* m, const char* in, size_t inStride,
+                                         char* out, size_t outStride, size_t count, float w) {
+    const __m128 t = _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(w));
+    for (size_t i = 0; i < count; ++i) {
+        TransformOneAVX2(m, t, reinterpret_cast<const float*>(in + i * inStride),
+                         reinterpret_cast<float*>(out + i * outStride));
+    }
+}
+
+GE_TARGET_AVX2 void TransformSoAAVX2(const float* m, const float* const in[3], float* const out[3],
+                                     size_t count, float w) {
+    const BroadcastMatrix b = Broadcast(m, w);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_loadu_ps(in[0] + i);
+        __m256 y = _mm256_loadu_ps(in[1] + i);
+        __m256 z = _mm256_loadu_ps(in[2] + i);
+        TransformLanes(b, x, y, z);
+        _mm256_storeu_ps(out[0] + i, x);
+        _mm256_storeu_ps(out[1] + i, y);
+        _mm256_storeu_ps(out[2] + i, z);
+    }
+    const float tx = m[12] * w, ty = m[13] * w, tz = m[14] * w;
+    for (; i < count; ++i) {
+        const float x = in[0][i], y = in[1][i], z = in[2][i];
+        out[0][i] = m[0] * x + m[4] * y + m[8] * z + tx;
+        out[1][i] = m[1] * x + m[5] * y + m[9] * z + ty;
+        out[2][i] = m[2] * x + m[6] * y + m[10] * z + tz;
+    }
+}
+
+// 4x4 transpose within each 128-bit lane (its own inverse). With rows
+// loaded via LoadLanes(q + k * 4, q + (k + 4) * 4) it turns eight
+// quaternions (or matrix columns) into x, y, z, w lanes.
+GE_TARGET_AVX2 inline void TransposeLanes4(__m256& r0, __m256& r1, __m256& r2, __m256& r3) {
+    const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+struct Quat8 {
+    __m256 x, y, z, w;
+};
+
+GE_TARGET_AVX2 inline Quat8 LoadQuat8(const float* q) {
+    Quat8 r = {LoadLanes(q, q + 16), LoadLanes(q + 4, q + 20), LoadLanes(q + 8, q + 24), LoadLanes(q + 12, q + 28)};
+    TransposeLanes4(r.x, r.y, r.z, r.w);
+    return r;
+}
+
+GE_TARGET_AVX2 inline void StoreQuat8(float* out, Quat8 q) {
+    TransposeLanes4(q.x, q.y, q.z, q.w);
+    StoreLanes(out, out + 16, q.x);
+    StoreLanes(out + 4, out + 20, q.y);
+    StoreLanes(out + 8, out + 24, q.z);
+    StoreLanes(out + 12, out + 28, q.w);
+}
+
+GE_TARGET_AVX2 inline __m256 Dot(const Quat8& a, const Quat8& b) {
+    return _mm256_fmadd_ps(a.w, b.w, _mm256_fmadd_ps(a.z, b.z, _mm256_fmadd_ps(a.y, b.y, _mm256_mul_ps(a.x, b.x))));
+}
+
+GE_TARGET_AVX2 inline Quat8 Scale(const Quat8& q, __m256 s) {
+    return {_mm256_mul_ps(q.x, s), _mm256_mul_ps(q.y, s), _mm256_mul_ps(q.z, s), _mm256_mul_ps(q.w, s)};
+}
+
+GE_TARGET_AVX2 inline Quat8 Combine(const Quat8& a, __m256 sa, const Quat8& b, __m256 sb) {
+    return {_mm256_fmadd_ps(a.x, sa, _mm256_mul_ps(b.x, sb)),
+            _mm256_fmadd_ps(a.y, sa, _mm256_mul_ps(b.y, sb)),
+            _mm256_fmadd_ps(a.z, sa, _mm256_mul_ps(b.z, sb)),
+            _mm256_fmadd_ps(a.w, sa, _mm256_mul_ps(b.w, sb))};
+}
+
+GE_TARGET_AVX2 inline Quat8 FlipSign(const Quat8& q, __m256 signBits) {
+    return {_mm256_xor_ps(q.x, signBits), _mm256_xor_ps(q.y, signBits),
+            _mm256_xor_ps(q.z, signBits), _mm256_xor_ps(q.w, signBits)};
+}
+
+// Same polynomials as the SSE4.1 kernels, evaluated with FMA.
+GE_TARGET_AVX2 inline __m256 AcosPoly(__m256 x) {
+    __m256 p = _mm256_set1_ps(-0.0012624911f);
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(0.0066700901f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(-0.0170881256f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(0.0308918810f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(-0.0501743046f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(0.0889789874f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(-0.2145988016f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(1.5707963050f));
+    return _mm256_mul_ps(p, _mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), x)));
+}
+
+GE_TARGET_AVX2 inline __m256 SinPoly(__m256 x) {
+    const __m256 x2 = _mm256_mul_ps(x, x);
+    __m256 p = _mm256_set1_ps(-2.5052108e-8f);
+    p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(2.7557319e-6f));
+    p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(-1.9841270e-4f));
+    p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(8.3333333e-3f));
+    p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(-1.6666667e-1f));
+    p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(1.0f));
+    return _mm256_mul_ps(p, x);
+}
+
+GE_TARGET_AVX2 inline __m256 InverseLength(const Quat8& q) {
+    return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(Dot(q, q)));
+}
+
+GE_TARGET_AVX2 void NlerpAVX2(const float* a, const float* b, const float* t, float* out, size_t count) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const Quat8 qa = LoadQuat8(a + i * 4);
+        Quat8 qb = LoadQuat8(b + i * 4);
+        const __m256 tt = _mm256_loadu_ps(t + i);
+        qb = FlipSign(qb, _mm256_and_ps(Dot(qa, qb), signMask));
+        const Quat8 r = Combine(qa, _mm256_sub_ps(one, tt), qb, tt);
+        StoreQuat8(out + i * 4, Scale(r, InverseLength(r)));
+    }
+    for (; i < count; ++i) {
+        NlerpOne(a + i * 4, b + i * 4, t[i], out + i * 4);
+    }
+}
+
+GE_TARGET_AVX2 void SlerpAVX2(const float* a, const float* b, const float* t, float* out, size_t count) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 threshold = _mm256_set1_ps(Quaternion::kSlerpNlerpThreshold);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const Quat8 qa = LoadQuat8(a + i * 4);
+        Quat8 qb = LoadQuat8(b + i * 4);
+        const __m256 tt = _mm256_loadu_ps(t + i);
+        const __m256 oneMinusT = _mm256_sub_ps(one, tt);
+
+        __m256 cosTheta = Dot(qa, qb);
+        const __m256 sign = _mm256_and_ps(cosTheta, signMask);
+        qb = FlipSign(qb, sign);
+        cosTheta = _mm256_min_ps(_mm256_xor_ps(cosTheta, sign), one);
+        const __m256 nearlyParallel = _mm256_cmp_ps(cosTheta, threshold, _CMP_GT_OQ);
+
+        const __m256 theta = AcosPoly(cosTheta);
+        const __m256 invSin = _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_fnmadd_ps(cosTheta, cosTheta, one)));
+        const __m256 sa = _mm256_blendv_ps(_mm256_mul_ps(SinPoly(_mm256_mul_ps(oneMinusT, theta)), invSin), oneMinusT, nearlyParallel);
+        const __m256 sb = _mm256_blendv_ps(_mm256_mul_ps(SinPoly(_mm256_mul_ps(tt, theta)), invSin), tt, nearlyParallel);
+
+        const Quat8 r = Combine(qa, sa, qb, sb);
+        const __m256 norm = _mm256_blendv_ps(one, InverseLength(r), nearlyParallel);
+        StoreQuat8(out + i * 4, Scale(r, norm));
+    }
+    for (; i < count; ++i) {
+        SlerpOne(a + i * 4, b + i * 4, t[i], out + i * 4);
+    }
+}
+
+// Writes column `col` of eight consecutive matrices from SoA lanes.
+GE_TARGET_AVX2 inline void StoreColumn8(float* out, int col, __m256 x, __m256 y, __m256 z, __m256 w) {
+    TransposeLanes4(x, y, z, w);
+    StoreLanes(out + col * 4, out + 64 + col * 4, x);
+    StoreLanes(out + 16 + col * 4, out + 80 + col * 4, y);
+    StoreLanes(out + 32 + col * 4, out + 96 + col * 4, z);
+    StoreLanes(out + 48 + col * 4, out + 112 + col * 4, w);
+}
+
+// Same expressions as Matrix4::trs; the compiler may contract them into
+// FMA here, so results can differ from the scalar path by an ulp or two.
+GE_TARGET_AVX2 void ComposeTRSAVX2(const float* positions, const float* rotations, const float* scales,
+                                   float* out, size_t count) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const Quat8 q = LoadQuat8(rotations + i * 4);
+        __m256 px, py, pz, sx, sy, sz;
+        LoadPacked8(positions + i * 3, px, py, pz);
+        LoadPacked8(scales + i * 3, sx, sy, sz);
+
+        const __m256 xx = _mm256_mul_ps(q.x, q.x), yy = _mm256_mul_ps(q.y, q.y), zz = _mm256_mul_ps(q.z, q.z);
+        const __m256 xy = _mm256_mul_ps(q.x, q.y), xz = _mm256_mul_ps(q.x, q.z), yz = _mm256_mul_ps(q.y, q.z);
+        const __m256 wx = _mm256_mul_ps(q.w, q.x), wy = _mm256_mul_ps(q.w, q.y), wz = _mm256_mul_ps(q.w, q.z);
+
+        float* m = out + i * 16;
+        StoreColumn8(m, 0,
+                     _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz))), sx),
+                     _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), sx),
+                     _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), sx), zero);
+        StoreColumn8(m, 1,
+                     _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), sy),
+                     _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz))), sy),
+                     _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), sy), zero);
+        StoreColumn8(m, 2,
+                     _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), sz),
+                     _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), sz),
+                     _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy))), sz), zero);
+        StoreColumn8(m, 3, px, py, pz, one);
+    }
+    for (; i < count; ++i) {
+        ComposeTRSOne(positions + i * 3, rotations + i * 4, scales + i * 3, out + i * 16);
+    }
+}
+
+// Same reduction and polynomials as the SSE4.1 SinCosLanes, with FMA.
+GE_TARGET_AVX2 inline void SinCosLanes(__m256 x, __m256& s, __m256& c) {
+    const __m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(Fast::Detail::kTwoOverPi)));
+    const __m256 k = _mm256_cvtepi32_ps(quadrant);
+    __m256 r = _mm256_fnmadd_ps(k, _mm256_set1_ps(Fast::Detail::kPiOver2A), x);
+    r = _mm256_fnmadd_ps(k, _mm256_set1_ps(Fast::Detail::kPiOver2B), r);
+    r = _mm256_fnmadd_ps(k, _mm256_set1_ps(Fast::Detail::kPiOver2C), r);
+    const __m256 r2 = _mm256_mul_ps(r, r);
+
+    __m256 sr = _mm256_fmadd_ps(_mm256_set1_ps(Fast::Detail::kSin7), r2, _mm256_set1_ps(Fast::Detail::kSin5));
+    sr = _mm256_fmadd_ps(sr, r2, _mm256_set1_ps(Fast::Detail::kSin3));
+    sr = _mm256_fmadd_ps(_mm256_mul_ps(sr, r2), r, r);
+
+    __m256 cr = _mm256_fmadd_ps(_mm256_set1_ps(Fast::Detail::kCos8), r2, _mm256_set1_ps(Fast::Detail::kCos6));
+    cr = _mm256_fmadd_ps(cr, r2, _mm256_set1_ps(Fast::Detail::kCos4));
+    cr = _mm256_fmadd_ps(_mm256_mul_ps(cr, r2), r2, _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), r2, _mm256_set1_ps(1.0f)));
+
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i two = _mm256_set1_epi32(2);
+    const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one));
+    const __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, two), 30));
+    const __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, one), two), 30));
+    s = _mm256_xor_ps(_mm256_blendv_ps(sr, cr, swap), sinSign);
+    c = _mm256_xor_ps(_mm256_blendv_ps(cr, sr, swap), cosSign);
+}
+
+GE_TARGET_AVX2 void FastSinCosAVX2(const float* angles, float* sines, float* cosines, size_t count) {
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    const __m256 maxAngle = _mm256_set1_ps(Fast::Detail::kMaxReducedAngle);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256 x = _mm256_loadu_ps(angles + i);
+        __m256 s, c;
+        SinCosLanes(x, s, c);
+        _mm256_storeu_ps(sines + i, s);
+        _mm256_storeu_ps(cosines + i, c);
+        // Out-of-range and NaN lanes take the scalar fallback
+        if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(signBit, x), maxAngle, _CMP_LE_OQ)) != 0xFF) {
+            for (size_t j = i; j < i + 8; ++j) {
+                Fast::SinCos(angles[j], sines[j], cosines[j]);
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        Fast::SinCos(angles[i], sines[i], cosines[i]);
+    }
+}
+
+GE_TARGET_AVX2 void FastNormalizeAVX2(const float* in, float* out, size_t count) {
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 threeHalves = _mm256_set1_ps(1.5f);
+    const __m256 zero = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 x, y, z;
+        LoadPacked8(in + i * 3, x, y, z);
+        const __m256 lengthSquared = _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+        const __m256 estimate = _mm256_rsqrt_ps(lengthSquared);
+        __m256 inv = _mm256_mul_ps(estimate, _mm256_fnmadd_ps(_mm256_mul_ps(half, lengthSquared),
+                                                              _mm256_mul_ps(estimate, estimate), threeHalves));
+        inv = _mm256_and_ps(inv, _mm256_cmp_ps(lengthSquared, zero, _CMP_NEQ_UQ));
+        StorePacked8(out + i * 3, _mm256_mul_ps(x, inv), _mm256_mul_ps(y, inv), _mm256_mul_ps(z, inv));
+    }
+    for (; i < count; ++i) {
+        FastNormalizeOne(in + i * 3, out + i * 3);
+    }
+}
+
+} // namespace
+
+const MathKernels AVX2Kernels = {
+    MultiplyAVX2,
+    TransformPackedAVX2,
+    TransformStridedAVX2,
+    TransformSoAAVX2,
+    NlerpAVX2,
+    SlerpAVX2,
+    ComposeTRSAVX2,
+    FastSinCosAVX2,
+    FastNormalizeAVX2
+};
+
+} // namespace Detail
+} // namespace Math
+} // namespace GameEngine
+
+#endif // GE_SIMD_X86
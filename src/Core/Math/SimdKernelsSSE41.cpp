@@ -0,0 +1,402 @@
+#include "SimdKernels.h"
+
+#if GE_SIMD_X86
+#include <smmintrin.h>
+
+namespace GameEngine {
+namespace Math {
+namespace Detail {
+
+namespace {
+
+// Sums are accumulated in the same order as the scalar kernels, so the
+// results are bit-identical to them.
+
+GE_TARGET_SSE41 void MultiplySSE41(const float* a, const float* b, float* out) {
+    const __m128 a0 = _mm_loadu_ps(a);
+    const __m128 a1 = _mm_loadu_ps(a + 4);
+    const __m128 a2 = _mm_loadu_ps(a + 8);
+    const __m128 a3 = _mm_loadu_ps(a + 12);
+
+    for (int col = 0; col < 4; ++col) {
+        const float* bc = b + col * 4;
+        __m128 r = _mm_mul_ps(a0, _mm_set1_ps(bc[0]));
+        r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(bc[1])));
+        r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(bc[2])));
+        r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_set1_ps(bc[3])));
+        _mm_storeu_ps(out + col * 4, r);
+    }
+}
+
+GE_TARGET_SSE41 inline void StoreVector3(float* out, __m128 v) {
+    out[0] = _mm_cvtss_f32(v);
+    out[1] = _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+    out[2] = _mm_cvtss_f32(_mm_movehl_ps(v, v));
+}
+
+GE_TARGET_SSE41 inline __m128 TransformLinearSSE41(const float* m, const float* in) {
+    __m128 r = _mm_mul_ps(_mm_loadu_ps(m), _mm_set1_ps(in[0]));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(in[1])));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(in[2])));
+    return r;
+}
+
+// Four packed xyz triples span three registers:
+//   v0 = x0 y0 z0 x1, v1 = y1 z1 x2 y2, v2 = z2 x3 y3 z3
+// Two blends gather each component (in a rotated lane order) and one
+// shuffle puts it back in order. StorePacked4 applies the inverse.
+GE_TARGET_SSE41 inline void LoadPacked4(const float* in, __m128& x, __m128& y, __m128& z) {
+    const __m128 v0 = _mm_loadu_ps(in);
+    const __m128 v1 = _mm_loadu_ps(in + 4);
+    const __m128 v2 = _mm_loadu_ps(in + 8);
+    const __m128 tx = _mm_blend_ps(_mm_blend_ps(v0, v1, 0x4), v2, 0x2); // x0 x3 x2 x1
+    const __m128 ty = _mm_blend_ps(_mm_blend_ps(v0, v1, 0x9), v2, 0x4); // y1 y0 y3 y2
+    const __m128 tz = _mm_blend_ps(_mm_blend_ps(v0, v1, 0x2), v2, 0x9); // z2 z1 z0 z3
+    x = _mm_shuffle_ps(tx, tx, _MM_SHUFFLE(1, 2, 3, 0));
+    y = _mm_shuffle_ps(ty, ty, _MM_SHUFFLE(2, 3, 0, 1));
+    z = _mm_shuffle_ps(tz, tz, _MM_SHUFFLE(3, 0, 1, 2));
+}
+
+GE_TARGET_SSE41 inline void StorePacked4(float* out, __m128 x, __m128 y, __m128 z) {
+    const __m128 tx = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+    const __m128 ty = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+    const __m128 tz = _mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+    _mm_storeu_ps(out, _mm_blend_ps(_mm_blend_ps(tx, ty, 0x2), tz, 0x4));
+    _mm_storeu_ps(out + 4, _mm_blend_ps(_mm_blend_ps(ty, tz, 0x2), tx, 0x4));
+    _mm_storeu_ps(out + 8, _mm_blend_ps(_mm_blend_ps(tz, tx, 0x2), ty, 0x4));
+}
+
+// Matrix columns broadcast per element, translation pre-scaled by w.
+struct BroadcastMatrix {
+    __m128 m[9];
+    __m128 t[3];
+};
+
+GE_TARGET_SSE41 inline BroadcastMatrix Broadcast(const float* m, float w) {
+    BroadcastMatrix b;
+    const int linear[9] = {0, 4, 8, 1, 5, 9, 2, 6, 10};
+    for (int i = 0; i < 9; ++i) {
+        b.m[i] = _mm_set1_ps(m[linear[i]]);
+    }
+    for (int i = 0; i < 3; ++i) {
+        b.t[i] = _mm_set1_ps(m[12 + i] * w);
+    }
+    return b;
+}
+
+GE_TARGET_SSE41 inline void TransformLanes(const BroadcastMatrix& b, __m128& x, __m128& y, __m128& z) {
+    const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(b.m[0], x), _mm_mul_ps(b.m[1], y)), _mm_mul_ps(b.m[2], z)), b.t[0]);
+    const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(b.m[3], x), _mm_mul_ps(b.m[4], y)), _mm_mul_ps(b.m[5], z)), b.t[1]);
+    const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(b.m[6], x), _mm_mul_ps(b.m[7], y)), _mm_mul_ps(b.m[8], z)), b.t[2]);
+    x = rx;
+    y = ry;
+    z = rz;
+}
+
+GE_TARGET_SSE41 inline void TransformOneSSE41(const float* m, __m128 t, const float* in, float* out) {
+    StoreVector3(out, _mm_add_ps(TransformLinearSSE41(m, in), t));
+}
+
+GE_TARGET_SSE41 void TransformPackedSSE41(const float* m, const float* in, float* out, size_t count, float w) {
+    const BroadcastMatrix b = Broadcast(m, w);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        LoadPacked4(in + i * 3, x, y, z);
+        TransformLanes(b, x, y, z);
+        StorePacked4(out + i * 3, x, y, z);
+    }
+    const __m128 t = _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(w));
+    for (; i < count; ++i) {
+        TransformOneSSE41(m, t, in + i * 3, out + i * 3);
+    }
+}
+
+GE_TARGET_SSE41 void TransformStridedSSE41(const float* m, const char* in, size_t inStride,
+                                           char* out, size_t outStride, size_t count, float w) {
+    const __m128 t = _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(w));
+    for (size_t i = 0; i < count; ++i) {
+        TransformOneSSE41(m, t, reinterpret_cast<const float*>(in + i * inStride),
+                          reinterpret_cast<float*>(out + i * outStride));
+    }
+}
+
+GE_TARGET_SSE41 void TransformSoASSE41(const float* m, const float* const in[3], float* const out[3],
+                                       size_t count, float w) {
+    const BroadcastMatrix b = Broadcast(m, w);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_loadu_ps(in[0] + i);
+        __m128 y = _mm_loadu_ps(in[1] + i);
+        __m128 z = _mm_loadu_ps(in[2] + i);
+        TransformLanes(b, x, y, z);
+        _mm_storeu_ps(out[0] + i, x);
+        _mm_storeu_ps(out[1] + i, y);
+        _mm_storeu_ps(out[2] + i, z);
+    }
+    const float tx = m[12] * w, ty = m[13] * w, tz = m[14] * w;
+    for (; i < count; ++i) {
+        const float x = in[0][i], y = in[1][i], z = in[2][i];
+        out[0][i] = m[0] * x + m[4] * y + m[8] * z + tx;
+        out[1][i] = m[1] * x + m[5] * y + m[9] * z + ty;
+        out[2][i] = m[2] * x + m[6] * y + m[10] * z + tz;
+    }
+}
+
+// Four quaternions in SoA form; loading and storing is a 4x4 transpose.
+struct Quat4 {
+    __m128 x, y, z, w;
+};
+
+GE_TARGET_SSE41 inline Quat4 LoadQuat4(const float* q) {
+    Quat4 r = {_mm_loadu_ps(q), _mm_loadu_ps(q + 4), _mm_loadu_ps(q + 8), _mm_loadu_ps(q + 12)};
+    _MM_TRANSPOSE4_PS(r.x, r.y, r.z, r.w);
+    return r;
+}
+
+GE_TARGET_SSE41 inline void StoreQuat4(float* out, Quat4 q) {
+    _MM_TRANSPOSE4_PS(q.x, q.y, q.z, q.w);
+    _mm_storeu_ps(out, q.x);
+    _mm_storeu_ps(out + 4, q.y);
+    _mm_storeu_ps(out + 8, q.z);
+    _mm_storeu_ps(out + 12, q.w);
+}
+
+GE_TARGET_SSE41 inline __m128 Dot(const Quat4& a, const Quat4& b) {
+    return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a.x, b.x), _mm_mul_ps(a.y, b.y)),
+                                 _mm_mul_ps(a.z, b.z)), _mm_mul_ps(a.w, b.w));
+}
+
+GE_TARGET_SSE41 inline Quat4 Scale(const Quat4& q, __m128 s) {
+    return {_mm_mul_ps(q.x, s), _mm_mul_ps(q.y, s), _mm_mul_ps(q.z, s), _mm_mul_ps(q.w, s)};
+}
+
+GE_TARGET_SSE41 inline Quat4 Combine(const Quat4& a, __m128 sa, const Quat4& b, __m128 sb) {
+    return {_mm_add_ps(_mm_mul_ps(a.x, sa), _mm_mul_ps(b.x, sb)),
+            _mm_add_ps(_mm_mul_ps(a.y, sa), _mm_mul_ps(b.y, sb)),
+            _mm_add_ps(_mm_mul_ps(a.z, sa), _mm_mul_ps(b.z, sb)),
+            _mm_add_ps(_mm_mul_ps(a.w, sa), _mm_mul_ps(b.w, sb))};
+}
+
+// Negates b in the lanes where `signBits` is set (shortest-arc flip).
+GE_TARGET_SSE41 inline Quat4 FlipSign(const Quat4& q, __m128 signBits) {
+    return {_mm_xor_ps(q.x, signBits), _mm_xor_ps(q.y, signBits),
+            _mm_xor_ps(q.z, signBits), _mm_xor_ps(q.w, signBits)};
+}
+
+// acos(x) = sqrt(1 - x) * P(x) on [0, 1], |error| < 2e-8 (Abramowitz &
+// Stegun 4.4.46).
+GE_TARGET_SSE41 inline __m128 AcosPoly(__m128 x) {
+    __m128 p = _mm_set1_ps(-0.0012624911f);
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0066700901f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.0170881256f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0308918810f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.0501743046f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0889789874f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.2145988016f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(1.5707963050f));
+    return _mm_mul_ps(p, _mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), x)));
+}
+
+// Taylor series through x^11; |error| < 6e-8 on [0, pi/2], which covers
+// every angle slerp needs after the shortest-arc flip.
+GE_TARGET_SSE41 inline __m128 SinPoly(__m128 x) {
+    const __m128 x2 = _mm_mul_ps(x, x);
+    __m128 p = _mm_set1_ps(-2.5052108e-8f);
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(2.7557319e-6f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.9841270e-4f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(8.3333333e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.6666667e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f));
+    return _mm_mul_ps(p, x);
+}
+
+GE_TARGET_SSE41 inline __m128 InverseLength(const Quat4& q) {
+    return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(Dot(q, q)));
+}
+
+GE_TARGET_SSE41 void NlerpSSE41(const float* a, const float* b, const float* t, float* out, size_t count) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const Quat4 qa = LoadQuat4(a + i * 4);
+        Quat4 qb = LoadQuat4(b + i * 4);
+        const __m128 tt = _mm_loadu_ps(t + i);
+        qb = FlipSign(qb, _mm_and_ps(Dot(qa, qb), signMask));
+        const Quat4 r = Combine(qa, _mm_sub_ps(one, tt), qb, tt);
+        StoreQuat4(out + i * 4, Scale(r, InverseLength(r)));
+    }
+    for (; i < count; ++i) {
+        NlerpOne(a + i * 4, b + i * 4, t[i], out + i * 4);
+    }
+}
+
+GE_TARGET_SSE41 void SlerpSSE41(const float* a, const float* b, const float* t, float* out, size_t count) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 threshold = _mm_set1_ps(Quaternion::kSlerpNlerpThreshold);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const Quat4 qa = LoadQuat4(a + i * 4);
+        Quat4 qb = LoadQuat4(b + i * 4);
+        const __m128 tt = _mm_loadu_ps(t + i);
+        const __m128 oneMinusT = _mm_sub_ps(one, tt);
+
+        __m128 cosTheta = Dot(qa, qb);
+        const __m128 sign = _mm_and_ps(cosTheta, signMask);
+        qb = FlipSign(qb, sign);
+        cosTheta = _mm_min_ps(_mm_xor_ps(cosTheta, sign), one);
+        const __m128 nearlyParallel = _mm_cmpgt_ps(cosTheta, threshold);
+
+        // Parallel lanes divide by ~0 here; the blend below discards them.
+        const __m128 theta = AcosPoly(cosTheta);
+        const __m128 invSin = _mm_div_ps(one, _mm_sqrt_ps(_mm_sub_ps(one, _mm_mul_ps(cosTheta, cosTheta))));
+        const __m128 sa = _mm_blendv_ps(_mm_mul_ps(SinPoly(_mm_mul_ps(oneMinusT, theta)), invSin), oneMinusT, nearlyParallel);
+        const __m128 sb = _mm_blendv_ps(_mm_mul_ps(SinPoly(_mm_mul_ps(tt, theta)), invSin), tt, nearlyParallel);
+
+        const Quat4 r = Combine(qa, sa, qb, sb);
+        const __m128 norm = _mm_blendv_ps(one, InverseLength(r), nearlyParallel);
+        StoreQuat4(out + i * 4, Scale(r, norm));
+    }
+    for (; i < count; ++i) {
+        SlerpOne(a + i * 4, b + i * 4, t[i], out + i * 4);
+    }
+}
+
+// Writes column `col` of four consecutive matrices from SoA lanes.
+GE_TARGET_SSE41 inline void StoreColumn4(float* out, int col, __m128 x, __m128 y, __m128 z, __m128 w) {
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    _mm_storeu_ps(out + col * 4, x);
+    _mm_storeu_ps(out + 16 + col * 4, y);
+    _mm_storeu_ps(out + 32 + col * 4, z);
+    _mm_storeu_ps(out + 48 + col * 4, w);
+}
+
+// Same operation order as Matrix4::trs, so results are bit-identical.
+GE_TARGET_SSE41 void ComposeTRSSSE41(const float* positions, const float* rotations, const float* scales,
+                                     float* out, size_t count) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 zero = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const Quat4 q = LoadQuat4(rotations + i * 4);
+        __m128 px, py, pz, sx, sy, sz;
+        LoadPacked4(positions + i * 3, px, py, pz);
+        LoadPacked4(scales + i * 3, sx, sy, sz);
+
+        const __m128 xx = _mm_mul_ps(q.x, q.x), yy = _mm_mul_ps(q.y, q.y), zz = _mm_mul_ps(q.z, q.z);
+        const __m128 xy = _mm_mul_ps(q.x, q.y), xz = _mm_mul_ps(q.x, q.z), yz = _mm_mul_ps(q.y, q.z);
+        const __m128 wx = _mm_mul_ps(q.w, q.x), wy = _mm_mul_ps(q.w, q.y), wz = _mm_mul_ps(q.w, q.z);
+
+        float* m = out + i * 16;
+        StoreColumn4(m, 0,
+                     _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx),
+                     _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx),
+                     _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx), zero);
+        StoreColumn4(m, 1,
+                     _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy),
+                     _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy),
+                     _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy), zero);
+        StoreColumn4(m, 2,
+                     _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz),
+                     _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz),
+                     _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz), zero);
+        StoreColumn4(m, 3, px, py, pz, one);
+    }
+    for (; i < count; ++i) {
+        ComposeTRSOne(positions + i * 3, rotations + i * 4, scales + i * 3, out + i * 16);
+    }
+}
+
+// Vector form of Fast::SinCos. _mm_cvtps_epi32 rounds half to even where
+// the scalar path rounds half away from zero; both reductions are valid.
+GE_TARGET_SSE41 inline void SinCosLanes(__m128 x, __m128& s, __m128& c) {
+    const __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(Fast::Detail::kTwoOverPi)));
+    const __m128 k = _mm_cvtepi32_ps(quadrant);
+    __m128 r = _mm_sub_ps(x, _mm_mul_ps(k, _mm_set1_ps(Fast::Detail::kPiOver2A)));
+    r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(Fast::Detail::kPiOver2B)));
+    r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(Fast::Detail::kPiOver2C)));
+    const __m128 r2 = _mm_mul_ps(r, r);
+
+    __m128 sr = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Fast::Detail::kSin7), r2), _mm_set1_ps(Fast::Detail::kSin5));
+    sr = _mm_add_ps(_mm_mul_ps(sr, r2), _mm_set1_ps(Fast::Detail::kSin3));
+    sr = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sr, r2), r), r);
+
+    __m128 cr = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Fast::Detail::kCos8), r2), _mm_set1_ps(Fast::Detail::kCos6));
+    cr = _mm_add_ps(_mm_mul_ps(cr, r2), _mm_set1_ps(Fast::Detail::kCos4));
+    cr = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(cr, r2), r2), _mm_mul_ps(_mm_set1_ps(0.5f), r2)), _mm_set1_ps(1.0f));
+
+    // Odd quadrants swap sin/cos; bit 1 of quadrant (and of quadrant + 1) gives the signs
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+    const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+    const __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+    const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+    s = _mm_xor_ps(_mm_blendv_ps(sr, cr, swap), sinSign);
+    c = _mm_xor_ps(_mm_blendv_ps(cr, sr, swap), cosSign);
+}
+
+GE_TARGET_SSE41 void FastSinCosSSE41(const float* angles, float* sines, float* cosines, size_t count) {
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    const __m128 maxAngle = _mm_set1_ps(Fast::Detail::kMaxReducedAngle);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 x = _mm_loadu_ps(angles + i);
+        __m128 s, c;
+        SinCosLanes(x, s, c);
+        _mm_storeu_ps(sines + i, s);
+        _mm_storeu_ps(cosines + i, c);
+        // Out-of-range and NaN lanes take the scalar fallback
+        if (_mm_movemask_ps(_mm_cmple_ps(_mm_andnot_ps(signBit, x), maxAngle)) != 0xF) {
+            for (size_t j = i; j < i + 4; ++j) {
+                Fast::SinCos(angles[j], sines[j], cosines[j]);
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        Fast::SinCos(angles[i], sines[i], cosines[i]);
+    }
+}
+
+GE_TARGET_SSE41 void FastNormalizeSSE41(const float* in, float* out, size_t count) {
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 threeHalves = _mm_set1_ps(1.5f);
+    const __m128 zero = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        LoadPacked4(in + i * 3, x, y, z);
+        const __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+        const __m128 estimate = _mm_rsqrt_ps(lengthSquared);
+        __m128 inv = _mm_mul_ps(estimate, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(half, lengthSquared),
+                                                                             _mm_mul_ps(estimate, estimate))));
+        // rsqrt(0) is inf and the Newton step turns it into NaN; zero vectors stay zero
+        inv = _mm_and_ps(inv, _mm_cmpneq_ps(lengthSquared, zero));
+        StorePacked4(out + i * 3, _mm_mul_ps(x, inv), _mm_mul_ps(y, inv), _mm_mul_ps(z, inv));
+    }
+    for (; i < count; ++i) {
+        FastNormalizeOne(in + i * 3, out + i * 3);
+    }
+}
+
+} // namespace
+
+const MathKernels SSE41Kernels = {
+    MultiplySSE41,
+    TransformPackedSSE41,
+    TransformStridedSSE41,
+    TransformSoASSE41,
+    NlerpSSE41,
+    SlerpSSE41,
+    ComposeTRSSSE41,
+    FastSinCosSSE41,
+    FastNormalizeSSE41
+};
+
+} // namespace Detail
+} // namespace Math
+} // namespace GameEngine
+
+#endif // GE_SIMD_X86
@@ -0,0 +1,102 @@
+#include "SimdKernels.h"
+
+namespace GameEngine {
+namespace Math {
+namespace Detail {
+
+namespace {
+
+void MultiplyScalar(const float* a, const float* b, float* out) {
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                sum += a[row + k * 4] * b[k + col * 4];
+            }
+            out[row + col * 4] = sum;
+        }
+    }
+}
+
+inline void TransformOneScalar(const float* m, const float* t, const float* in, float* out) {
+    const float x = in[0], y = in[1], z = in[2];
+    out[0] = m[0] * x + m[4] * y + m[8] * z + t[0];
+    out[1] = m[1] * x + m[5] * y + m[9] * z + t[1];
+    out[2] = m[2] * x + m[6] * y + m[10] * z + t[2];
+}
+
+void TransformPackedScalar(const float* m, const float* in, float* out, size_t count, float w) {
+    const float t[3] = {m[12] * w, m[13] * w, m[14] * w};
+    for (size_t i = 0; i < count; ++i) {
+        TransformOneScalar(m, t, in + i * 3, out + i * 3);
+    }
+}
+
+void TransformStridedScalar(const float* m, const char* in, size_t inStride,
+                            char* out, size_t outStride, size_t count, float w) {
+    const float t[3] = {m[12] * w, m[13] * w, m[14] * w};
+    for (size_t i = 0; i < count; ++i) {
+        TransformOneScalar(m, t, reinterpret_cast<const float*>(in + i * inStride),
+                           reinterpret_cast<float*>(out + i * outStride));
+    }
+}
+
+void TransformSoAScalar(const float* m, const float* const in[3], float* const out[3],
+                        size_t count, float w) {
+    const float tx = m[12] * w, ty = m[13] * w, tz = m[14] * w;
+    for (size_t i = 0; i < count; ++i) {
+        const float x = in[0][i], y = in[1][i], z = in[2][i];
+        out[0][i] = m[0] * x + m[4] * y + m[8] * z + tx;
+        out[1][i] = m[1] * x + m[5] * y + m[9] * z + ty;
+        out[2][i] = m[2] * x + m[6] * y + m[10] * z + tz;
+    }
+}
+
+void NlerpScalar(const float* a, const float* b, const float* t, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        NlerpOne(a + i * 4, b + i * 4, t[i], out + i * 4);
+    }
+}
+
+void SlerpScalar(const float* a, const float* b, const float* t, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        SlerpOne(a + i * 4, b + i * 4, t[i], out + i * 4);
+    }
+}
+
+void ComposeTRSScalar(const float* positions, const float* rotations, const float* scales,
+                      float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        ComposeTRSOne(positions + i * 3, rotations + i * 4, scales + i * 3, out + i * 16);
+    }
+}
+
+void FastSinCosScalar(const float* angles, float* sines, float* cosines, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        Fast::SinCos(angles[i], sines[i], cosines[i]);
+    }
+}
+
+void FastNormalizeScalar(const float* in, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        FastNormalizeOne(in + i * 3, out + i * 3);
+    }
+}
+
+} // namespace
+
+const MathKernels ScalarKernels = {
+    MultiplyScalar,
+    TransformPackedScalar,
+    TransformStridedScalar,
+    TransformSoAScalar,
+    NlerpScalar,
+    SlerpScalar,
+    ComposeTRSScalar,
+    FastSinCosScalar,
+    FastNormalizeScalar
+};
+
+} // namespace Detail
+} // namespace Math
+} // namespace GameEngine
@@ -0,0 +1,272 @@
+#include "GameEngine/Core/TransformHierarchy.h"
+#include <algorithm>
+#include <cassert>
+
+namespace GameEngine {
+namespace Math {
+
+namespace {
+
+template<typename Vector>
+typename Vector::iterator At(Vector& v, uint32_t index) {
+    return v.begin() + static_cast<std::ptrdiff_t>(index);
+}
+
+} // namespace
+
+TransformHierarchy::NodeId TransformHierarchy::CreateNode(NodeId parent, const AffineTransform& local) {
+    uint32_t parentIndex = kNoIndex;
+    if (parent != kInvalidNode) {
+        if (!IsValid(parent)) {
+            return kInvalidNode;
+        }
+        parentIndex = idToIndex[parent];
+    }
+
+    NodeId id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+    } else {
+        id = static_cast<NodeId>(idToIndex.size());
+        idToIndex.push_back(kNoIndex);
+    }
+
+    // A new child goes at the end of its parent's subtree, a new root at the end
+    const uint32_t position = parentIndex == kNoIndex ? static_cast<uint32_t>(Size()) : subtreeEnds[parentIndex];
+    const uint32_t relativeParent = 0;
+    const uint32_t relativeEnd = 1;
+    InsertNodes(position, parentIndex, &id, &local, &relativeParent, &relativeEnd, 1);
+    return id;
+}
+
+void TransformHierarchy::DestroyNode(NodeId id) {
+    assert(IsValid(id));
+    const uint32_t begin = idToIndex[id];
+    const uint32_t end = subtreeEnds[begin];
+    for (uint32_t i = begin; i < end; ++i) {
+        idToIndex[nodeIds[i]] = kNoIndex;
+        freeIds.push_back(nodeIds[i]);
+    }
+    EraseNodes(begin, end);
+}
+
+bool TransformHierarchy::SetParent(NodeId id, NodeId newParent) {
+    assert(IsValid(id));
+    const uint32_t begin = idToIndex[id];
+    const uint32_t end = subtreeEnds[begin];
+    if (newParent != kInvalidNode) {
+        if (!IsValid(newParent)) {
+            return false;
+        }
+        const uint32_t parentIndex = idToIndex[newParent];
+        if (parentIndex >= begin && parentIndex < end) {
+            return false; // Would create a cycle
+        }
+    }
+    if (GetParent(id) == newParent) {
+        return true;
+    }
+
+    // Copy the subtree out with block-relative links, then reinsert it
+    const uint32_t count = end - begin;
+    std::vector<NodeId> ids(At(nodeIds, begin), At(nodeIds, end));
+    std::vector<AffineTransform> locals(At(localTransforms, begin), At(localTransforms, end));
+    std::vector<uint32_t> relativeParents(count, 0), relativeEnds(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (i > 0) {
+            relativeParents[i] = parents[begin + i] - begin;
+        }
+        relativeEnds[i] = subtreeEnds[begin + i] - begin;
+    }
+    EraseNodes(begin, end);
+
+    const uint32_t parentIndex = newParent == kInvalidNode ? kNoIndex : idToIndex[newParent];
+    const uint32_t position = parentIndex == kNoIndex ? static_cast<uint32_t>(Size()) : subtreeEnds[parentIndex];
+    InsertNodes(position, parentIndex, ids.data(), locals.data(), relativeParents.data(), relativeEnds.data(), count);
+    return true;
+}
+
+void TransformHierarchy::Clear() {
+    localTransforms.clear();
+    worldTransforms.clear();
+    parents.clear();
+    subtreeEnds.clear();
+    nodeIds.clear();
+    dirtyFlags.clear();
+    idToIndex.clear();
+    freeIds.clear();
+    dirtyRoots.clear();
+    tasks.clear();
+    lastUpdateCount = 0;
+}
+
+TransformHierarchy::NodeId TransformHierarchy::GetParent(NodeId id) const {
+    assert(IsValid(id));
+    const uint32_t parentIndex = parents[idToIndex[id]];
+    return parentIndex == kNoIndex ? kInvalidNode : nodeIds[parentIndex];
+}
+
+void TransformHierarchy::SetLocalTransform(NodeId id, const AffineTransform& local) {
+    assert(IsValid(id));
+    const uint32_t index = idToIndex[id];
+    localTransforms[index] = local;
+    MarkDirty(index);
+}
+
+void TransformHierarchy::SetLocalTRS(NodeId id, const Vector3& position, const Quaternion& rotation, const Vector3& scale) {
+    SetLocalTransform(id, AffineTransform(Matrix4::trs(position, rotation, scale)));
+}
+
+const AffineTransform& TransformHierarchy::GetLocalTransform(NodeId id) const {
+    assert(IsValid(id));
+    return localTransforms[idToIndex[id]];
+}
+
+const AffineTransform& TransformHierarchy::GetWorldTransform(NodeId id) const {
+    assert(IsValid(id));
+    return worldTransforms[idToIndex[id]];
+}
+
+size_t TransformHierarchy::GetIndex(NodeId id) const {
+    assert(IsValid(id));
+    return idToIndex[id];
+}
+
+void TransformHierarchy::UpdateWorldTransforms() {
+    CollectDirtyRanges(~size_t(0));
+    for (const Range& range : tasks) {
+        UpdateRange(range);
+    }
+}
+
+// Every flagged node is covered by a dirty root at or above it, so only
+// the roots need to be queued.
+void TransformHierarchy::MarkDirty(uint32_t index) {
+    if (!dirtyFlags[index]) {
+        dirtyFlags[index] = 1;
+        dirtyRoots.push_back(nodeIds[index]);
+    }
+}
+
+void TransformHierarchy::InsertNodes(uint32_t position, uint32_t parentIndex, const NodeId* ids,
+                                     const AffineTransform* locals, const uint32_t* relativeParents,
+                                     const uint32_t* relativeEnds, uint32_t count) {
+    // Nodes after the insertion point shift up; ancestors grow
+    for (size_t i = position; i < parents.size(); ++i) {
+        subtreeEnds[i] += count;
+        if (parents[i] != kNoIndex && parents[i] >= position) {
+            parents[i] += count;
+        }
+    }
+    for (uint32_t ancestor = parentIndex; ancestor != kNoIndex; ancestor = parents[ancestor]) {
+        subtreeEnds[ancestor] += count;
+    }
+
+    localTransforms.insert(At(localTransforms, position), locals, locals + count);
+    worldTransforms.insert(At(worldTransforms, position), count, AffineTransform());
+    parents.insert(At(parents, position), count, kNoIndex);
+    subtreeEnds.insert(At(subtreeEnds, position), count, 0);
+    nodeIds.insert(At(nodeIds, position), ids, ids + count);
+    dirtyFlags.insert(At(dirtyFlags, position), count, uint8_t(1));
+
+    for (uint32_t i = 0; i < count; ++i) {
+        parents[position + i] = i == 0 ? parentIndex : position + relativeParents[i];
+        subtreeEnds[position + i] = position + relativeEnds[i];
+    }
+    for (size_t i = position; i < nodeIds.size(); ++i) {
+        idToIndex[nodeIds[i]] = static_cast<uint32_t>(i);
+    }
+    dirtyRoots.push_back(ids[0]);
+}
+
+void TransformHierarchy::EraseNodes(uint32_t begin, uint32_t end) {
+    const uint32_t count = end - begin;
+    for (uint32_t ancestor = parents[begin]; ancestor != kNoIndex; ancestor = parents[ancestor]) {
+        subtreeEnds[ancestor] -= count;
+    }
+
+    localTransforms.erase(At(localTransforms, begin), At(localTransforms, end));
+    worldTransforms.erase(At(worldTransforms, begin), At(worldTransforms, end));
+    parents.erase(At(parents, begin), At(parents, end));
+    subtreeEnds.erase(At(subtreeEnds, begin), At(subtreeEnds, end));
+    nodeIds.erase(At(nodeIds, begin), At(nodeIds, end));
+    dirtyFlags.erase(At(dirtyFlags, begin), At(dirtyFlags, end));
+
+    // Parents of the shifted nodes are either before `begin` or were shifted too
+    for (size_t i = begin; i < parents.size(); ++i) {
+        subtreeEnds[i] -= count;
+        if (parents[i] != kNoIndex && parents[i] >= begin) {
+            parents[i] -= count;
+        }
+        idToIndex[nodeIds[i]] = static_cast<uint32_t>(i);
+    }
+}
+
+// Turns the queued dirty roots into disjoint index ranges. A range larger
+// than minTaskSize has its root computed here and its child subtrees
+// queued instead; no range reads a world transform another one writes.
+void TransformHierarchy::CollectDirtyRanges(size_t minTaskSize) {
+    tasks.clear();
+    lastUpdateCount = 0;
+    if (dirtyRoots.empty()) {
+        return;
+    }
+
+    scratchIndices.clear();
+    for (NodeId id : dirtyRoots) {
+        if (IsValid(id)) {
+            scratchIndices.push_back(idToIndex[id]);
+        }
+    }
+    dirtyRoots.clear();
+    std::sort(scratchIndices.begin(), scratchIndices.end());
+
+    uint32_t coveredEnd = 0;
+    std::vector<uint32_t>& pending = scratchIndices; // reused as the split stack below
+    const size_t rootCount = pending.size();
+    for (size_t r = 0; r < rootCount; ++r) {
+        const uint32_t root = pending[r];
+        if (root < coveredEnd) {
+            continue; // Inside a subtree that is already being rebuilt
+        }
+        coveredEnd = subtreeEnds[root];
+        lastUpdateCount += coveredEnd - root;
+
+        // Depth-first split using the tail of `pending` as a stack
+        pending.push_back(root);
+        while (pending.size() > rootCount) {
+            const uint32_t node = pending.back();
+            pending.pop_back();
+            const uint32_t end = subtreeEnds[node];
+            if (end - node <= minTaskSize) {
+                tasks.push_back({node, end});
+                continue;
+            }
+            UpdateNode(node);
+            for (uint32_t child = node + 1; child < end; child = subtreeEnds[child]) {
+                pending.push_back(child);
+            }
+        }
+    }
+}
+
+void TransformHierarchy::UpdateNode(uint32_t index) {
+    const uint32_t parent = parents[index];
+    worldTransforms[index] = parent == kNoIndex ? localTransforms[index] : worldTransforms[parent] * localTransforms[index];
+    dirtyFlags[index] = 0;
+}
+
+void TransformHierarchy::UpdateRange(Range range) {
+    // Depth-first order: every parent is final before its children
+    const AffineTransform* local = localTransforms.data();
+    const uint32_t* parent = parents.data();
+    AffineTransform* world = worldTransforms.data();
+    for (uint32_t i = range.begin; i < range.end; ++i) {
+        world[i] = parent[i] == kNoIndex ? local[i] : world[parent[i]] * local[i];
+    }
+    std::fill(At(dirtyFlags, range.begin), At(dirtyFlags, range.end), uint8_t(0));
+}
+
+} // namespace Math
+} // namespace GameEngine
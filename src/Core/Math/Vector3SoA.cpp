@@ -0,0 +1,221 @@
+#include "GameEngine/Core/Vector3SoA.h"
+#include <cassert>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GE_SOA_SSE2 1
+#else
+#define GE_SOA_SSE2 0
+#endif
+
+namespace GameEngine {
+namespace Math {
+
+// The element-wise loops below take __restrict pointers so the compiler
+// can vectorize them. Length and Normalize use SSE directly because
+// std::sqrt keeps errno semantics and blocks auto-vectorization.
+
+Vector3SoA::Vector3SoA(size_t count) : xs(count, 0.0f), ys(count, 0.0f), zs(count, 0.0f) {}
+
+Vector3SoA::Vector3SoA(const std::vector<Vector3>& vectors) {
+    FromAoS(vectors.data(), vectors.size());
+}
+
+void Vector3SoA::Resize(size_t count) {
+    xs.resize(count, 0.0f);
+    ys.resize(count, 0.0f);
+    zs.resize(count, 0.0f);
+}
+
+void Vector3SoA::Reserve(size_t count) {
+    xs.reserve(count);
+    ys.reserve(count);
+    zs.reserve(count);
+}
+
+void Vector3SoA::Clear() {
+    xs.clear();
+    ys.clear();
+    zs.clear();
+}
+
+void Vector3SoA::PushBack(const Vector3& v) {
+    xs.push_back(v.x);
+    ys.push_back(v.y);
+    zs.push_back(v.z);
+}
+
+void Vector3SoA::Set(size_t index, const Vector3& v) {
+    xs[index] = v.x;
+    ys[index] = v.y;
+    zs[index] = v.z;
+}
+
+void Vector3SoA::FromAoS(const Vector3* vectors, size_t count) {
+    Resize(count);
+    float* __restrict x = xs.data();
+    float* __restrict y = ys.data();
+    float* __restrict z = zs.data();
+    for (size_t i = 0; i < count; ++i) {
+        x[i] = vectors[i].x;
+        y[i] = vectors[i].y;
+        z[i] = vectors[i].z;
+    }
+}
+
+void Vector3SoA::ToAoS(Vector3* out) const {
+    const size_t count = Size();
+    const float* __restrict x = xs.data();
+    const float* __restrict y = ys.data();
+    const float* __restrict z = zs.data();
+    for (size_t i = 0; i < count; ++i) {
+        out[i].x = x[i];
+        out[i].y = y[i];
+        out[i].z = z[i];
+    }
+}
+
+std::vector<Vector3> Vector3SoA::ToAoS() const {
+    std::vector<Vector3> out(Size());
+    ToAoS(out.data());
+    return out;
+}
+
+void Vector3SoA::Add(const Vector3SoA& other) {
+    assert(other.Size() == Size());
+    const size_t count = Size();
+    // No __restrict: `other` may be *this. Each element only reads its own
+    // index, so the loop still vectorizes.
+    float* x = xs.data();
+    float* y = ys.data();
+    float* z = zs.data();
+    const float* ox = other.xs.data();
+    const float* oy = other.ys.data();
+    const float* oz = other.zs.data();
+    for (size_t i = 0; i < count; ++i) {
+        x[i] += ox[i];
+        y[i] += oy[i];
+        z[i] += oz[i];
+    }
+}
+
+void Vector3SoA::Scale(float scalar) {
+    const size_t count = Size();
+    float* __restrict x = xs.data();
+    float* __restrict y = ys.data();
+    float* __restrict z = zs.data();
+    for (size_t i = 0; i < count; ++i) {
+        x[i] *= scalar;
+        y[i] *= scalar;
+        z[i] *= scalar;
+    }
+}
+
+void Vector3SoA::MultiplyAdd(const Vector3SoA& other, float scalar) {
+    assert(other.Size() == Size());
+    const size_t count = Size();
+    // No __restrict, as in Add()
+    float* x = xs.data();
+    float* y = ys.data();
+    float* z = zs.data();
+    const float* ox = other.xs.data();
+    const float* oy = other.ys.data();
+    const float* oz = other.zs.data();
+    for (size_t i = 0; i < count; ++i) {
+        x[i] += ox[i] * scalar;
+        y[i] += oy[i] * scalar;
+        z[i] += oz[i] * scalar;
+    }
+}
+
+void Vector3SoA::Dot(const Vector3SoA& other, float* out) const {
+    assert(other.Size() == Size());
+    const size_t count = Size();
+    const float* __restrict x = xs.data();
+    const float* __restrict y = ys.data();
+    const float* __restrict z = zs.data();
+    const float* __restrict ox = other.xs.data();
+    const float* __restrict oy = other.ys.data();
+    const float* __restrict oz = other.zs.data();
+    float* __restrict result = out;
+    for (size_t i = 0; i < count; ++i) {
+        result[i] = x[i] * ox[i] + y[i] * oy[i] + z[i] * oz[i];
+    }
+}
+
+void Vector3SoA::Cross(const Vector3SoA& other, Vector3SoA& out) const {
+    assert(other.Size() == Size());
+    assert(&out != this && &out != &other);
+    const size_t count = Size();
+    out.Resize(count);
+    const float* __restrict x = xs.data();
+    const float* __restrict y = ys.data();
+    const float* __restrict z = zs.data();
+    const float* __restrict ox = other.xs.data();
+    const float* __restrict oy = other.ys.data();
+    const float* __restrict oz = other.zs.data();
+    float* __restrict rx = out.xs.data();
+    float* __restrict ry = out.ys.data();
+    float* __restrict rz = out.zs.data();
+    for (size_t i = 0; i < count; ++i) {
+        rx[i] = y[i] * oz[i] - z[i] * oy[i];
+        ry[i] = z[i] * ox[i] - x[i] * oz[i];
+        rz[i] = x[i] * oy[i] - y[i] * ox[i];
+    }
+}
+
+void Vector3SoA::Length(float* out) const {
+    const size_t count = Size();
+    const float* x = xs.data();
+    const float* y = ys.data();
+    const float* z = zs.data();
+    size_t i = 0;
+#if GE_SOA_SSE2
+    for (; i + 4 <= count; i += 4) {
+        const __m128 vx = _mm_loadu_ps(x + i);
+        const __m128 vy = _mm_loadu_ps(y + i);
+        const __m128 vz = _mm_loadu_ps(z + i);
+        const __m128 sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+        _mm_storeu_ps(out + i, _mm_sqrt_ps(sq));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+    }
+}
+
+void Vector3SoA::Normalize() {
+    const size_t count = Size();
+    float* x = xs.data();
+    float* y = ys.data();
+    float* z = zs.data();
+    size_t i = 0;
+#if GE_SOA_SSE2
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 vx = _mm_loadu_ps(x + i);
+        const __m128 vy = _mm_loadu_ps(y + i);
+        const __m128 vz = _mm_loadu_ps(z + i);
+        const __m128 mag = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz)));
+        // One divide and three multiplies instead of three divides; this
+        // stays within 2 ULP of Vector3::Normalized. The compare mask
+        // zeroes lanes whose magnitude is zero.
+        const __m128 inv = _mm_and_ps(_mm_div_ps(one, mag), _mm_cmpgt_ps(mag, zero));
+        _mm_storeu_ps(x + i, _mm_mul_ps(vx, inv));
+        _mm_storeu_ps(y + i, _mm_mul_ps(vy, inv));
+        _mm_storeu_ps(z + i, _mm_mul_ps(vz, inv));
+    }
+#endif
+    for (; i < count; ++i) {
+        const float mag = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+        const float inv = mag > 0.0f ? 1.0f / mag : 0.0f;
+        x[i] *= inv;
+        y[i] *= inv;
+        z[i] *= inv;
+    }
+}
+
+} // namespace Math
+} // namespace GameEngine
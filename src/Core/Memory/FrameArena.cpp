@@ -0,0 +1,57 @@
+#include "GameEngine/Core/FrameArena.h"
+#include <cassert>
+
+namespace GameEngine {
+namespace Core {
+
+namespace {
+
+// Cache-line aligned so SIMD-aligned allocations never need padding at
+// the start of the block
+constexpr size_t kBufferAlignment = 64;
+
+} // namespace
+
+FrameArena::FrameArena(size_t capacity_, const char* tag)
+    : buffer(static_cast<unsigned char*>(::operator new(capacity_, std::align_val_t(kBufferAlignment)))),
+      capacity(capacity_) {
+#if GE_MEMORY_TRACKING
+    if (tag != nullptr) {
+        tracker = std::make_unique<AllocationTracker>(
+            tag, [](const void* owner) { return static_cast<const FrameArena*>(owner)->Capacity(); }, this, false);
+    }
+#else
+    (void)tag;
+#endif
+}
+
+FrameArena::~FrameArena() {
+    ::operator delete(buffer, std::align_val_t(kBufferAlignment));
+}
+
+void FrameArena::FreeToMarker(Marker marker) {
+    assert(marker <= offset);
+    offset = marker;
+#if GE_MEMORY_TRACKING
+    if (tracker) tracker->OnRewind(offset);
+#endif
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    void* memory = Allocate(bytes, alignment);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void FrameArena::do_deallocate(void*, size_t, size_t) {
+    // Memory is reclaimed by Reset() and FreeToMarker()
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+} // namespace Core
+} // namespace GameEngine
@@ -0,0 +1,182 @@
+#include "GameEngine/Core/MemoryTracker.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <utility>
+
+namespace GameEngine {
+namespace Core {
+
+double MemoryStats::InternalFragmentation() const {
+    if (bytesInUse == 0 || requestedBytes >= bytesInUse) {
+        return 0.0;
+    }
+    return static_cast<double>(bytesInUse - requestedBytes) / static_cast<double>(bytesInUse);
+}
+
+double MemoryStats::Utilization() const {
+    if (reservedBytes == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(bytesInUse) / static_cast<double>(reservedBytes);
+}
+
+AllocationTracker::AllocationTracker(std::string tag_, ReservedBytesFn reservedBytes_, const void* owner_,
+                                     bool reportsLeaks_)
+    : tag(std::move(tag_)), reservedBytes(reservedBytes_), owner(owner_), reportsLeaks(reportsLeaks_) {
+    MemoryTracker::GetInstance().Register(this);
+}
+
+AllocationTracker::~AllocationTracker() {
+    MemoryTracker::GetInstance().Unregister(this);
+}
+
+void AllocationTracker::OnRewind(size_t newBytesInUse) noexcept {
+    bytesInUse.store(newBytesInUse, std::memory_order_relaxed);
+    if (requestedBytes.load(std::memory_order_relaxed) > newBytesInUse) {
+        requestedBytes.store(newBytesInUse, std::memory_order_relaxed);
+    }
+    if (newBytesInUse == 0) {
+        const size_t live = liveAllocations.exchange(0, std::memory_order_relaxed);
+        totalFrees.fetch_add(live, std::memory_order_relaxed);
+    }
+}
+
+MemoryStats AllocationTracker::Snapshot() const {
+    MemoryStats stats;
+    stats.tag = tag;
+    stats.bytesInUse = bytesInUse.load(std::memory_order_relaxed);
+    stats.requestedBytes = requestedBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = peakBytes.load(std::memory_order_relaxed);
+    stats.reservedBytes = reservedBytes ? reservedBytes(owner) : 0;
+    stats.liveAllocations = liveAllocations.load(std::memory_order_relaxed);
+    stats.totalAllocations = totalAllocations.load(std::memory_order_relaxed);
+    stats.totalFrees = totalFrees.load(std::memory_order_relaxed);
+    stats.allocationsLastFrame = lastFrameAllocations.load(std::memory_order_relaxed);
+    stats.bytesAllocatedLastFrame = lastFrameBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+MemoryTracker& MemoryTracker::GetInstance() {
+    // Never destroyed: allocators with static storage duration may
+    // unregister after every other static has been torn down
+    static MemoryTracker* instance = new MemoryTracker();
+    return *instance;
+}
+
+void MemoryTracker::Register(AllocationTracker* tracker) {
+    std::lock_guard<std::mutex> lock(mutex);
+    trackers.push_back(tracker);
+}
+
+void MemoryTracker::Unregister(AllocationTracker* tracker) {
+    std::lock_guard<std::mutex> lock(mutex);
+    trackers.erase(std::remove(trackers.begin(), trackers.end(), tracker), trackers.end());
+    if (tracker->reportsLeaks && tracker->liveAllocations.load(std::memory_order_relaxed) > 0) {
+        destroyedLeaks.push_back(tracker->Snapshot());
+    }
+}
+
+void MemoryTracker::BeginFrame() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (AllocationTracker* tracker : trackers) {
+        const size_t allocations = tracker->totalAllocations.load(std::memory_order_relaxed);
+        const size_t bytes = tracker->totalBytesAllocated.load(std::memory_order_relaxed);
+        tracker->lastFrameAllocations.store(
+            allocations - tracker->frameStartAllocations.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        tracker->lastFrameBytes.store(bytes - tracker->frameStartBytes.load(std::memory_order_relaxed),
+                                      std::memory_order_relaxed);
+        tracker->frameStartAllocations.store(allocations, std::memory_order_relaxed);
+        tracker->frameStartBytes.store(bytes, std::memory_order_relaxed);
+    }
+}
+
+std::vector<MemoryStats> MemoryTracker::Snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<MemoryStats> stats;
+    stats.reserve(trackers.size());
+    for (const AllocationTracker* tracker : trackers) {
+        stats.push_back(tracker->Snapshot());
+    }
+    return stats;
+}
+
+std::optional<MemoryStats> MemoryTracker::Query(const std::string& tag) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const AllocationTracker* tracker : trackers) {
+        if (tracker->tag == tag) {
+            return tracker->Snapshot();
+        }
+    }
+    return std::nullopt;
+}
+
+size_t MemoryTracker::TotalBytesInUse() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t total = 0;
+    for (const AllocationTracker* tracker : trackers) {
+        total += tracker->bytesInUse.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+std::vector<MemoryStats> MemoryTracker::Leaks() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<MemoryStats> leaks;
+    for (const AllocationTracker* tracker : trackers) {
+        if (tracker->reportsLeaks && tracker->liveAllocations.load(std::memory_order_relaxed) > 0) {
+            leaks.push_back(tracker->Snapshot());
+        }
+    }
+    leaks.insert(leaks.end(), destroyedLeaks.begin(), destroyedLeaks.end());
+    return leaks;
+}
+
+void MemoryTracker::WriteReport(std::ostream& out) const {
+    const std::vector<MemoryStats> stats = Snapshot();
+    size_t totalInUse = 0;
+    size_t totalReserved = 0;
+    for (const MemoryStats& s : stats) {
+        totalInUse += s.bytesInUse;
+        totalReserved += s.reservedBytes;
+    }
+
+    out << "Memory report: " << stats.size() << " allocators, " << totalInUse << " bytes in use, "
+        << totalReserved << " bytes reserved\n";
+    out << std::left << std::setw(24) << "tag" << std::right << std::setw(12) << "in use" << std::setw(12)
+        << "peak" << std::setw(12) << "reserved" << std::setw(10) << "live" << std::setw(12) << "allocs/frm"
+        << std::setw(12) << "bytes/frm" << std::setw(10) << "int frag" << std::setw(10) << "util" << '\n';
+    const std::ios_base::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(1);
+    for (const MemoryStats& s : stats) {
+        out << std::left << std::setw(24) << s.tag << std::right << std::setw(12) << s.bytesInUse << std::setw(12)
+            << s.peakBytes << std::setw(12) << s.reservedBytes << std::setw(10) << s.liveAllocations
+            << std::setw(12) << s.allocationsLastFrame << std::setw(12) << s.bytesAllocatedLastFrame
+            << std::setw(9) << s.InternalFragmentation() * 100.0 << '%' << std::setw(9)
+            << s.Utilization() * 100.0 << "%\n";
+    }
+    out.flags(flags);
+    ReportLeaks(out);
+}
+
+bool MemoryTracker::DumpToFile(const std::string& filepath) const {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        return false;
+    }
+    WriteReport(file);
+    return static_cast<bool>(file);
+}
+
+size_t MemoryTracker::ReportLeaks(std::ostream& out) const {
+    const std::vector<MemoryStats> leaks = Leaks();
+    for (const MemoryStats& leak : leaks) {
+        out << "Leak: " << leak.tag << " has " << leak.liveAllocations << " live allocations (" << leak.bytesInUse
+            << " bytes)\n";
+    }
+    return leaks.size();
+}
+
+} // namespace Core
+} // namespace GameEngine
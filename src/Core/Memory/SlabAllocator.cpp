@@ -0,0 +1,217 @@
+#include "GameEngine/Core/SlabAllocator.h"
+#include "GameEngine/Core/Memory.h"
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <tuple>
+
+namespace GameEngine {
+namespace Core {
+
+namespace {
+
+// 16-byte steps up to 128, then four classes per power of two up to 4096,
+// which bounds internal fragmentation at 25% above 128 bytes
+constexpr size_t ClassSizeAt(size_t index) {
+    if (index < 8) {
+        return 16 * (index + 1);
+    }
+    const size_t group = (index - 8) / 4;
+    return (size_t(128) << group) + (size_t(32) << group) * ((index - 8) % 4 + 1);
+}
+
+static_assert(ClassSizeAt(SlabAllocator::kSizeClassCount - 1) == SlabAllocator::kMaxSmallSize,
+              "Size classes must end at kMaxSmallSize");
+
+// Maps (size + 15) / 16 to a size class
+constexpr size_t kLookupSize = SlabAllocator::kMaxSmallSize / 16 + 1;
+
+constexpr std::array<uint8_t, kLookupSize> BuildClassLookup() {
+    std::array<uint8_t, kLookupSize> lookup{};
+    size_t index = 0;
+    for (size_t granule = 0; granule < kLookupSize; ++granule) {
+        while (ClassSizeAt(index) < granule * 16) {
+            ++index;
+        }
+        lookup[granule] = static_cast<uint8_t>(index);
+    }
+    return lookup;
+}
+
+constexpr std::array<uint8_t, kLookupSize> kClassLookup = BuildClassLookup();
+
+// Slabs of about 64 KB per class
+constexpr size_t ChunkSizeFor(size_t blockSize) {
+    return 65536 / blockSize > 16 ? 65536 / blockSize : 16;
+}
+
+// Raw block of one size class. The empty constructor keeps pools from
+// zeroing blocks on allocation.
+template<size_t Size>
+struct alignas(SlabAllocator::kSmallAlignment) Block {
+    Block() {}
+    unsigned char bytes[Size];
+};
+
+template<size_t Index>
+using ClassPool = GrowableMemoryPool<Block<ClassSizeAt(Index)>, ChunkSizeFor(ClassSizeAt(Index))>;
+
+template<typename Sequence>
+struct PoolTuple;
+
+template<size_t... Indices>
+struct PoolTuple<std::index_sequence<Indices...>> {
+    using Type = std::tuple<ClassPool<Indices>...>;
+};
+
+using Pools = PoolTuple<std::make_index_sequence<SlabAllocator::kSizeClassCount>>::Type;
+
+// Per-class entry points, indexed by size class
+using AllocateFn = void* (*)(Pools&);
+using DeallocateFn = void (*)(Pools&, void*);
+using UsedFn = size_t (*)(const Pools&);
+using ReservedFn = size_t (*)(const Pools&);
+
+template<size_t Index>
+void* AllocateFrom(Pools& pools) {
+    return std::get<Index>(pools).Allocate();
+}
+
+template<size_t Index>
+void DeallocateTo(Pools& pools, void* ptr) {
+    std::get<Index>(pools).Deallocate(static_cast<Block<ClassSizeAt(Index)>*>(ptr));
+}
+
+template<size_t Index>
+size_t UsedIn(const Pools& pools) {
+    return std::get<Index>(pools).UsedCount() * ClassSizeAt(Index);
+}
+
+template<size_t Index>
+size_t ReservedIn(const Pools& pools) {
+    return std::get<Index>(pools).CapacityCount() * ClassSizeAt(Index);
+}
+
+template<size_t... Indices>
+constexpr std::array<AllocateFn, sizeof...(Indices)> AllocateTable(std::index_sequence<Indices...>) {
+    return {{&AllocateFrom<Indices>...}};
+}
+
+template<size_t... Indices>
+constexpr std::array<DeallocateFn, sizeof...(Indices)> DeallocateTable(std::index_sequence<Indices...>) {
+    return {{&DeallocateTo<Indices>...}};
+}
+
+template<size_t... Indices>
+constexpr std::array<UsedFn, sizeof...(Indices)> UsedTable(std::index_sequence<Indices...>) {
+    return {{&UsedIn<Indices>...}};
+}
+
+template<size_t... Indices>
+constexpr std::array<ReservedFn, sizeof...(Indices)> ReservedTable(std::index_sequence<Indices...>) {
+    return {{&ReservedIn<Indices>...}};
+}
+
+constexpr auto kAllocate = AllocateTable(std::make_index_sequence<SlabAllocator::kSizeClassCount>());
+constexpr auto kDeallocate = DeallocateTable(std::make_index_sequence<SlabAllocator::kSizeClassCount>());
+constexpr auto kUsed = UsedTable(std::make_index_sequence<SlabAllocator::kSizeClassCount>());
+constexpr auto kReserved = ReservedTable(std::make_index_sequence<SlabAllocator::kSizeClassCount>());
+
+} // namespace
+
+struct SlabAllocator::ClassPools {
+    Pools pools;
+};
+
+SlabAllocator::SlabAllocator() : pools(std::make_unique<ClassPools>()) {}
+
+SlabAllocator::SlabAllocator(const char* tag) : SlabAllocator() {
+#if GE_MEMORY_TRACKING
+    if (tag != nullptr) {
+        tracker = std::make_unique<AllocationTracker>(
+            tag,
+            [](const void* owner) {
+                const SlabAllocator* self = static_cast<const SlabAllocator*>(owner);
+                size_t reserved = self->largeBytes.load(std::memory_order_relaxed);
+                for (ReservedFn reservedIn : kReserved) {
+                    reserved += reservedIn(self->pools->pools);
+                }
+                return reserved;
+            },
+            this);
+    }
+#else
+    (void)tag;
+#endif
+}
+
+SlabAllocator::~SlabAllocator() = default;
+
+size_t SlabAllocator::SizeClassIndex(size_t size) {
+    assert(size <= kMaxSmallSize);
+    return kClassLookup[(size + 15) / 16];
+}
+
+size_t SlabAllocator::SizeClassSize(size_t index) {
+    assert(index < kSizeClassCount);
+    return ClassSizeAt(index);
+}
+
+void* SlabAllocator::Allocate(size_t size, size_t alignment) {
+    if (size <= kMaxSmallSize && alignment <= kSmallAlignment) {
+        const size_t index = SizeClassIndex(size);
+        void* ptr = kAllocate[index](pools->pools);
+#if GE_MEMORY_TRACKING
+        if (tracker) tracker->OnAllocate(ClassSizeAt(index), size);
+#endif
+        return ptr;
+    }
+    void* ptr = ::operator new(size, std::align_val_t(alignment));
+    largeBytes.fetch_add(size, std::memory_order_relaxed);
+    largeCount.fetch_add(1, std::memory_order_relaxed);
+#if GE_MEMORY_TRACKING
+    if (tracker) tracker->OnAllocate(size, size);
+#endif
+    return ptr;
+}
+
+void SlabAllocator::Deallocate(void* ptr, size_t size, size_t alignment) {
+    if (ptr == nullptr) return;
+    if (size <= kMaxSmallSize && alignment <= kSmallAlignment) {
+        const size_t index = SizeClassIndex(size);
+        kDeallocate[index](pools->pools, ptr);
+#if GE_MEMORY_TRACKING
+        if (tracker) tracker->OnFree(ClassSizeAt(index), size);
+#endif
+        return;
+    }
+    ::operator delete(ptr, std::align_val_t(alignment));
+    largeBytes.fetch_sub(size, std::memory_order_relaxed);
+    largeCount.fetch_sub(1, std::memory_order_relaxed);
+#if GE_MEMORY_TRACKING
+    if (tracker) tracker->OnFree(size, size);
+#endif
+}
+
+size_t SlabAllocator::UsedBytes() const {
+    size_t used = largeBytes.load(std::memory_order_relaxed);
+    for (UsedFn usedIn : kUsed) {
+        used += usedIn(pools->pools);
+    }
+    return used;
+}
+
+void* SlabAllocator::do_allocate(size_t bytes, size_t alignment) {
+    return Allocate(bytes, alignment);
+}
+
+void SlabAllocator::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    Deallocate(p, bytes, alignment);
+}
+
+bool SlabAllocator::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+} // namespace Core
+} // namespace GameEngine
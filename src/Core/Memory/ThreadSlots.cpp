@@ -0,0 +1,50 @@
+#include "GameEngine/Core/Memory.h"
+#include <mutex>
+#include <vector>
+
+namespace GameEngine {
+namespace Core {
+namespace Detail {
+
+namespace {
+
+struct ThreadSlotRegistry {
+    std::mutex mutex;
+    std::vector<size_t> freeSlots;
+    size_t nextSlot = 0;
+};
+
+// Function-local so threads started during static initialization work.
+ThreadSlotRegistry& GetRegistry() {
+    static ThreadSlotRegistry registry;
+    return registry;
+}
+
+} // namespace
+
+size_t AcquireThreadSlot() {
+    ThreadSlotRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (!registry.freeSlots.empty()) {
+        size_t slot = registry.freeSlots.back();
+        registry.freeSlots.pop_back();
+        return slot;
+    }
+    if (registry.nextSlot < kMaxThreadSlots) {
+        return registry.nextSlot++;
+    }
+    return kMaxThreadSlots;
+}
+
+void ReleaseThreadSlot(size_t slot) {
+    if (slot >= kMaxThreadSlots) {
+        return;
+    }
+    ThreadSlotRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.freeSlots.push_back(slot);
+}
+
+} // namespace Detail
+} // namespace Core
+} // namespace GameEngine
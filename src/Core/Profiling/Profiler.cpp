@@ -0,0 +1,361 @@
+#include "GameEngine/Core/Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace GameEngine {
+namespace Core {
+
+namespace {
+
+using Detail::ProfileEvent;
+using Detail::ProfileThreadBuffer;
+
+struct ProfilerState {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ProfileThreadBuffer>> buffers;
+    // Index of each buffer's first event that belongs to its current
+    // thread; a reused buffer drops what its previous thread recorded
+    std::vector<uint64_t> firstEvent;
+    uint32_t nextThreadId = 1;
+    std::unordered_set<std::string> names;   // Nodes never move, so c_str() stays valid
+    std::atomic<uint64_t> frameCount{0};
+    // Events stamped before the last Clear() are ignored
+    std::atomic<uint64_t> clearTicks{0};
+    // Reference point for converting ticks to time
+    const uint64_t originTicks = BinaryLog::ReadTimestamp();
+    const std::chrono::steady_clock::time_point originTime = std::chrono::steady_clock::now();
+};
+
+ProfilerState& State() {
+    // Never destroyed: threads may retire their buffers during static teardown
+    static ProfilerState* state = new ProfilerState();
+    return *state;
+}
+
+// Retires the thread's buffer when the thread exits
+struct BufferOwner {
+    ProfileThreadBuffer* buffer = nullptr;
+    std::string threadName;   // Set before the thread had a buffer
+
+    ~BufferOwner() {
+        if (buffer != nullptr) {
+            ProfilerState& state = State();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            buffer->retired = true;
+        }
+        Detail::currentProfileBuffer = nullptr;
+    }
+};
+
+thread_local BufferOwner bufferOwner;
+
+struct Event {
+    ProfileEvent::Kind kind;
+    const char* name;
+    uint64_t begin;
+    uint64_t end;
+};
+
+struct ThreadEvents {
+    uint32_t threadId;
+    std::string threadName;
+    std::vector<Event> events;
+};
+
+// Copies the events of every thread that are still intact. Writers keep
+// going meanwhile; events they may have overwritten during the copy are
+// dropped afterwards.
+std::vector<ThreadEvents> Snapshot() {
+    ProfilerState& state = State();
+    const uint64_t clearTicks = state.clearTicks.load(std::memory_order_relaxed);
+    std::vector<ThreadEvents> threads;
+    std::lock_guard<std::mutex> lock(state.mutex);
+    threads.reserve(state.buffers.size());
+    for (size_t b = 0; b < state.buffers.size(); ++b) {
+        const ProfileThreadBuffer& buffer = *state.buffers[b];
+        const uint64_t head = buffer.head.load(std::memory_order_acquire);
+        uint64_t first = head > ProfileThreadBuffer::kCapacity ? head - ProfileThreadBuffer::kCapacity : 0;
+        first = std::max(first, state.firstEvent[b]);
+
+        std::vector<Event> events;
+        events.reserve(static_cast<size_t>(head - first));
+        for (uint64_t i = first; i < head; ++i) {
+            const ProfileEvent& slot = buffer.events[i & ProfileThreadBuffer::kMask];
+            events.push_back(Event{static_cast<ProfileEvent::Kind>(slot.kind.load(std::memory_order_relaxed)),
+                                   slot.name.load(std::memory_order_relaxed),
+                                   slot.begin.load(std::memory_order_relaxed),
+                                   slot.end.load(std::memory_order_relaxed)});
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // Slots the writer reached during the copy, plus the one it may be
+        // filling now, hold newer or torn events
+        const uint64_t after = buffer.head.load(std::memory_order_relaxed) + 1;
+        const uint64_t intact = after > ProfileThreadBuffer::kCapacity ? after - ProfileThreadBuffer::kCapacity : 0;
+        if (intact > first) {
+            events.erase(events.begin(),
+                         events.begin() + static_cast<std::ptrdiff_t>(std::min(intact - first, head - first)));
+        }
+        events.erase(std::remove_if(events.begin(), events.end(),
+                                    [clearTicks](const Event& event) { return event.begin < clearTicks; }),
+                     events.end());
+        threads.push_back(ThreadEvents{buffer.threadId, buffer.threadName, std::move(events)});
+    }
+    return threads;
+}
+
+// Maps ticks to microseconds since the profiler's origin
+class Timebase {
+public:
+    Timebase() {
+        const ProfilerState& state = State();
+        origin = state.originTicks;
+        const uint64_t ticks = BinaryLog::ReadTimestamp() - origin;
+        const double micros =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - state.originTime).count();
+        microsPerTick = ticks > 0 && micros > 0.0 ? micros / static_cast<double>(ticks) : 1e-3;
+    }
+
+    double Micros(uint64_t ticks) const {
+        // Signed: a zone may begin before the origin was taken
+        return static_cast<double>(static_cast<int64_t>(ticks - origin)) * microsPerTick;
+    }
+    double DurationMicros(uint64_t begin, uint64_t end) const {
+        return end > begin ? static_cast<double>(end - begin) * microsPerTick : 0.0;
+    }
+
+private:
+    uint64_t origin;
+    double microsPerTick;
+};
+
+double CounterValue(uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void WriteJsonString(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text != nullptr ? text : ""; *c != '\0'; ++c) {
+        const unsigned char ch = static_cast<unsigned char>(*c);
+        if (ch == '"' || ch == '\\') {
+            out << '\\' << *c;
+        } else if (ch < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(ch));
+            out << escaped;
+        } else {
+            out << *c;
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+namespace Detail {
+
+ProfileThreadBuffer* AcquireProfileBuffer() {
+    ProfilerState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    ProfileThreadBuffer* buffer = nullptr;
+    for (size_t b = 0; b < state.buffers.size(); ++b) {
+        if (state.buffers[b]->retired) {
+            buffer = state.buffers[b].get();
+            buffer->retired = false;
+            state.firstEvent[b] = buffer->head.load(std::memory_order_relaxed);
+            break;
+        }
+    }
+    if (buffer == nullptr) {
+        state.buffers.push_back(std::make_unique<ProfileThreadBuffer>());
+        state.firstEvent.push_back(0);
+        buffer = state.buffers.back().get();
+    }
+    buffer->threadId = state.nextThreadId++;
+    buffer->threadName = std::move(bufferOwner.threadName);
+    bufferOwner.buffer = buffer;
+    currentProfileBuffer = buffer;
+    return buffer;
+}
+
+} // namespace Detail
+
+std::string Profiler::FrameSummary::ToString() const {
+    char line[256];
+    std::snprintf(line, sizeof(line), "Frame %llu: %.3f ms\n", static_cast<unsigned long long>(frame), frameMs);
+    std::string text = line;
+    for (const ZoneStats& zone : zones) {
+        std::snprintf(line, sizeof(line), "  %-32s %6u calls %9.3f ms total %9.3f ms max\n", zone.name.c_str(),
+                      zone.calls, zone.totalMs, zone.maxMs);
+        text += line;
+    }
+    return text;
+}
+
+void Profiler::RecordCounter(const char* name, double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    Detail::CurrentProfileBuffer().Push(ProfileEvent::Counter, name, BinaryLog::ReadTimestamp(), bits);
+}
+
+void Profiler::FrameMark() {
+    const uint64_t frame = State().frameCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    Detail::CurrentProfileBuffer().Push(ProfileEvent::Frame, "Frame", BinaryLog::ReadTimestamp(), frame);
+}
+
+void Profiler::SetThreadName(std::string name) {
+    ProfileThreadBuffer* buffer = Detail::currentProfileBuffer;
+    if (buffer == nullptr) {
+        // Threads that never record get no buffer
+        bufferOwner.threadName = std::move(name);
+        return;
+    }
+    ProfilerState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    buffer->threadName = std::move(name);
+}
+
+const char* Profiler::InternName(std::string_view name) {
+    ProfilerState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.names.emplace(name).first->c_str();
+}
+
+Profiler::FrameSummary Profiler::SummarizeLastFrame() {
+    const std::vector<ThreadEvents> threads = Snapshot();
+    const Timebase timebase;
+
+    // The last two frame markers bound the frame
+    const Event* last = nullptr;
+    const Event* previous = nullptr;
+    for (const ThreadEvents& thread : threads) {
+        for (const Event& event : thread.events) {
+            if (event.kind != ProfileEvent::Frame) {
+                continue;
+            }
+            if (last == nullptr || event.begin > last->begin) {
+                previous = last;
+                last = &event;
+            } else if (previous == nullptr || event.begin > previous->begin) {
+                previous = &event;
+            }
+        }
+    }
+
+    FrameSummary summary;
+    if (last == nullptr || previous == nullptr) {
+        return summary;
+    }
+    summary.frame = last->end;
+    summary.frameMs = timebase.DurationMicros(previous->begin, last->begin) / 1000.0;
+
+    std::unordered_map<std::string_view, size_t> indexByName;
+    for (const ThreadEvents& thread : threads) {
+        for (const Event& event : thread.events) {
+            if (event.kind != ProfileEvent::Zone || event.end <= previous->begin || event.end > last->begin) {
+                continue;
+            }
+            const auto inserted = indexByName.emplace(event.name, summary.zones.size());
+            if (inserted.second) {
+                summary.zones.emplace_back();
+                summary.zones.back().name = event.name;
+            }
+            ZoneStats& zone = summary.zones[inserted.first->second];
+            const double ms = timebase.DurationMicros(event.begin, event.end) / 1000.0;
+            ++zone.calls;
+            zone.totalMs += ms;
+            zone.maxMs = std::max(zone.maxMs, ms);
+        }
+    }
+    std::sort(summary.zones.begin(), summary.zones.end(),
+              [](const ZoneStats& a, const ZoneStats& b) { return a.totalMs > b.totalMs; });
+    return summary;
+}
+
+void Profiler::WriteChromeTrace(std::ostream& out) {
+    const std::vector<ThreadEvents> threads = Snapshot();
+    const Timebase timebase;
+
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out.setf(std::ios_base::fixed, std::ios_base::floatfield);
+    out.precision(3);
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto beginEvent = [&out, &first]() {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+    for (const ThreadEvents& thread : threads) {
+        if (!thread.threadName.empty() && !thread.events.empty()) {
+            beginEvent();
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.threadId
+                << ",\"args\":{\"name\":";
+            WriteJsonString(out, thread.threadName.c_str());
+            out << "}}";
+        }
+        for (const Event& event : thread.events) {
+            beginEvent();
+            out << "{\"name\":";
+            WriteJsonString(out, event.name);
+            switch (event.kind) {
+            case ProfileEvent::Zone:
+                out << ",\"ph\":\"X\",\"ts\":" << timebase.Micros(event.begin)
+                    << ",\"dur\":" << timebase.DurationMicros(event.begin, event.end);
+                break;
+            case ProfileEvent::Counter: {
+                const double value = CounterValue(event.end);
+                out << ",\"ph\":\"C\",\"ts\":" << timebase.Micros(event.begin) << ",\"args\":{\"value\":"
+                    << (std::isfinite(value) ? value : 0.0) << "}";
+                break;
+            }
+            case ProfileEvent::Frame:
+                out << ",\"ph\":\"i\",\"s\":\"g\",\"ts\":" << timebase.Micros(event.begin)
+                    << ",\"args\":{\"frame\":" << event.end << "}";
+                break;
+            default:
+                break;
+            }
+            out << ",\"pid\":1,\"tid\":" << thread.threadId << "}";
+        }
+    }
+    out << "\n]}\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path, std::string* error) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        if (error) *error = "cannot open " + path + " for writing";
+        return false;
+    }
+    WriteChromeTrace(file);
+    file.flush();
+    if (!file) {
+        if (error) *error = "failed writing " + path;
+        return false;
+    }
+    return true;
+}
+
+void Profiler::Clear() {
+    ProfilerState& state = State();
+    state.clearTicks.store(BinaryLog::ReadTimestamp(), std::memory_order_relaxed);
+    state.frameCount.store(0, std::memory_order_relaxed);
+}
+
+} // namespace Core
+} // namespace GameEngine
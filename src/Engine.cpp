@@ -0,0 +1,130 @@
+#include "Engine.h"
+#include "GameEngine/Core/MemoryTracker.h"
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <utility>
+
+namespace GameEngine {
+
+Engine::Engine() : isRunning(false) {}
+
+Engine::~Engine() {
+    Shutdown();
+}
+
+bool Engine::Initialize(unsigned workerThreads) {
+    if (!jobSystem) {
+        jobSystem = std::make_unique<Core::JobSystem>(workerThreads);
+        LOG_INFO("Engine initialized with %u job threads", jobSystem->GetThreadCount());
+    }
+    // Set here rather than in Run() so a RequestExit() that arrives before
+    // the loop starts is not overwritten
+    isRunning.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void Engine::Run() {
+    if (!jobSystem) {
+        LOG_ERROR("Engine::Run called before Initialize");
+        return;
+    }
+    using Clock = std::chrono::steady_clock;
+    auto previous = Clock::now();
+    while (isRunning.load(std::memory_order_relaxed)) {
+        const auto frameStart = Clock::now();
+        const unsigned ticks = timestep.Advance(frameStart - previous);
+        previous = frameStart;
+        for (unsigned i = 0; i < ticks; ++i) {
+            Update(timestep.GetStepSeconds());
+        }
+        Render(timestep.Alpha());
+        PROFILE_FRAME();
+        BeginMemoryFrame();
+
+        if (maxFrameRate > 0.0) {
+            std::this_thread::sleep_until(frameStart + std::chrono::duration_cast<Clock::duration>(
+                                                           std::chrono::duration<double>(1.0 / maxFrameRate)));
+        }
+    }
+}
+
+Engine::HeadlessStats Engine::RunHeadless(uint64_t maxTicks) {
+    HeadlessStats stats;
+    if (!jobSystem) {
+        LOG_ERROR("Engine::RunHeadless called before Initialize");
+        return stats;
+    }
+    const float step = timestep.GetStepSeconds();
+    const auto start = std::chrono::steady_clock::now();
+    while (isRunning.load(std::memory_order_relaxed) && (maxTicks == 0 || stats.ticks < maxTicks)) {
+        Update(step);
+        PROFILE_FRAME();
+        BeginMemoryFrame();
+        ++stats.ticks;
+    }
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    isRunning.store(false, std::memory_order_relaxed);
+    LOG_INFO("Headless run: %llu ticks in %.3f s, %.0f ticks/s (%.1fx real time at %.0f Hz)",
+             static_cast<unsigned long long>(stats.ticks), stats.seconds, stats.TicksPerSecond(),
+             stats.TicksPerSecond() / timestep.GetTickRate(), timestep.GetTickRate());
+    return stats;
+}
+
+void Engine::Shutdown() {
+    isRunning.store(false, std::memory_order_relaxed);
+    if (jobSystem) {
+        jobSystem.reset();
+        LOG_INFO("Engine shut down");
+#if GE_MEMORY_TRACKING
+        // Allocators the game still owns at this point are listed too
+        Core::MemoryTracker::GetInstance().ReportLeaks(std::cerr);
+#endif
+    }
+}
+
+void Engine::BeginMemoryFrame() {
+#if GE_MEMORY_TRACKING
+    Core::MemoryTracker::GetInstance().BeginFrame();
+#endif
+}
+
+void Engine::SetTickRate(double ticksPerSecond, unsigned maxTicksPerFrame) {
+    timestep.SetTickRate(ticksPerSecond);
+    timestep.SetMaxTicksPerFrame(maxTicksPerFrame);
+}
+
+void Engine::AddUpdateSystem(std::string name, UpdateSystem update) {
+    const char* profileName = Core::Profiler::InternName(name);
+    systems.push_back(System{std::move(name), profileName, std::move(update)});
+}
+
+void Engine::AddRenderSystem(std::string name, RenderSystem render) {
+    const char* profileName = Core::Profiler::InternName(name);
+    renderers.push_back(Renderer{std::move(name), profileName, std::move(render)});
+}
+
+void Engine::Update(float deltaTime) {
+    PROFILE_SCOPE("Engine::Update");
+    // Every system is a job; this thread runs jobs too until the tick's
+    // work is done
+    Core::JobCounter tick;
+    for (System& system : systems) {
+        jobSystem->Run([this, &system, deltaTime] {
+            PROFILE_SCOPE(system.profileName);
+            system.update(deltaTime, *jobSystem);
+        }, &tick);
+    }
+    jobSystem->Wait(tick);
+    worldSystems.Run(world, *jobSystem, deltaTime);
+}
+
+void Engine::Render(float alpha) {
+    PROFILE_SCOPE("Engine::Render");
+    for (Renderer& renderer : renderers) {
+        PROFILE_SCOPE(renderer.profileName);
+        renderer.render(alpha);
+    }
+}
+
+} // namespace GameEngine
@@ -1,24 +1,99 @@
 #pragma once
-#include "Core/Logger.h"
-#include "Core/Math.h"
+#include "GameEngine/Core/ECS.h"
+#include "GameEngine/Core/FixedTimestep.h"
+#include "GameEngine/Core/JobSystem.h"
+#include "GameEngine/Core/Logger.h"
+#include "GameEngine/Core/Math.h"
+#include "GameEngine/Core/Profiler.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace GameEngine {
 
 class Engine {
+public:
+    // Per-tick simulation work, always called with the fixed step.
+    // Systems run concurrently with each other, so each touches only its
+    // own data; one may split its work further with jobs.ParallelFor().
+    using UpdateSystem = std::function<void(float deltaTime, Core::JobSystem& jobs)>;
+    // Per-frame drawing; `alpha` is FixedTimestep::Alpha(), the fraction of
+    // a tick to blend the previous and current simulation states by
+    using RenderSystem = std::function<void(float alpha)>;
+
+    struct HeadlessStats {
+        uint64_t ticks = 0;
+        double seconds = 0.0;
+        double TicksPerSecond() const { return seconds > 0.0 ? static_cast<double>(ticks) / seconds : 0.0; }
+    };
+
 private:
-    bool isRunning;
+    struct System {
+        std::string name;
+        const char* profileName;   // Core::Profiler::InternName(name)
+        UpdateSystem update;
+    };
+    struct Renderer {
+        std::string name;
+        const char* profileName;
+        RenderSystem render;
+    };
+
+    std::atomic<bool> isRunning;
+    std::unique_ptr<Core::JobSystem> jobSystem;
+    std::vector<System> systems;
+    std::vector<Renderer> renderers;
+    Core::World world;
+    Core::SystemScheduler worldSystems;
+    Core::FixedTimestep timestep;
+    double maxFrameRate = 0.0;
 
 public:
     Engine();
     ~Engine();
 
-    bool Initialize();
+    // 0 worker threads picks one thread per core. Also sets IsRunning(),
+    // so call it again before another Run() once a run has ended.
+    bool Initialize(unsigned workerThreads = 0);
+    // Runs fixed ticks as real time accumulates and renders once per frame;
+    // returns at once if RequestExit() came after Initialize()
     void Run();
+    // Runs ticks back to back with no rendering or pacing, until
+    // RequestExit() or `maxTicks` ticks (0 for no limit)
+    HeadlessStats RunHeadless(uint64_t maxTicks = 0);
     void Shutdown();
 
+    // Safe from any thread or a signal handler; Run() returns after the
+    // current frame
+    void RequestExit() { isRunning.store(false, std::memory_order_relaxed); }
+    bool IsRunning() const { return isRunning.load(std::memory_order_relaxed); }
+
+    // Simulation ticks per second (> 0) and the cap on catch-up ticks per
+    // frame
+    void SetTickRate(double ticksPerSecond, unsigned maxTicksPerFrame = 8);
+    // Frames per second Run() renders at most; 0 renders as fast as it can
+    void SetMaxFrameRate(double framesPerSecond) { maxFrameRate = framesPerSecond; }
+    const Core::FixedTimestep& GetTimestep() const { return timestep; }
+
+    // Not while Run() is executing frames
+    void AddUpdateSystem(std::string name, UpdateSystem update);
+    void AddRenderSystem(std::string name, RenderSystem render);
+    // Valid between Initialize() and Shutdown()
+    Core::JobSystem& GetJobSystem() { return *jobSystem; }
+
+    // Entities and the systems that run over them each tick, after the
+    // update systems
+    Core::World& GetWorld() { return world; }
+    Core::SystemScheduler& GetWorldSystems() { return worldSystems; }
+
 private:
     void Update(float deltaTime);
-    void Render();
+    void Render(float alpha);
+    // Closes MemoryTracker's per-frame counters in tracking builds
+    void BeginMemoryFrame();
 };
 
-} // namespace GameEngine
\ No newline at end of file
+} // namespace GameEngine
@@ -0,0 +1,81 @@
+#include "Engine.h"
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+GameEngine::Engine* runningEngine = nullptr;
+
+void HandleInterrupt(int) {
+    if (runningEngine != nullptr) {
+        runningEngine->RequestExit();
+    }
+}
+
+} // namespace
+
+// Usage: GameEngine [--tick-rate <hz>] [--headless [ticks]] [--profile <trace.json>]
+int main(int argc, char** argv) {
+    bool headless = false;
+    const char* tracePath = nullptr;
+    unsigned long long headlessTicks = 0;
+    double tickRate = 60.0;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                headlessTicks = std::strtoull(argv[++i], nullptr, 10);
+            }
+        } else if (std::strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            tickRate = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+            tracePath = argv[++i];
+        } else {
+            std::fprintf(stderr, "Usage: %s [--tick-rate <hz>] [--headless [ticks]] [--profile <trace.json>]\n",
+                         argv[0]);
+            return 2;
+        }
+    }
+    if (!(tickRate > 0.0)) {
+        std::fprintf(stderr, "Tick rate must be positive\n");
+        return 2;
+    }
+
+    if (tracePath != nullptr) {
+        GameEngine::Core::Profiler::SetThreadName("Main");
+        GameEngine::Core::Profiler::SetEnabled(true);
+    }
+
+    GameEngine::Engine engine;
+    if (!engine.Initialize()) {
+        return 1;
+    }
+    engine.SetTickRate(tickRate);
+    runningEngine = &engine;
+    std::signal(SIGINT, HandleInterrupt);
+    std::signal(SIGTERM, HandleInterrupt);
+    if (headless) {
+        const GameEngine::Engine::HeadlessStats stats = engine.RunHeadless(headlessTicks);
+        std::printf("%llu ticks in %.3f s: %.0f ticks/s\n", static_cast<unsigned long long>(stats.ticks),
+                    stats.seconds, stats.TicksPerSecond());
+    } else {
+        engine.Run();
+    }
+    engine.Shutdown();
+    runningEngine = nullptr;
+
+    if (tracePath != nullptr) {
+        GameEngine::Core::Profiler::SetEnabled(false);
+        std::printf("%s", GameEngine::Core::Profiler::SummarizeLastFrame().ToString().c_str());
+        std::string error;
+        if (!GameEngine::Core::Profiler::WriteChromeTrace(tracePath, &error)) {
+            std::fprintf(stderr, "Cannot write trace: %s\n", error.c_str());
+            return 1;
+        }
+        std::printf("Trace written to %s\n", tracePath);
+    }
+    return 0;
+}
@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/AssetArchive.h"
+#include "GameEngine/Core/FileSystem.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+class AssetArchiveTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        FileSystem::UnmountAllArchives();
+        std::remove(packFile.c_str());
+        std::remove(otherPackFile.c_str());
+        std::filesystem::remove_all(looseDirectory);
+    }
+
+    static std::vector<char> Text(const std::string& text) { return std::vector<char>(text.begin(), text.end()); }
+
+    // Repetitive data LZ4 shrinks well
+    static std::vector<char> Compressible(size_t size) {
+        std::vector<char> data(size);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = "vertex normal uv "[i % 17];
+        }
+        return data;
+    }
+
+    static std::vector<char> Random(size_t size, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::vector<char> data(size);
+        for (char& c : data) {
+            c = static_cast<char>(rng());
+        }
+        return data;
+    }
+
+    std::string packFile = "test_assets.pack";
+    std::string otherPackFile = "test_assets_other.pack";
+    std::string looseDirectory = "test_assets_loose";
+};
+
+TEST_F(AssetArchiveTest, BuildAndLookUp) {
+    const std::vector<char> mesh = Compressible(100000);
+    const std::vector<char> noise = Random(5000, 1);
+    AssetArchiveBuilder builder(256);
+    builder.AddData("meshes/hero.mesh", mesh, AssetPack::Compression::Lz4);
+    builder.AddData("textures\\noise.tex", noise, AssetPack::Compression::Lz4);
+    builder.AddData("./config/game.ini", Text("fullscreen=1\n"));
+    builder.AddData("empty.txt", {});
+    builder.AddData("config/game.ini", Text("fullscreen=0\n"));   // Replaces the first
+    EXPECT_EQ(builder.EntryCount(), 4u);
+    ASSERT_TRUE(builder.Write(packFile));
+
+    auto archive = AssetArchive::Open(packFile);
+    ASSERT_NE(archive, nullptr);
+    ASSERT_EQ(archive->EntryCount(), 4u);
+    EXPECT_EQ(archive->EntryPath(archive->EntryAt(0)), "config/game.ini");
+
+    const AssetPack::Entry* meshEntry = archive->Find("meshes/hero.mesh");
+    ASSERT_NE(meshEntry, nullptr);
+    EXPECT_EQ(meshEntry->compression, AssetPack::Compression::Lz4);
+    EXPECT_LT(meshEntry->storedSize, mesh.size() / 4);
+    EXPECT_EQ(meshEntry->offset % 256, 0u);
+    EXPECT_EQ(*archive->Read(*meshEntry), mesh);
+
+    // Random bytes do not compress, so they are stored as is
+    const AssetPack::Entry* noiseEntry = archive->Find("textures/noise.tex");
+    ASSERT_NE(noiseEntry, nullptr);
+    EXPECT_EQ(noiseEntry->compression, AssetPack::Compression::None);
+    EXPECT_EQ(*archive->Read(*noiseEntry), noise);
+
+    const AssetPack::Entry* ini = archive->Find("config/game.ini");
+    ASSERT_NE(ini, nullptr);
+    EXPECT_EQ(archive->StoredData(*ini), "fullscreen=0\n");
+    ASSERT_NE(archive->Find("empty.txt"), nullptr);
+    EXPECT_TRUE(archive->Read(*archive->Find("empty.txt"))->empty());
+
+    EXPECT_EQ(archive->Find("meshes/villain.mesh"), nullptr);
+    EXPECT_EQ(archive->Find("meshes"), nullptr);
+}
+
+TEST_F(AssetArchiveTest, MapIsZeroCopyForStoredEntries) {
+    AssetArchiveBuilder builder;
+    builder.AddData("raw.bin", Random(4096, 2));
+    builder.AddData("packed.bin", Compressible(4096), AssetPack::Compression::Lz4);
+    ASSERT_TRUE(builder.Write(packFile));
+
+    MappedFile raw;
+    {
+        auto archive = AssetArchive::Open(packFile);
+        ASSERT_NE(archive, nullptr);
+        const AssetPack::Entry* entry = archive->Find("raw.bin");
+        raw = std::move(*archive->Map(*entry));
+        EXPECT_EQ(raw.Data(), archive->StoredData(*entry).data());
+
+        auto packed = archive->Map(*archive->Find("packed.bin"));
+        ASSERT_TRUE(packed.has_value());
+        EXPECT_EQ(std::vector<char>(packed->begin(), packed->end()), Compressible(4096));
+    }
+    // The view keeps the archive mapped after the last other reference
+    EXPECT_EQ(std::vector<char>(raw.begin(), raw.end()), Random(4096, 2));
+}
+
+TEST_F(AssetArchiveTest, RejectsCorruptArchives) {
+    std::string error;
+    EXPECT_EQ(AssetArchive::Open("missing.pack", &error), nullptr);
+    ASSERT_TRUE(FileSystem::WriteTextFile(packFile, "not a pack at all, just some text"));
+    EXPECT_EQ(AssetArchive::Open(packFile, &error), nullptr);
+    EXPECT_FALSE(error.empty());
+
+    AssetArchiveBuilder builder;
+    builder.AddData("a.bin", Compressible(10000), AssetPack::Compression::Lz4);
+    ASSERT_TRUE(builder.Write(packFile));
+    auto bytes = *FileSystem::ReadBinaryFile(packFile);
+
+    // Truncated: the index no longer fits in the file
+    ASSERT_TRUE(FileSystem::WriteBinaryFile(packFile, std::vector<char>(bytes.begin(), bytes.end() - 8)));
+    EXPECT_EQ(AssetArchive::Open(packFile), nullptr);
+
+    // Every hash bucket pointing at the one entry: a lookup of a missing
+    // path would never reach an empty bucket
+    AssetPack::Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    std::vector<char> fullTable = bytes;
+    for (uint32_t i = 0; i < header.hashTableSize; ++i) {
+        const uint32_t index = 0;
+        std::memcpy(fullTable.data() + header.hashTableOffset + i * sizeof(index), &index, sizeof(index));
+    }
+    ASSERT_TRUE(FileSystem::WriteBinaryFile(packFile, fullTable));
+    EXPECT_EQ(AssetArchive::Open(packFile, &error), nullptr);
+    EXPECT_EQ(error, "corrupt archive hash table");
+
+    // Damaged compressed payload: opens, but the entry fails to decode
+    std::vector<char> damaged = bytes;
+    const size_t payload = AssetPack::kDefaultAlignment;
+    for (size_t i = payload; i < payload + 64; ++i) {
+        damaged[i] = static_cast<char>(0xFF);
+    }
+    ASSERT_TRUE(FileSystem::WriteBinaryFile(packFile, damaged));
+    auto archive = AssetArchive::Open(packFile);
+    ASSERT_NE(archive, nullptr);
+    const auto result = archive->Read(*archive->Find("a.bin"));
+    EXPECT_TRUE(!result.has_value() || *result != Compressible(10000));
+}
+
+TEST_F(AssetArchiveTest, FileSystemResolvesThroughMounts) {
+    std::filesystem::create_directories(looseDirectory + "/levels");
+    ASSERT_TRUE(FileSystem::WriteTextFile(looseDirectory + "/levels/one.lvl", "level one"));
+    ASSERT_TRUE(FileSystem::WriteTextFile(looseDirectory + "/readme.txt", "hello"));
+    AssetArchiveBuilder builder;
+    EXPECT_EQ(builder.AddDirectory(looseDirectory, AssetPack::Compression::Lz4), 2u);
+    ASSERT_TRUE(builder.Write(packFile));
+
+    AssetArchiveBuilder patch;
+    patch.AddData("levels/one.lvl", Text("level one, patched"));
+    ASSERT_TRUE(patch.Write(otherPackFile));
+
+    EXPECT_FALSE(FileSystem::FileExists("data/levels/one.lvl"));
+    EXPECT_FALSE(FileSystem::MountArchive("missing.pack", "data"));
+    ASSERT_TRUE(FileSystem::MountArchive(packFile, "data/"));
+    EXPECT_TRUE(FileSystem::FileExists("data/levels/one.lvl"));
+    EXPECT_TRUE(FileSystem::FileExists("./data/readme.txt"));
+    EXPECT_FALSE(FileSystem::FileExists("levels/one.lvl"));
+    EXPECT_EQ(*FileSystem::ReadTextFile("data/readme.txt"), "hello");
+    const auto binary = FileSystem::ReadBinaryFile("data\\levels\\one.lvl");
+    ASSERT_TRUE(binary.has_value());
+    EXPECT_EQ(std::string(binary->begin(), binary->end()), "level one");
+
+    // Newer mounts win
+    ASSERT_TRUE(FileSystem::MountArchive(otherPackFile, "data"));
+    EXPECT_EQ(FileSystem::MapFile("data/levels/one.lvl")->View(), "level one, patched");
+    EXPECT_EQ(*FileSystem::ReadTextFile("data/readme.txt"), "hello");
+
+    EXPECT_TRUE(FileSystem::UnmountArchive(otherPackFile));
+    EXPECT_FALSE(FileSystem::UnmountArchive(otherPackFile));
+    EXPECT_EQ(*FileSystem::ReadTextFile("data/levels/one.lvl"), "level one");
+    FileSystem::UnmountAllArchives();
+    EXPECT_FALSE(FileSystem::FileExists("data/readme.txt"));
+    // Loose files are still found on disk
+    EXPECT_TRUE(FileSystem::FileExists(looseDirectory + "/readme.txt"));
+}
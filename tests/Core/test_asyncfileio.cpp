@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/AsyncFileIO.h"
+#include "GameEngine/Core/FileSystem.h"
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+class AsyncFileIOTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        for (const std::string& file : files) {
+            std::remove(file.c_str());
+        }
+    }
+
+    std::string MakeFile(const std::string& name, size_t size) {
+        std::vector<char> data(size);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<char>('a' + i % 26);
+        }
+        EXPECT_TRUE(FileSystem::WriteBinaryFile(name, data));
+        files.push_back(name);
+        return name;
+    }
+
+    static std::vector<AsyncFileIO::Backend> Backends() {
+        return {AsyncFileIO::Backend::Auto, AsyncFileIO::Backend::ThreadPool};
+    }
+
+    std::vector<std::string> files;
+};
+
+TEST_F(AsyncFileIOTest, ReadsFilesAndRanges) {
+    const std::string small = MakeFile("async_small.bin", 100);
+    const std::string large = MakeFile("async_large.bin", 3 * 1024 * 1024 + 7);
+    const std::string empty = MakeFile("async_empty.bin", 0);
+
+    for (AsyncFileIO::Backend backend : Backends()) {
+        AsyncFileIO io(backend);
+        std::atomic<int> callbacks{0};
+        ReadHandle whole = io.Read(large, IOPriority::Normal, [&](ReadResult& result) {
+            EXPECT_EQ(result.status, IOStatus::Completed);
+            ++callbacks;
+        });
+
+        AsyncFileIO::ReadRequest range;
+        range.path = small;
+        range.offset = 26;
+        range.length = 3;
+        AsyncFileIO::ReadRequest pastEnd;
+        pastEnd.path = small;
+        pastEnd.offset = 90;
+        pastEnd.length = 50;
+        AsyncFileIO::ReadRequest missing;
+        missing.path = "async_missing.bin";
+        missing.onComplete = [&](ReadResult& result) {
+            EXPECT_EQ(result.status, IOStatus::Failed);
+            ++callbacks;
+        };
+        AsyncFileIO::ReadRequest emptyFile;
+        emptyFile.path = empty;
+        std::vector<ReadHandle> batch = io.ReadBatch({range, pastEnd, missing, emptyFile});
+
+        ReadResult& wholeResult = whole.Wait();
+        ASSERT_EQ(wholeResult.status, IOStatus::Completed);
+        EXPECT_EQ(wholeResult.data, *FileSystem::ReadBinaryFile(large));
+
+        EXPECT_EQ(std::string(batch[0].Wait().data.data(), 3), "abc");
+        EXPECT_EQ(batch[1].Wait().data.size(), 10u);
+        EXPECT_EQ(batch[2].Wait().status, IOStatus::Failed);
+        EXPECT_EQ(batch[2].Wait().error, ENOENT);
+        EXPECT_EQ(batch[3].Wait().status, IOStatus::Completed);
+        EXPECT_TRUE(batch[3].Wait().data.empty());
+
+        io.WaitIdle();
+        EXPECT_EQ(callbacks.load(), 2);
+        EXPECT_TRUE(whole.IsDone());
+    }
+}
+
+TEST_F(AsyncFileIOTest, HigherPriorityIssuedFirst) {
+    const std::string file = MakeFile("async_priority.bin", 64);
+    for (AsyncFileIO::Backend backend : Backends()) {
+        // Queue depth 1 and one worker: requests are issued one at a time
+        AsyncFileIO io(backend, 1, 1);
+        std::mutex mutex;
+        std::vector<int> order;
+        std::vector<AsyncFileIO::ReadRequest> requests;
+        const IOPriority priorities[] = {IOPriority::Low, IOPriority::Normal, IOPriority::High, IOPriority::Normal};
+        for (int i = 0; i < 4; ++i) {
+            AsyncFileIO::ReadRequest request;
+            request.path = file;
+            request.priority = priorities[i];
+            request.onComplete = [&, i](ReadResult&) {
+                std::lock_guard<std::mutex> lock(mutex);
+                order.push_back(i);
+            };
+            requests.push_back(std::move(request));
+        }
+        io.ReadBatch(std::move(requests));
+        io.WaitIdle();
+        EXPECT_EQ(order, (std::vector<int>{2, 1, 3, 0}));
+    }
+}
+
+TEST_F(AsyncFileIOTest, CancelQueuedRequests) {
+    const std::string file = MakeFile("async_cancel.bin", 64);
+    for (AsyncFileIO::Backend backend : Backends()) {
+        AsyncFileIO io(backend, 1, 1);
+        // The first completion blocks the only I/O thread, so later
+        // requests stay queued until released
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        ReadHandle blocker = io.Read(file, IOPriority::High, [released](ReadResult&) { released.wait(); });
+
+        std::atomic<int> cancelledCallbacks{0};
+        auto countCancelled = [&](ReadResult& result) {
+            if (result.status == IOStatus::Cancelled) ++cancelledCallbacks;
+        };
+        ReadHandle kept = io.Read(file, IOPriority::Normal, countCancelled);
+        ReadHandle dropped = io.Read(file, IOPriority::Normal, countCancelled);
+
+        EXPECT_TRUE(dropped.Cancel());
+        EXPECT_TRUE(dropped.IsDone());
+        EXPECT_EQ(dropped.Status(), IOStatus::Cancelled);
+        EXPECT_EQ(cancelledCallbacks.load(), 1);
+        EXPECT_FALSE(dropped.Cancel());
+
+        release.set_value();
+        EXPECT_EQ(kept.Wait().status, IOStatus::Completed);
+        EXPECT_EQ(blocker.Wait().status, IOStatus::Completed);
+        EXPECT_FALSE(kept.Cancel());
+        EXPECT_EQ(cancelledCallbacks.load(), 1);
+    }
+}
+
+TEST_F(AsyncFileIOTest, DestructionFinishesEveryRequest) {
+    const std::string file = MakeFile("async_shutdown.bin", 4096);
+    for (AsyncFileIO::Backend backend : Backends()) {
+        std::vector<ReadHandle> handles;
+        {
+            AsyncFileIO io(backend, 4, 2);
+            for (int i = 0; i < 200; ++i) {
+                handles.push_back(io.Read(file));
+            }
+        }
+        for (const ReadHandle& handle : handles) {
+            ASSERT_TRUE(handle.IsDone());
+            const IOStatus status = handle.Status();
+            EXPECT_TRUE(status == IOStatus::Completed || status == IOStatus::Cancelled);
+        }
+    }
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/BinaryLog.h"
+#include "GameEngine/Core/Logger.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+class BinaryLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::remove(logFile.c_str());
+    }
+
+    void TearDown() override {
+        Logger::GetInstance().Shutdown();
+        std::remove(logFile.c_str());
+    }
+
+    std::string Decode(BinaryLog::DecodeFormat format, bool expectOk = true) {
+        std::ifstream in(logFile, std::ios::binary);
+        std::ostringstream out;
+        std::string error;
+        EXPECT_EQ(BinaryLog::Decode(in, out, format, &error), expectOk) << error;
+        return out.str();
+    }
+
+    std::string logFile = "test_binary_log.bin";
+};
+
+TEST_F(BinaryLogTest, ArgumentCodes) {
+    EXPECT_EQ(BinaryLog::ArgCode<int>::value, BinaryLog::kInt32);
+    EXPECT_EQ(BinaryLog::ArgCode<short>::value, BinaryLog::kInt32);
+    EXPECT_EQ(BinaryLog::ArgCode<int64_t>::value, BinaryLog::kInt64);
+    EXPECT_EQ(BinaryLog::ArgCode<unsigned>::value, BinaryLog::kUInt32);
+    EXPECT_EQ(BinaryLog::ArgCode<uint64_t>::value, BinaryLog::kUInt64);
+    EXPECT_EQ(BinaryLog::ArgCode<float>::value, BinaryLog::kDouble);
+    EXPECT_EQ(BinaryLog::ArgCode<const char*>::value, BinaryLog::kString);
+    EXPECT_EQ(BinaryLog::ArgCode<char*>::value, BinaryLog::kString);
+    EXPECT_EQ(BinaryLog::ArgCode<const int*>::value, BinaryLog::kPointer);
+}
+
+TEST_F(BinaryLogTest, RoundTripText) {
+    Logger& logger = Logger::GetInstance();
+    logger.Initialize(logFile, LogLevel::Info, LogMode::Binary);
+    ASSERT_EQ(logger.GetMode(), LogMode::Binary);
+
+    for (int i = 0; i < 3; ++i) {
+        LOG_EVENT(LogLevel::Info, "frame %d entity %u at (%.2f, %+.1f) name=%-6s|", i, 7u + static_cast<unsigned>(i),
+                  1.25 * i, -2.5f, "orc");
+    }
+    LOG_EVENT(LogLevel::Debug, "filtered %d", 1);
+    LOG_EVENT(LogLevel::Warning, "big %lld hex %08x char %c pct 100%%", 1LL << 40, 0xBEEFu, 'A');
+    LOG_ERROR("plain text %s", "still works");
+    LOG_INFO(std::string("a std::string message"));
+    logger.Shutdown();
+
+    const std::string text = Decode(BinaryLog::DecodeFormat::Text);
+    EXPECT_NE(text.find("] [INFO] frame 0 entity 7 at (0.00, -2.5) name=orc   |\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("] [INFO] frame 2 entity 9 at (2.50, -2.5) name=orc   |\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("] [WARNING] big 1099511627776 hex 0000beef char A pct 100%\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("] [ERROR] plain text still works\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("] [INFO] a std::string message\n"), std::string::npos) << text;
+    EXPECT_EQ(text.find("filtered"), std::string::npos);
+    // Clock syncs at open and shutdown give every event a wall-clock time
+    EXPECT_EQ(text.find("[t="), std::string::npos);
+    EXPECT_LT(text.find("frame 0"), text.find("frame 1"));
+}
+
+TEST_F(BinaryLogTest, RoundTripJson) {
+    Logger& logger = Logger::GetInstance();
+    logger.Initialize(logFile, LogLevel::Debug, LogMode::Binary);
+    LOG_EVENT(LogLevel::Info, "say \"%s\" %d %g", "hi\n", -3, 0.5);
+    logger.Shutdown();
+
+    const std::string json = Decode(BinaryLog::DecodeFormat::Json);
+    EXPECT_NE(json.find("\"level\":\"INFO\""), std::string::npos) << json;
+    EXPECT_NE(json.find("\"file\":\""), std::string::npos) << json;
+    EXPECT_NE(json.find("test_binarylog.cpp\""), std::string::npos) << json;
+    EXPECT_NE(json.find("\"args\":[\"hi\\n\",-3,0.5]"), std::string::npos) << json;
+    EXPECT_NE(json.find("\"message\":\"say \\\"hi\\n\\\" -3 0.5\""), std::string::npos) << json;
+}
+
+TEST_F(BinaryLogTest, DefinitionsReplayedIntoEachFile) {
+    Logger& logger = Logger::GetInstance();
+    // The same call site logs into two files; each must be self-contained
+    for (int file = 0; file < 2; ++file) {
+        logger.Initialize(logFile, LogLevel::Debug, LogMode::Binary);
+        for (int i = 0; i < 2; ++i) {
+            LOG_EVENT(LogLevel::Info, "file %d event %d", file, i);
+        }
+        logger.Shutdown();
+        const std::string text = Decode(BinaryLog::DecodeFormat::Text);
+        EXPECT_NE(text.find("file " + std::to_string(file) + " event 1"), std::string::npos) << text;
+    }
+}
+
+TEST_F(BinaryLogTest, TextModesFormatEvents) {
+    Logger& logger = Logger::GetInstance();
+    logger.Initialize(logFile, LogLevel::Debug);
+    LOG_EVENT(LogLevel::Info, "value %d", 5);
+    logger.Shutdown();
+
+    std::ifstream in(logFile);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    EXPECT_NE(contents.str().find("[INFO] value 5\n"), std::string::npos);
+}
+
+TEST_F(BinaryLogTest, RejectsBadInput) {
+    {
+        std::ofstream out(logFile, std::ios::binary);
+        out << "definitely not a log";
+    }
+    Decode(BinaryLog::DecodeFormat::Text, false);
+
+    Logger& logger = Logger::GetInstance();
+    logger.Initialize(logFile, LogLevel::Debug, LogMode::Binary);
+    LOG_EVENT(LogLevel::Info, "complete %d", 1);
+    logger.Shutdown();
+    {
+        // Cut the file in the middle of its last record
+        std::ifstream in(logFile, std::ios::binary);
+        std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        std::ofstream out(logFile, std::ios::binary | std::ios::trunc);
+        out.write(data.data(), static_cast<std::streamsize>(data.size() - 3));
+    }
+    const std::string text = Decode(BinaryLog::DecodeFormat::Text, false);
+    EXPECT_NE(text.find("complete 1"), std::string::npos);
+}
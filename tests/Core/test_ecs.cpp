@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/ECS.h"
+#include <atomic>
+#include <utility>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+namespace {
+
+struct Position {
+    float x, y, z;
+};
+
+struct Velocity {
+    float x, y, z;
+};
+
+struct Health {
+    int value;
+};
+
+struct Tag {
+    uint32_t id;
+};
+
+} // namespace
+
+TEST(ECSTest, CreateGetAddRemove) {
+    World world;
+    const Entity entity = world.CreateEntity(Position{1.0f, 2.0f, 3.0f});
+    ASSERT_FALSE(entity.IsNull());
+    EXPECT_TRUE(world.IsAlive(entity));
+    EXPECT_TRUE(world.Has<Position>(entity));
+    EXPECT_FALSE(world.Has<Velocity>(entity));
+    EXPECT_EQ(world.Get<Velocity>(entity), nullptr);
+    EXPECT_EQ(world.Get<Position>(entity)->y, 2.0f);
+
+    // Adding moves the entity to a new archetype and keeps its data
+    ASSERT_TRUE(world.Add(entity, Velocity{4.0f, 5.0f, 6.0f}));
+    EXPECT_EQ(world.ArchetypeCount(), 2u);
+    EXPECT_EQ(world.Get<Position>(entity)->z, 3.0f);
+    EXPECT_EQ(world.Get<Velocity>(entity)->x, 4.0f);
+    ASSERT_TRUE(world.Add(entity, Velocity{7.0f, 8.0f, 9.0f}));
+    EXPECT_EQ(world.Get<Velocity>(entity)->x, 7.0f);
+
+    ASSERT_TRUE(world.Remove<Position>(entity));
+    EXPECT_FALSE(world.Has<Position>(entity));
+    EXPECT_EQ(world.Get<Velocity>(entity)->z, 9.0f);
+    EXPECT_EQ(world.ArchetypeCount(), 3u);
+
+    const Entity empty = world.CreateEntity();
+    EXPECT_TRUE(world.IsAlive(empty));
+    EXPECT_EQ(world.EntityCount(), 2u);
+
+    EXPECT_TRUE(world.DestroyEntity(entity));
+    EXPECT_FALSE(world.IsAlive(entity));
+    EXPECT_FALSE(world.DestroyEntity(entity));
+    EXPECT_EQ(world.Get<Velocity>(entity), nullptr);
+    EXPECT_FALSE(world.Add(entity, Health{1}));
+    EXPECT_EQ(world.EntityCount(), 1u);
+}
+
+TEST(ECSTest, QueriesVisitMatchingEntities) {
+    World world;
+    for (int i = 0; i < 100; ++i) {
+        world.CreateEntity(Position{1.0f, 0.0f, 0.0f});
+        world.CreateEntity(Position{1.0f, 0.0f, 0.0f}, Velocity{2.0f, 0.0f, 0.0f});
+    }
+    for (int i = 0; i < 50; ++i) {
+        world.CreateEntity(Velocity{3.0f, 0.0f, 0.0f}, Health{i});
+    }
+    EXPECT_EQ(world.Count<Position>(), 200u);
+    EXPECT_EQ((world.Count<Position, Velocity>()), 100u);
+    EXPECT_EQ(world.Count<Velocity>(), 150u);
+    EXPECT_EQ(world.Count<>(), 250u);
+
+    world.Each<Position, const Velocity>([](Position& position, const Velocity& velocity) {
+        position.x += velocity.x;
+    });
+    float sum = 0.0f;
+    world.Each<const Position>([&sum](const Position& position) { sum += position.x; });
+    EXPECT_FLOAT_EQ(sum, 100.0f * 1.0f + 100.0f * 3.0f);
+
+    size_t visited = 0;
+    world.Each<Health>([&](Entity entity, Health& health) {
+        EXPECT_EQ(world.Get<Health>(entity), &health);
+        ++visited;
+    });
+    EXPECT_EQ(visited, 50u);
+
+    size_t chunkRows = 0;
+    world.EachChunk<const Velocity>([&](size_t count, const Entity* entities, const Velocity* velocities) {
+        ASSERT_NE(entities, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(velocities) % Detail::kColumnAlignment, 0u);
+        chunkRows += count;
+    });
+    EXPECT_EQ(chunkRows, 150u);
+}
+
+TEST(ECSTest, DestroyKeepsRowsPackedAndRecordsValid) {
+    World world;
+    std::vector<Entity> entities;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        entities.push_back(world.CreateEntity(Tag{i}, Position{static_cast<float>(i), 0.0f, 0.0f}));
+    }
+    for (size_t i = 0; i < entities.size(); i += 3) {
+        ASSERT_TRUE(world.DestroyEntity(entities[i]));
+    }
+    for (size_t i = 0; i < entities.size(); ++i) {
+        if (i % 3 == 0) {
+            EXPECT_FALSE(world.IsAlive(entities[i]));
+            continue;
+        }
+        ASSERT_EQ(world.Get<Tag>(entities[i])->id, i);
+        ASSERT_EQ(world.Get<Position>(entities[i])->x, static_cast<float>(i));
+    }
+    EXPECT_EQ(world.Count<Tag>(), 5000u - 1667u);
+
+    // Moving the survivors out empties the archetype's chunks entirely
+    for (size_t i = 0; i < entities.size(); ++i) {
+        if (i % 3 != 0) {
+            world.Remove<Tag>(entities[i]);
+        }
+    }
+    EXPECT_EQ(world.Count<Tag>(), 0u);
+    size_t chunks = 0;
+    world.EachChunk<Tag>([&chunks](size_t, const Entity*, Tag*) { ++chunks; });
+    EXPECT_EQ(chunks, 0u);
+    EXPECT_EQ(world.Count<Position>(), 5000u - 1667u);
+}
+
+TEST(ECSTest, CommandBufferDefersStructuralChanges) {
+    World world;
+    for (int i = 0; i < 10; ++i) {
+        world.CreateEntity(Health{i});
+    }
+    CommandBuffer commands;
+    world.Each<const Health>([&commands](Entity entity, const Health& health) {
+        if (health.value % 2 == 0) {
+            commands.DestroyEntity(entity);
+        } else {
+            commands.Add(entity, Tag{static_cast<uint32_t>(health.value)});
+            commands.CreateEntity(Position{static_cast<float>(health.value), 0.0f, 0.0f}, Tag{99});
+        }
+    });
+    EXPECT_EQ(world.EntityCount(), 10u);
+    EXPECT_EQ(commands.CommandCount(), 15u);
+
+    commands.Playback(world);
+    EXPECT_TRUE(commands.Empty());
+    EXPECT_EQ(world.Count<Health>(), 5u);
+    EXPECT_EQ((world.Count<Health, Tag>()), 5u);
+    EXPECT_EQ((world.Count<Position, Tag>()), 5u);
+    world.Each<const Health, const Tag>([](const Health& health, const Tag& tag) {
+        EXPECT_EQ(static_cast<uint32_t>(health.value), tag.id);
+    });
+
+    // Commands on entities that died meanwhile are skipped
+    Entity doomed = world.CreateEntity(Health{100});
+    commands.Add(doomed, Tag{1});
+    commands.Remove<Health>(doomed);
+    world.DestroyEntity(doomed);
+    commands.Playback(world);
+    EXPECT_EQ(world.EntityCount(), 10u);
+}
+
+TEST(ECSTest, SchedulerStagesConflictingSystems) {
+    SystemScheduler scheduler;
+    std::atomic<int> order{0};
+    int moveRan = -1;
+    int spawnRan = -1;
+    scheduler.Add("Move", ComponentMaskOf<Velocity>(), ComponentMaskOf<Position>(), [&](SystemContext& context) {
+        context.world.ParallelEach<Position, const Velocity>(context.jobs, [&context](Position& p, const Velocity& v) {
+            p.x += v.x * context.deltaTime;
+        });
+        moveRan = order++;
+    });
+    scheduler.Add("Damage", 0, ComponentMaskOf<Health>(), [](SystemContext& context) {
+        context.world.Each<Health>([](Health& health) { --health.value; });
+    });
+    scheduler.Add("Spawn", ComponentMaskOf<Position>(), 0, [&](SystemContext& context) {
+        context.world.Each<const Position>([&context](const Position& position) {
+            if (position.x >= 2.0f) {
+                context.commands.CreateEntity(Tag{1});
+            }
+        });
+        spawnRan = order++;
+    });
+    scheduler.Add("Cleanup", 0, kAllComponents, [](SystemContext&) {});
+    // Declares nothing, but still must not overlap the structural writer
+    scheduler.Add("Stats", 0, 0, [](SystemContext&) {});
+
+    EXPECT_EQ(scheduler.StageOf(0), 0u);
+    EXPECT_EQ(scheduler.StageOf(1), 0u);   // Touches nothing Move touches
+    EXPECT_EQ(scheduler.StageOf(2), 1u);   // Reads what Move writes
+    EXPECT_EQ(scheduler.StageOf(3), 2u);
+    EXPECT_EQ(scheduler.StageOf(4), 3u);
+    EXPECT_EQ(scheduler.StageCount(), 4u);
+
+    World world;
+    JobSystem jobs(2);
+    for (int i = 0; i < 1000; ++i) {
+        world.CreateEntity(Position{1.0f, 0.0f, 0.0f}, Velocity{2.0f, 0.0f, 0.0f}, Health{10});
+    }
+    scheduler.Run(world, jobs, 0.5f);
+    EXPECT_LT(moveRan, spawnRan);
+    EXPECT_EQ(world.Count<Tag>(), 1000u);
+    world.Each<const Position, const Health>([](const Position& position, const Health& health) {
+        EXPECT_FLOAT_EQ(position.x, 2.0f);
+        EXPECT_EQ(health.value, 9);
+    });
+}
+
+template<size_t N>
+struct Filler {
+    uint8_t bytes[N % 7 + 1];
+};
+
+template<size_t... Is>
+void RegisterFillers(std::index_sequence<Is...>) {
+    (ComponentTypeId<Filler<Is>>(), ...);
+}
+
+struct Large {
+    unsigned char bytes[4096];
+};
+template<int N>
+struct LargeVariant : Large {};
+
+TEST(ECSDeathTest, LimitsAbortInEveryBuildType) {
+    EXPECT_DEATH(RegisterFillers(std::make_index_sequence<kMaxComponentTypes + 1>()), "component types");
+    // Each fits a chunk alone, together they do not
+    EXPECT_DEATH(
+        {
+            World world;
+            world.CreateEntity(LargeVariant<0>{}, LargeVariant<1>{}, LargeVariant<2>{}, LargeVariant<3>{});
+        },
+        "too large for a chunk");
+}
+
+TEST(ECSTest, EachAndParallelEachVisitEveryChunk) {
+    // Enough entities to fill many chunks, with a partly filled last one
+    const size_t kEntities = 100003;
+    World world;
+    for (size_t i = 0; i < kEntities; ++i) {
+        world.CreateEntity(Position{0.0f, 0.0f, 0.0f}, Velocity{1.0f, 2.0f, 3.0f});
+    }
+    ASSERT_EQ((world.Count<Position, Velocity>()), kEntities);
+
+    world.Each<Position, const Velocity>([](Position& p, const Velocity& v) { p.z += v.z; });
+    JobSystem jobs(3);
+    world.ParallelEach<Position, const Velocity>(jobs, [](Position& p, const Velocity& v) { p.z += v.z; });
+
+    size_t visited = 0;
+    size_t wrong = 0;
+    world.Each<const Position>([&](const Position& p) {
+        ++visited;
+        wrong += p.z != 6.0f;
+    });
+    EXPECT_EQ(visited, kEntities);
+    EXPECT_EQ(wrong, 0u);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/FastMath.h"
+#include "../TestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace GameEngine::Math;
+
+// Error bounds documented in FastMath.h
+static const double kSinCosMaxError = 5e-7;
+static const double kInvSqrtMaxRelativeError = 5e-7;
+static const float kNormalizedMaxLengthError = 1e-6f;
+
+static bool vectorsNear(const Vector3& a, const Vector3& b, float epsilon) {
+    return std::abs(a.x - b.x) <= epsilon && std::abs(a.y - b.y) <= epsilon && std::abs(a.z - b.z) <= epsilon;
+}
+
+class FastMathTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = GetSimdBackend();
+        // Dense near zero, sparse up to the documented |x| <= 8192 limit
+        for (int i = -20000; i <= 20000; ++i) {
+            angles.push_back(static_cast<float>(i) * 0.001f);
+        }
+        for (int i = -8192; i <= 8192; ++i) {
+            angles.push_back(static_cast<float>(i) + 0.37f);
+        }
+        angles.push_back(8192.0f);
+        angles.push_back(-8192.0f);
+
+        for (size_t i = 0; i < 1001; ++i) {
+            float f = static_cast<float>(i);
+            vectors.push_back(Vector3(std::sin(f) * (1.0f + f), std::cos(f * 0.3f) * 1e-3f, f * 0.01f - 5.0f));
+        }
+        vectors.push_back(Vector3(0.0f, 0.0f, 0.0f));
+        vectors.push_back(Vector3(1e-18f, 0.0f, 0.0f));
+        vectors.push_back(Vector3(1e18f, -1e18f, 1e17f));
+    }
+
+    void TearDown() override {
+        SetSimdBackend(original);
+    }
+
+    SimdBackend original = SimdBackend::Scalar;
+    std::vector<float> angles;
+    std::vector<Vector3> vectors;
+};
+
+TEST_F(FastMathTest, SinCosHelperMatchesStd) {
+    for (float angle : {0.0f, 0.5f, -1.25f, 3.0f, 100.0f}) {
+        float s, c;
+        SinCos(angle, s, c);
+        EXPECT_FLOAT_EQ(s, std::sin(angle));
+        EXPECT_FLOAT_EQ(c, std::cos(angle));
+    }
+}
+
+TEST_F(FastMathTest, SinCosWithinBound) {
+    double maxError = 0.0;
+    for (float angle : angles) {
+        float s, c;
+        Fast::SinCos(angle, s, c);
+        const double x = static_cast<double>(angle);
+        maxError = std::max(maxError, std::abs(static_cast<double>(s) - std::sin(x)));
+        maxError = std::max(maxError, std::abs(static_cast<double>(c) - std::cos(x)));
+        EXPECT_EQ(Fast::Sin(angle), s);
+        EXPECT_EQ(Fast::Cos(angle), c);
+    }
+    EXPECT_LE(maxError, kSinCosMaxError);
+}
+
+TEST_F(FastMathTest, InvSqrtWithinBound) {
+    double maxError = 0.0;
+    for (float x = 1e-30f; x < 1e30f; x *= 1.37f) {
+        const double exact = 1.0 / std::sqrt(static_cast<double>(x));
+        maxError = std::max(maxError, std::abs(static_cast<double>(Fast::InvSqrt(x)) - exact) / exact);
+    }
+    EXPECT_LE(maxError, kInvSqrtMaxRelativeError);
+}
+
+TEST_F(FastMathTest, NormalizedWithinBound) {
+    for (const Vector3& v : vectors) {
+        Vector3 fast = Fast::Normalized(v);
+        if (v == Vector3(0.0f, 0.0f, 0.0f)) {
+            EXPECT_VEC3_EQ(fast, v);
+            continue;
+        }
+        EXPECT_NEAR(fast.Magnitude(), 1.0f, kNormalizedMaxLengthError);
+        EXPECT_TRUE(vectorsNear(fast, v.Normalized(), 2e-6f));
+    }
+    EXPECT_NEAR(Fast::Normalized(Vector2(3.0f, 4.0f)).x, 0.6f, 1e-6f);
+    EXPECT_EQ(Fast::Normalized(Vector2(0.0f, 0.0f)), Vector2(0.0f, 0.0f));
+}
+
+TEST_F(FastMathTest, BatchBackendsWithinBound) {
+    for (SimdBackend backend : {SimdBackend::Scalar, SimdBackend::SSE41, SimdBackend::AVX2}) {
+        if (!SetSimdBackend(backend)) {
+            continue;
+        }
+        std::vector<float> sines(angles.size()), cosines(angles.size());
+        Fast::SinCosBatch(angles.data(), sines.data(), cosines.data(), angles.size());
+        for (size_t i = 0; i < angles.size(); ++i) {
+            const double x = static_cast<double>(angles[i]);
+            ASSERT_NEAR(sines[i], std::sin(x), kSinCosMaxError) << GetSimdBackendName(backend) << " x=" << angles[i];
+            ASSERT_NEAR(cosines[i], std::cos(x), kSinCosMaxError) << GetSimdBackendName(backend) << " x=" << angles[i];
+        }
+
+        std::vector<Vector3> normalized = vectors;
+        Fast::NormalizeBatch(normalized.data(), normalized.data(), normalized.size());
+        for (size_t i = 0; i < vectors.size(); ++i) {
+            if (vectors[i] == Vector3(0.0f, 0.0f, 0.0f)) {
+                EXPECT_VEC3_EQ(normalized[i], vectors[i]);
+                continue;
+            }
+            EXPECT_TRUE(vectorsNear(normalized[i], vectors[i].Normalized(), 2e-6f)) << GetSimdBackendName(backend) << " " << i;
+        }
+    }
+}
+
+TEST_F(FastMathTest, OutOfRangeAnglesFallBackToStd) {
+    const std::vector<float> wide = {1e4f, -3e9f, 1e30f, INFINITY, -INFINITY, NAN, 0.5f, 8192.5f, -1e5f};
+    for (float angle : wide) {
+        float s, c;
+        Fast::SinCos(angle, s, c);
+        if (std::isnan(angle) || std::isinf(angle)) {
+            EXPECT_TRUE(std::isnan(s) && std::isnan(c)) << angle;
+        } else {
+            EXPECT_FLOAT_EQ(s, std::sin(angle)) << angle;
+            EXPECT_FLOAT_EQ(c, std::cos(angle)) << angle;
+        }
+    }
+    for (SimdBackend backend : {SimdBackend::Scalar, SimdBackend::SSE41, SimdBackend::AVX2}) {
+        if (!SetSimdBackend(backend)) {
+            continue;
+        }
+        std::vector<float> sines(wide.size()), cosines(wide.size());
+        Fast::SinCosBatch(wide.data(), sines.data(), cosines.data(), wide.size());
+        for (size_t i = 0; i < wide.size(); ++i) {
+            float s, c;
+            Fast::SinCos(wide[i], s, c);
+            EXPECT_TRUE(sines[i] == s || (std::isnan(sines[i]) && std::isnan(s))) << GetSimdBackendName(backend) << " x=" << wide[i];
+            EXPECT_TRUE(cosines[i] == c || (std::isnan(cosines[i]) && std::isnan(c))) << GetSimdBackendName(backend) << " x=" << wide[i];
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "GameEngine/Core/FileSystem.h"
 #include <fstream>
+#include <utility>
 
 using namespace GameEngine::Core;
 
@@ -72,4 +73,61 @@ TEST_F(FileSystemTest, PathUtilities) {
     
     EXPECT_EQ(FileSystem::GetDirectoryPath("path/to/file.txt"), "path/to");
     EXPECT_EQ(FileSystem::GetDirectoryPath("file.txt"), "");
-}
\ No newline at end of file
+}
+
+TEST_F(FileSystemTest, MappedFileView) {
+    ASSERT_TRUE(FileSystem::WriteTextFile(testTextFile, testContent));
+
+    auto mapped = FileSystem::MapFile(testTextFile);
+    ASSERT_TRUE(mapped.has_value());
+    EXPECT_EQ(mapped->Size(), testContent.size());
+    EXPECT_EQ(mapped->View(), testContent);
+    EXPECT_EQ(std::string(mapped->begin(), mapped->end()), testContent);
+    EXPECT_TRUE(mapped->Advise(MappedFile::Access::Random));
+    EXPECT_TRUE(mapped->Advise(MappedFile::Access::WillNeed, 5, 1000));
+    EXPECT_FALSE(mapped->Advise(MappedFile::Access::WillNeed, testContent.size()));
+
+    // Moving transfers the mapping; the source becomes empty
+    MappedFile moved = std::move(*mapped);
+    EXPECT_TRUE(mapped->Empty());
+    EXPECT_EQ(mapped->Data(), nullptr);
+    EXPECT_EQ(moved.View(), testContent);
+    mapped.reset();
+    EXPECT_EQ(moved.View(), testContent);
+}
+
+TEST_F(FileSystemTest, MappedFileEdgeCases) {
+    EXPECT_FALSE(FileSystem::MapFile("nonexistent.bin").has_value());
+    EXPECT_FALSE(FileSystem::MapFile(".").has_value());
+
+    ASSERT_TRUE(FileSystem::WriteBinaryFile(testBinaryFile, {}));
+    auto empty = FileSystem::MapFile(testBinaryFile);
+    ASSERT_TRUE(empty.has_value());
+    EXPECT_TRUE(empty->Empty());
+    EXPECT_TRUE(empty->View().empty());
+    EXPECT_FALSE(empty->Advise(MappedFile::Access::DontNeed));
+
+    auto emptyRead = FileSystem::ReadBinaryFile(testBinaryFile);
+    ASSERT_TRUE(emptyRead.has_value());
+    EXPECT_TRUE(emptyRead->empty());
+}
+
+TEST_F(FileSystemTest, ReadsFilesThatReportNoSize) {
+#ifdef __linux__
+    // procfs files stat as 0 bytes but have content
+    auto status = FileSystem::ReadTextFile("/proc/self/status");
+    ASSERT_TRUE(status.has_value());
+    EXPECT_NE(status->find("Name:"), std::string::npos);
+#endif
+    EXPECT_FALSE(FileSystem::ReadBinaryFile(".").has_value());
+
+    // Larger than one read() chunk, and not a multiple of it
+    std::vector<char> data(10000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i * 7);
+    }
+    ASSERT_TRUE(FileSystem::WriteBinaryFile(testBinaryFile, data));
+    auto readData = FileSystem::ReadBinaryFile(testBinaryFile);
+    ASSERT_TRUE(readData.has_value());
+    EXPECT_EQ(*readData, data);
+}
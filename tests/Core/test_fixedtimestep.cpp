@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/FixedTimestep.h"
+#include <chrono>
+#include <cstdint>
+
+using namespace GameEngine::Core;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+
+TEST(FixedTimestepTest, PaysOutWholeTicks) {
+    FixedTimestep timestep(100.0);
+    EXPECT_EQ(timestep.GetStep(), milliseconds(10));
+    EXPECT_FLOAT_EQ(timestep.GetStepSeconds(), 0.01f);
+    EXPECT_DOUBLE_EQ(timestep.GetTickRate(), 100.0);
+
+    EXPECT_EQ(timestep.Advance(milliseconds(6)), 0u);
+    EXPECT_NEAR(timestep.Alpha(), 0.6f, 1e-6f);
+    EXPECT_EQ(timestep.Advance(milliseconds(6)), 1u);
+    EXPECT_NEAR(timestep.Alpha(), 0.2f, 1e-6f);
+    EXPECT_EQ(timestep.Advance(milliseconds(38)), 4u);
+    EXPECT_NEAR(timestep.Alpha(), 0.0f, 1e-6f);
+    EXPECT_EQ(timestep.GetTickCount(), 5u);
+
+    // Negative elapsed time (a clock hiccup) is ignored
+    EXPECT_EQ(timestep.Advance(milliseconds(-50)), 0u);
+    EXPECT_EQ(timestep.GetTickCount(), 5u);
+}
+
+TEST(FixedTimestepTest, DoesNotDriftOverManyFrames) {
+    // 60 Hz does not divide a second evenly in nanoseconds
+    FixedTimestep timestep(60.0);
+    const nanoseconds frameTime(1000000000 / 144);
+    uint64_t ticks = 0;
+    for (uint32_t frame = 0; frame < 144u * 60u; ++frame) {
+        ticks += timestep.Advance(frameTime);
+    }
+    EXPECT_NEAR(static_cast<double>(ticks), 60.0 * 60.0, 1.0);
+    EXPECT_EQ(timestep.GetDroppedTicks(), 0u);
+}
+
+TEST(FixedTimestepTest, CapsCatchUpTicks) {
+    FixedTimestep timestep(100.0, 4);
+    EXPECT_EQ(timestep.Advance(milliseconds(1005)), 4u);
+    EXPECT_EQ(timestep.GetDroppedTicks(), 96u);
+    // The partial tick survives, so interpolation does not jump
+    EXPECT_NEAR(timestep.Alpha(), 0.5f, 1e-6f);
+    EXPECT_EQ(timestep.Advance(milliseconds(5)), 1u);
+
+    timestep.SetTickRate(50.0);
+    EXPECT_EQ(timestep.Advance(milliseconds(40)), 2u);
+    timestep.Reset();
+    EXPECT_EQ(timestep.GetTickCount(), 0u);
+    EXPECT_EQ(timestep.GetDroppedTicks(), 0u);
+    EXPECT_EQ(timestep.Alpha(), 0.0f);
+}
+
+TEST(FixedTimestepTest, ClampsExtremeTickRates) {
+    FixedTimestep timestep(1e12);
+    EXPECT_EQ(timestep.GetStep().count(), 1);
+    EXPECT_EQ(timestep.GetTickRate(), 1e9);
+    EXPECT_EQ(timestep.Advance(nanoseconds(3)), 3u);
+
+    timestep.SetTickRate(1e-9);
+    EXPECT_EQ(timestep.GetStep(), std::chrono::hours(1));
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/FrameArena.h"
+#include "GameEngine/Core/Math.h"
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+using namespace GameEngine::Core;
+using GameEngine::Math::Matrix4;
+
+static bool isAligned(const void* ptr, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST(FrameArenaTest, AllocatesWithAlignment) {
+    FrameArena arena(1024);
+    EXPECT_EQ(arena.Capacity(), 1024u);
+    EXPECT_EQ(arena.Used(), 0u);
+
+    void* a = arena.Allocate(1, 1);
+    void* b = arena.Allocate(16, 16);
+    void* c = arena.Allocate(64, 64);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    ASSERT_NE(c, nullptr);
+    EXPECT_TRUE(isAligned(b, 16));
+    EXPECT_TRUE(isAligned(c, 64));
+    EXPECT_LT(static_cast<char*>(a), static_cast<char*>(b));
+    EXPECT_LT(static_cast<char*>(b), static_cast<char*>(c));
+    EXPECT_EQ(arena.Used(), 128u);
+}
+
+TEST(FrameArenaTest, TypedAllocation) {
+    FrameArena arena(4096);
+    Matrix4* m = arena.New<Matrix4>(Matrix4::translation(1.0f, 2.0f, 3.0f));
+    ASSERT_NE(m, nullptr);
+    EXPECT_TRUE(isAligned(m, alignof(Matrix4)));
+    EXPECT_FLOAT_EQ((*m)(1, 3), 2.0f);
+
+    float* values = arena.NewArray<float>(100);
+    ASSERT_NE(values, nullptr);
+    for (int i = 0; i < 100; ++i) {
+        values[i] = static_cast<float>(i);
+    }
+    EXPECT_FLOAT_EQ(values[99], 99.0f);
+    EXPECT_FLOAT_EQ((*m)(0, 3), 1.0f);
+}
+
+TEST(FrameArenaTest, ExhaustionReturnsNull) {
+    FrameArena arena(64);
+    EXPECT_NE(arena.Allocate(48), nullptr);
+    EXPECT_EQ(arena.Allocate(32), nullptr);
+    EXPECT_EQ(arena.NewArray<double>(size_t(1) << 60), nullptr);
+    // A failed allocation leaves the arena unchanged
+    EXPECT_EQ(arena.Used(), 48u);
+    EXPECT_NE(arena.Allocate(16, 16), nullptr);
+    EXPECT_EQ(arena.Remaining(), 0u);
+}
+
+TEST(FrameArenaTest, MarkersAndReset) {
+    FrameArena arena(1024);
+    arena.Allocate(100);
+    FrameArena::Marker marker = arena.GetMarker();
+    void* first = arena.Allocate(200);
+    arena.FreeToMarker(marker);
+    EXPECT_EQ(arena.Used(), 100u);
+    EXPECT_EQ(arena.Allocate(200), first);
+
+    {
+        ScopedArenaMarker scope(arena);
+        arena.Allocate(500);
+        EXPECT_GT(arena.Used(), 800u);
+    }
+    EXPECT_LT(arena.Used(), 400u);
+    EXPECT_GT(arena.HighWaterMark(), 800u);
+
+    arena.Reset();
+    EXPECT_EQ(arena.Used(), 0u);
+    arena.ResetHighWaterMark();
+    EXPECT_EQ(arena.HighWaterMark(), 0u);
+}
+
+TEST(FrameArenaTest, MemoryResource) {
+    FrameArena arena(1 << 16);
+    {
+        std::pmr::vector<int> numbers(&arena);
+        for (int i = 0; i < 1000; ++i) {
+            numbers.push_back(i);
+        }
+        EXPECT_EQ(numbers[999], 999);
+        EXPECT_GE(arena.Used(), 1000 * sizeof(int));
+    }
+    EXPECT_TRUE(arena.is_equal(arena));
+    FrameArena other(64);
+    EXPECT_FALSE(arena.is_equal(other));
+
+    EXPECT_THROW(static_cast<void>(other.allocate(128)), std::bad_alloc);
+}
+
+TEST(FrameArenaTest, DoubleBufferedKeepsPreviousFrame) {
+    DoubleBufferedFrameArena arenas(1024);
+
+    arenas.BeginFrame();
+    int* frame1 = arenas.Current().New<int>(1);
+    arenas.BeginFrame();
+    int* frame2 = arenas.Current().New<int>(2);
+    // Frame 1's data survives while frame 2 is built
+    EXPECT_EQ(*frame1, 1);
+    EXPECT_NE(&arenas.Previous(), &arenas.Current());
+    EXPECT_GT(arenas.Previous().Used(), 0u);
+
+    arenas.BeginFrame();
+    EXPECT_EQ(arenas.Current().Used(), 0u);
+    EXPECT_EQ(*frame2, 2);
+}
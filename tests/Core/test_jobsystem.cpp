@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/JobSystem.h"
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+TEST(JobSystemTest, RunsJobsAndCountsThemDown) {
+    JobSystem jobs(3);
+    EXPECT_EQ(jobs.GetWorkerCount(), 3u);
+    EXPECT_EQ(jobs.GetThreadCount(), 4u);
+
+    std::atomic<int> ran{0};
+    JobCounter counter;
+    EXPECT_TRUE(counter.IsDone());
+    for (int i = 0; i < 10000; ++i) {
+        jobs.Run([&ran] { ran.fetch_add(1, std::memory_order_relaxed); }, &counter);
+    }
+    jobs.Wait(counter);
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(ran.load(), 10000);
+
+    // Counters are reusable once done
+    for (int i = 0; i < 100; ++i) {
+        jobs.Run([&ran] { ran.fetch_add(1, std::memory_order_relaxed); }, &counter);
+    }
+    jobs.Wait(counter);
+    EXPECT_EQ(ran.load(), 10100);
+}
+
+TEST(JobSystemTest, LargeCallablesAreStoredOnTheHeap) {
+    JobSystem jobs(2);
+    std::array<int, 64> values{};
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i);
+    }
+    std::atomic<int> sum{0};
+    JobCounter counter;
+    jobs.Run([values, &sum] {
+        int total = 0;
+        for (int value : values) {
+            total += value;
+        }
+        sum = total;
+    }, &counter);
+    jobs.Wait(counter);
+    EXPECT_EQ(sum.load(), 63 * 64 / 2);
+}
+
+TEST(JobSystemTest, RunAfterWaitsForItsDependency) {
+    JobSystem jobs(3);
+    for (int round = 0; round < 50; ++round) {
+        std::vector<int> produced(256, 0);
+        JobCounter produce;
+        JobCounter consume;
+        for (size_t i = 0; i < produced.size(); ++i) {
+            jobs.Run([&produced, i] {
+                std::this_thread::yield();
+                produced[i] = static_cast<int>(i) + 1;
+            }, &produce);
+        }
+        int total = -1;
+        jobs.RunAfter(produce, [&produced, &total] {
+            int sum = 0;
+            for (int value : produced) {
+                sum += value;
+            }
+            total = sum;
+        }, &consume);
+        jobs.Wait(consume);
+        EXPECT_TRUE(produce.IsDone());
+        EXPECT_EQ(total, 256 * 257 / 2);
+    }
+
+    // A dependency that is already done starts the job right away
+    JobCounter done;
+    JobCounter after;
+    std::atomic<bool> ran{false};
+    jobs.RunAfter(done, [&ran] { ran = true; }, &after);
+    jobs.Wait(after);
+    EXPECT_TRUE(ran.load());
+}
+
+TEST(JobSystemTest, ParallelForCoversEveryIndexOnce) {
+    JobSystem jobs(3);
+    std::vector<std::atomic<int>> hits(100003);
+    jobs.ParallelFor(0, hits.size(), [&hits](size_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); });
+    for (size_t i = 0; i < hits.size(); ++i) {
+        ASSERT_EQ(hits[i].load(), 1) << "index " << i;
+    }
+
+    std::atomic<size_t> covered{0};
+    std::atomic<bool> oversized{false};
+    jobs.ParallelForRange(10, 1010, [&](size_t begin, size_t end) {
+        if (end - begin > 7) {
+            oversized = true;
+        }
+        covered.fetch_add(end - begin);
+    }, 7);
+    EXPECT_EQ(covered.load(), 1000u);
+    EXPECT_FALSE(oversized.load());
+
+    bool called = false;
+    jobs.ParallelFor(5, 5, [&called](size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST(JobSystemTest, NestedWaitsAndForeignThreads) {
+    JobSystem jobs(2);
+    std::atomic<int> inner{0};
+    JobCounter outer;
+    for (int i = 0; i < 8; ++i) {
+        // Waiting inside a job runs other jobs instead of blocking a worker
+        jobs.Run([&jobs, &inner] {
+            jobs.ParallelFor(0, 1000, [&inner](size_t) { inner.fetch_add(1, std::memory_order_relaxed); }, 10);
+        }, &outer);
+    }
+    jobs.Wait(outer);
+    EXPECT_EQ(inner.load(), 8000);
+
+    // Threads without a deque submit through the shared queue
+    std::atomic<int> foreign{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&jobs, &foreign] {
+            JobCounter counter;
+            for (int i = 0; i < 500; ++i) {
+                jobs.Run([&foreign] { foreign.fetch_add(1, std::memory_order_relaxed); }, &counter);
+            }
+            jobs.Wait(counter);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(foreign.load(), 2000);
+}
+
+TEST(JobSystemTest, DestructorFinishesQueuedJobs) {
+    std::atomic<int> ran{0};
+    {
+        JobSystem jobs(2);
+        for (int i = 0; i < 1000; ++i) {
+            jobs.Run([&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+        }
+        jobs.WaitIdle();
+        EXPECT_EQ(ran.load(), 1000);
+        for (int i = 0; i < 1000; ++i) {
+            jobs.Run([&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+        }
+    }
+    EXPECT_EQ(ran.load(), 2000);
+}
@@ -1,7 +1,15 @@
 #include <gtest/gtest.h>
 #include "GameEngine/Core/Logger.h"
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <signal.h>
+#include <unistd.h>
 
 using namespace GameEngine::Core;
 
@@ -74,8 +82,137 @@ TEST_F(LoggerTest, MacroUsage) {
     
     std::string logContent = ReadLogFile();
     
-    EXPECT_TRUE(logContent.find("Macro debug") != std::string::npos);
+    // LOG_DEBUG is compiled out below GE_LOG_MIN_LEVEL (release builds)
+    EXPECT_EQ(logContent.find("Macro debug") != std::string::npos, GE_LOG_MIN_LEVEL <= 0);
     EXPECT_TRUE(logContent.find("Macro info") != std::string::npos);
     EXPECT_TRUE(logContent.find("Macro warning") != std::string::npos);
     EXPECT_TRUE(logContent.find("Macro error") != std::string::npos);
-}
\ No newline at end of file
+}
+
+TEST_F(LoggerTest, AsyncLoggingFromManyThreads) {
+    Logger& logger = Logger::GetInstance();
+    logger.Initialize(testLogFile, LogLevel::Debug, LogMode::Asynchronous, 64);
+    EXPECT_EQ(logger.GetMode(), LogMode::Asynchronous);
+
+    // A small ring forces producers to wait on the writer
+    const int kThreads = 4;
+    const int kPerThread = 500;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&logger, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                logger.Info("thread " + std::to_string(t) + " message " + std::to_string(i));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    logger.Flush();
+
+    std::istringstream lines(ReadLogFile());
+    std::string line;
+    std::vector<int> next(kThreads, 0);
+    int count = 0;
+    while (std::getline(lines, line)) {
+        int t = -1;
+        int i = -1;
+        const size_t at = line.find("[INFO] thread ");
+        ASSERT_NE(at, std::string::npos) << line;
+        ASSERT_EQ(std::sscanf(line.c_str() + at, "[INFO] thread %d message %d", &t, &i), 2) << line;
+        // Lines are whole and each thread's lines stay in order
+        EXPECT_EQ(i, next[static_cast<size_t>(t)]++);
+        ++count;
+    }
+    EXPECT_EQ(count, kThreads * kPerThread);
+    logger.Shutdown();
+}
+
+TEST_F(LoggerTest, AsyncLongMessagesAndShutdownDrain) {
+    Logger& logger = Logger::GetInstance();
+    logger.Initialize(testLogFile, LogLevel::Info, LogMode::Asynchronous);
+
+    // Spans several ring records
+    const std::string longMessage(1000, 'x');
+    logger.Debug("filtered out");
+    logger.Info(longMessage);
+    logger.Error("after the long one");
+    // No Flush(): shutdown must drain whatever was accepted
+    logger.Shutdown();
+    EXPECT_EQ(logger.GetMode(), LogMode::Synchronous);
+
+    std::string logContent = ReadLogFile();
+    EXPECT_EQ(logContent.find("filtered out"), std::string::npos);
+    const size_t longAt = logContent.find(longMessage + "\n");
+    ASSERT_NE(longAt, std::string::npos);
+    EXPECT_GT(logContent.find("[ERROR] after the long one"), longAt);
+}
+
+TEST_F(LoggerTest, FormatMacros) {
+    Logger& logger = Logger::GetInstance();
+    logger.Initialize(testLogFile, LogLevel::Info);
+
+    const std::string name = "player";
+    LOG_INFO("spawned %s at (%.1f, %.1f) hp=%d", name.c_str(), 1.5, -2.0, 100);
+    LOG_WARNING(std::string("plain ") + name);
+    LOG_ERROR("100%% done");
+
+    std::string logContent = ReadLogFile();
+    EXPECT_NE(logContent.find("[INFO] spawned player at (1.5, -2.0) hp=100\n"), std::string::npos);
+    EXPECT_NE(logContent.find("[WARNING] plain player\n"), std::string::npos);
+    EXPECT_NE(logContent.find("[ERROR] 100% done\n"), std::string::npos);
+}
+
+TEST_F(LoggerTest, FilteredMacroArgumentsAreNotEvaluated) {
+    Logger& logger = Logger::GetInstance();
+    logger.Initialize(testLogFile, LogLevel::Warning);
+
+    int evaluated = 0;
+    auto expensive = [&evaluated] {
+        ++evaluated;
+        return 42;
+    };
+    LOG_INFO("value %d", expensive());      // Runtime-filtered
+    LOG_DEBUG("value %d", expensive());     // Runtime- or compile-time-filtered
+    LOG_WARNING("value %d", expensive());
+    EXPECT_EQ(evaluated, 1);
+    EXPECT_EQ(ReadLogFile().find("[INFO]"), std::string::npos);
+}
+
+TEST_F(LoggerTest, LongFormattedMessageIsTruncated) {
+    Logger& logger = Logger::GetInstance();
+    logger.Initialize(testLogFile, LogLevel::Debug);
+
+    const std::string big(2 * Logger::kMaxFormattedMessage, 'y');
+    LOG_ERROR("%s", big.c_str());
+
+    std::string logContent = ReadLogFile();
+    const std::string expected = std::string(Logger::kMaxFormattedMessage - 4, 'y') + "...\n";
+    EXPECT_NE(logContent.find("[ERROR] " + expected), std::string::npos);
+}
+
+// Installed before the logger's crash handler, which must chain to it
+static void ExitFromSigInfoHandler(int signal, siginfo_t* info, void*) {
+    _exit(info != nullptr && info->si_signo == signal ? 3 : 4);
+}
+
+using LoggerDeathTest = LoggerTest;
+
+TEST_F(LoggerDeathTest, CrashDrainsAndChainsToSigInfoHandler) {
+    EXPECT_EXIT(
+        {
+            struct sigaction action;
+            std::memset(&action, 0, sizeof(action));
+            action.sa_sigaction = &ExitFromSigInfoHandler;
+            action.sa_flags = SA_SIGINFO;
+            sigemptyset(&action.sa_mask);
+            sigaction(SIGSEGV, &action, nullptr);
+
+            Logger& logger = Logger::GetInstance();
+            logger.Initialize(testLogFile, LogLevel::Debug, LogMode::Asynchronous);
+            logger.Error("Last words");
+            raise(SIGSEGV);
+        },
+        ::testing::ExitedWithCode(3), "");
+    EXPECT_NE(ReadLogFile().find("Last words"), std::string::npos);
+}
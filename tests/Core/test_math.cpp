@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 #include "GameEngine/Core/Math.h"
+#include "../TestUtils.h"
 #include <cmath>
 #include <cstring>
+#include <cfloat>
+#include <algorithm>
+#include <vector>
 
 using namespace GameEngine::Math;
 
@@ -106,20 +110,20 @@ TEST_F(Vector3Test, Magnitude) {
 // Matrices involve lots of floating-point math, so we need epsilon comparisons
 const float EPSILON = 1e-6f;
 
-bool isEqual(float a, float b, float epsilon = EPSILON) {
+static bool isEqual(float a, float b, float epsilon = EPSILON) {
     return std::abs(a - b) < epsilon;
 }
 
-bool matricesEqual(const Matrix4& a, const Matrix4& b, float epsilon = EPSILON) {
+static bool matricesEqual(const Matrix4& a, const Matrix4& b, float epsilon = EPSILON) {
     for (int i = 0; i < 16; ++i) {
-        if (!isEqual(a.m[i], b.m[i], epsilon)) {
+        if (!isEqual(a.data()[i], b.data()[i], epsilon)) {
             return false;
         }
     }
     return true;
 }
 
-bool vectorsEqual(const Vector3& a, const Vector3& b, float epsilon = EPSILON) {
+static bool vectorsEqual(const Vector3& a, const Vector3& b, float epsilon = EPSILON) {
     return isEqual(a.x, b.x, epsilon) && 
            isEqual(a.y, b.y, epsilon) && 
            isEqual(a.z, b.z, epsilon);
@@ -341,9 +345,9 @@ TEST_F(Matrix4Test, RotationPreservesLength) {
     Matrix4 rot = Matrix4::rotationY(M_PI / 7.0f); // Random angle
     Vector3 vector(3.0f, 4.0f, 5.0f);
     
-    float originalLength = vector.magnitude();
+    float originalLength = vector.Magnitude();
     Vector3 rotated = rot.transformDirection(vector);
-    float rotatedLength = rotated.magnitude();
+    float rotatedLength = rotated.Magnitude();
     
     EXPECT_TRUE(isEqual(originalLength, rotatedLength, 1e-5f));
 }
@@ -429,9 +433,9 @@ TEST_F(Matrix4Test, ArrayConstructor) {
     Matrix4 mat(values);
     
     // Test that values are stored correctly (column-major)
-    EXPECT_FLOAT_EQ(mat.data[0], 1.0f);
-    EXPECT_FLOAT_EQ(mat.data[4], 5.0f);
-    EXPECT_FLOAT_EQ(mat.data[15], 16.0f);
+    EXPECT_FLOAT_EQ(mat.data()[0], 1.0f);
+    EXPECT_FLOAT_EQ(mat.data()[4], 5.0f);
+    EXPECT_FLOAT_EQ(mat.data()[15], 16.0f);
 }
 
 // ========== EDGE CASES AND ERROR CONDITIONS ==========
@@ -466,7 +470,338 @@ TEST_F(Matrix4Test, FullCircleRotation) {
     EXPECT_TRUE(vectorsEqual(result, point, 1e-5f));
 }
 
-// ========== PERFORMANCE/STRESS TESTS ==========
+// ========== BATCH TRANSFORM TESTS ==========
+static std::vector<Vector3> makeTestPoints(size_t count) {
+    std::vector<Vector3> points(count);
+    for (size_t i = 0; i < count; ++i) {
+        float f = static_cast<float>(i);
+        points[i] = Vector3(std::sin(f) * 5.0f, std::cos(f * 0.5f) * 3.0f, f * 0.25f - 2.0f);
+    }
+    return points;
+}
+
+static Matrix4 makeTestMatrix(int seed) {
+    float values[16];
+    for (int i = 0; i < 16; ++i) {
+        values[i] = std::sin(static_cast<float>(seed * 16 + i) * 1.37f) * 10.0f;
+    }
+    return Matrix4(values);
+}
+
+static Matrix4 makeTestTransform() {
+    return Matrix4::translation(3.0f, -2.0f, 7.5f) * Matrix4::rotationY(0.7f) *
+           Matrix4::rotationX(-0.3f) * Matrix4::scale(1.5f, 2.0f, 0.5f);
+}
+
+TEST_F(Matrix4Test, BatchTransformMatchesSingle) {
+    const SimdBackend original = GetSimdBackend();
+    Matrix4 mat = makeTestTransform();
+
+    for (SimdBackend backend : {SimdBackend::Scalar, SimdBackend::SSE41, SimdBackend::AVX2}) {
+        if (!SetSimdBackend(backend)) {
+            continue;
+        }
+        // Cover empty input, tails shorter than a SIMD block and several full blocks
+        for (size_t count : {size_t(0), size_t(1), size_t(3), size_t(4), size_t(7), size_t(8), size_t(13), size_t(67)}) {
+            std::vector<Vector3> points = makeTestPoints(count);
+            std::vector<Vector3> outPoints(count), outDirs(count);
+            mat.transformPoints(points.data(), outPoints.data(), count);
+            mat.transformDirections(points.data(), outDirs.data(), count);
+
+            for (size_t i = 0; i < count; ++i) {
+                EXPECT_TRUE(vectorsEqual(outPoints[i], mat.transformPoint(points[i]), 1e-4f))
+                    << GetSimdBackendName(backend) << " count=" << count << " i=" << i;
+                EXPECT_TRUE(vectorsEqual(outDirs[i], mat.transformDirection(points[i]), 1e-4f))
+                    << GetSimdBackendName(backend) << " count=" << count << " i=" << i;
+            }
+        }
+    }
+    SetSimdBackend(original);
+}
+
+TEST_F(Matrix4Test, BatchTransformInPlace) {
+    Matrix4 mat = makeTestTransform();
+    std::vector<Vector3> points = makeTestPoints(21);
+    std::vector<Vector3> expected(points.size());
+    mat.transformPoints(points.data(), expected.data(), points.size());
+
+    mat.transformPointsInPlace(points.data(), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_VEC3_EQ(points[i], expected[i]);
+    }
+
+    std::vector<Vector3> directions = makeTestPoints(21);
+    mat.transformDirections(directions.data(), expected.data(), directions.size());
+    mat.transformDirectionsInPlace(directions.data(), directions.size());
+    for (size_t i = 0; i < directions.size(); ++i) {
+        EXPECT_VEC3_EQ(directions[i], expected[i]);
+    }
+}
+
+TEST_F(Matrix4Test, BatchTransformStrided) {
+    struct Vertex {
+        float position[3];
+        float uv[2];
+    };
+
+    Matrix4 mat = makeTestTransform();
+    std::vector<Vector3> points = makeTestPoints(11);
+    std::vector<Vertex> vertices(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        vertices[i] = {{points[i].x, points[i].y, points[i].z}, {0.5f, 0.25f}};
+    }
+
+    // Read from the interleaved buffer, write packed Vector3s
+    std::vector<Vector3> out(points.size());
+    mat.transformPoints(vertices[0].position, sizeof(Vertex), &out[0].x, sizeof(Vector3), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_TRUE(vectorsEqual(out[i], mat.transformPoint(points[i]), 1e-4f));
+    }
+
+    // In place on the interleaved buffer must leave the other attributes alone
+    mat.transformDirections(vertices[0].position, sizeof(Vertex), vertices[0].position, sizeof(Vertex), vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        Vector3 dir(vertices[i].position[0], vertices[i].position[1], vertices[i].position[2]);
+        EXPECT_TRUE(vectorsEqual(dir, mat.transformDirection(points[i]), 1e-4f));
+        EXPECT_FLOAT_EQ(vertices[i].uv[0], 0.5f);
+        EXPECT_FLOAT_EQ(vertices[i].uv[1], 0.25f);
+    }
+}
+
+TEST_F(Matrix4Test, BatchTransformSoA) {
+    const SimdBackend original = GetSimdBackend();
+    Matrix4 mat = makeTestTransform();
+    std::vector<Vector3> points = makeTestPoints(29);
+    std::vector<float> xs, ys, zs;
+    for (const Vector3& p : points) {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+        zs.push_back(p.z);
+    }
+
+    for (SimdBackend backend : {SimdBackend::Scalar, SimdBackend::SSE41, SimdBackend::AVX2}) {
+        if (!SetSimdBackend(backend)) {
+            continue;
+        }
+        std::vector<float> ox(points.size()), oy(points.size()), oz(points.size());
+        mat.transformPoints(xs.data(), ys.data(), zs.data(), ox.data(), oy.data(), oz.data(), points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            EXPECT_TRUE(vectorsEqual(Vector3(ox[i], oy[i], oz[i]), mat.transformPoint(points[i]), 1e-4f));
+        }
+
+        mat.transformDirections(xs.data(), ys.data(), zs.data(), ox.data(), oy.data(), oz.data(), points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            EXPECT_TRUE(vectorsEqual(Vector3(ox[i], oy[i], oz[i]), mat.transformDirection(points[i]), 1e-4f));
+        }
+    }
+    SetSimdBackend(original);
+}
+
+// ========== INVERSE / AFFINE TRANSFORM TESTS ==========
+static bool affineEqualsMatrix(const AffineTransform& a, const Matrix4& b, float epsilon = 1e-5f) {
+    return matricesEqual(a.toMatrix4(), b, epsilon);
+}
+
+TEST_F(Matrix4Test, GeneralInverse) {
+    // Projective (non-affine) bottom row
+    float values[16] = {
+        2.0f, 0.5f, -1.0f, 0.1f,
+        1.0f, 3.0f, 0.2f, -0.3f,
+        0.4f, -1.0f, 4.0f, 0.25f,
+        5.0f, -2.0f, 1.0f, 1.0f
+    };
+    Matrix4 mat(values);
+    ASSERT_FALSE(mat.isAffine());
+    auto inv = mat.inverse();
+    ASSERT_TRUE(inv.has_value());
+    EXPECT_TRUE(matricesEqual(mat * *inv, Matrix4::identity(), 1e-4f));
+    EXPECT_TRUE(matricesEqual(*inv * mat, Matrix4::identity(), 1e-4f));
+}
+
+TEST_F(Matrix4Test, InverseOfSingularMatrixIsEmpty) {
+    EXPECT_FALSE(Matrix4::scale(0.0f, 1.0f, 1.0f).inverse().has_value());
+    EXPECT_FALSE(Matrix4::scale(1.0f, 0.0f, 1.0f).inverseAffine().has_value());
+}
+
+TEST_F(Matrix4Test, AffineInverseMatchesGeneral) {
+    Matrix4 mat = makeTestTransform();
+    ASSERT_TRUE(mat.isAffine());
+    EXPECT_FALSE(makeTestMatrix(1).isAffine());
+
+    auto general = mat.inverse();
+    auto affine = mat.inverseAffine();
+    ASSERT_TRUE(general.has_value());
+    ASSERT_TRUE(affine.has_value());
+    EXPECT_TRUE(matricesEqual(*general, *affine, 1e-5f));
+    EXPECT_TRUE(matricesEqual(mat * *affine, Matrix4::identity(), 1e-5f));
+}
+
+TEST_F(Matrix4Test, AffineFactoriesMatchMatrix4) {
+    EXPECT_TRUE(affineEqualsMatrix(AffineTransform::identity(), Matrix4::identity()));
+    EXPECT_TRUE(affineEqualsMatrix(AffineTransform::translation(1.0f, -2.0f, 3.0f), Matrix4::translation(1.0f, -2.0f, 3.0f)));
+    EXPECT_TRUE(affineEqualsMatrix(AffineTransform::scale(2.0f, 0.5f, 3.0f), Matrix4::scale(2.0f, 0.5f, 3.0f)));
+    EXPECT_TRUE(affineEqualsMatrix(AffineTransform::scale(1.5f), Matrix4::scale(1.5f)));
+    EXPECT_TRUE(affineEqualsMatrix(AffineTransform::rotationX(0.3f), Matrix4::rotationX(0.3f)));
+    EXPECT_TRUE(affineEqualsMatrix(AffineTransform::rotationY(-1.1f), Matrix4::rotationY(-1.1f)));
+    EXPECT_TRUE(affineEqualsMatrix(AffineTransform::rotationZ(2.0f), Matrix4::rotationZ(2.0f)));
+
+    Matrix4 mat = makeTestTransform();
+    EXPECT_TRUE(affineEqualsMatrix(AffineTransform(mat), mat));
+}
+
+TEST_F(Matrix4Test, AffineCompositionMatchesMatrix4) {
+    AffineTransform a = AffineTransform::translation(10.0f, 5.0f, 0.0f) * AffineTransform::rotationZ(M_PI / 2.0f);
+    AffineTransform b = AffineTransform::scale(2.0f, 3.0f, 4.0f) * AffineTransform::rotationX(0.4f);
+    Matrix4 expected = (Matrix4::translation(10.0f, 5.0f, 0.0f) * Matrix4::rotationZ(M_PI / 2.0f)) *
+                       (Matrix4::scale(2.0f, 3.0f, 4.0f) * Matrix4::rotationX(0.4f));
+
+    AffineTransform combined = a * b;
+    EXPECT_TRUE(affineEqualsMatrix(combined, expected));
+
+    Vector3 point(1.0f, -2.0f, 0.5f);
+    EXPECT_TRUE(vectorsEqual(combined.transformPoint(point), expected.transformPoint(point), 1e-5f));
+    EXPECT_TRUE(vectorsEqual(combined.transformDirection(point), expected.transformDirection(point), 1e-5f));
+}
+
+TEST_F(Matrix4Test, AffineInverse) {
+    AffineTransform transform(makeTestTransform());
+    auto inv = transform.inverse();
+    ASSERT_TRUE(inv.has_value());
+    EXPECT_TRUE(affineEqualsMatrix(transform * *inv, Matrix4::identity()));
+
+    Vector3 point(4.0f, -1.0f, 2.5f);
+    EXPECT_TRUE(vectorsEqual(inv->transformPoint(transform.transformPoint(point)), point, 1e-5f));
+
+    EXPECT_FALSE(AffineTransform::scale(1.0f, 1.0f, 0.0f).inverse().has_value());
+}
+
+TEST_F(Matrix4Test, RigidInverse) {
+    AffineTransform rigid = AffineTransform::translation(3.0f, -7.0f, 2.0f) *
+                            AffineTransform::rotationY(0.8f) * AffineTransform::rotationX(-0.2f);
+    AffineTransform inv = rigid.inverseRigid();
+    EXPECT_TRUE(affineEqualsMatrix(rigid * inv, Matrix4::identity()));
+    EXPECT_TRUE(affineEqualsMatrix(inv, rigid.inverse()->toMatrix4()));
+}
+
+static_assert((AffineTransform::translation(1.0f, 2.0f, 3.0f) * AffineTransform::scale(2.0f))
+                  .transformPoint(Vector3(1.0f, 1.0f, 1.0f)) == Vector3(3.0f, 4.0f, 5.0f),
+              "constexpr AffineTransform composition");
+static_assert(AffineTransform::translation(1.0f, 2.0f, 3.0f).inverseRigid().transformPoint(Vector3(1.0f, 2.0f, 3.0f)) ==
+                  Vector3(0.0f, 0.0f, 0.0f),
+              "constexpr rigid inverse");
+
+// ========== QUATERNION TESTS ==========
+static bool quaternionsEqual(const Quaternion& a, const Quaternion& b, float epsilon = 1e-5f) {
+    return std::abs(a.x - b.x) < epsilon && std::abs(a.y - b.y) < epsilon &&
+           std::abs(a.z - b.z) < epsilon && std::abs(a.w - b.w) < epsilon;
+}
+
+static Quaternion makeTestQuaternion(int seed) {
+    float f = static_cast<float>(seed);
+    return Quaternion(std::sin(f * 1.3f), std::cos(f * 0.7f), std::sin(f * 2.1f + 0.5f), std::cos(f * 0.9f + 0.2f)).Normalized();
+}
+
+TEST_F(Matrix4Test, QuaternionMatchesRotationMatrices) {
+    for (float angle : {0.0f, 0.3f, -1.2f, 2.5f}) {
+        EXPECT_TRUE(matricesEqual(Matrix4::rotation(Quaternion::rotationX(angle)), Matrix4::rotationX(angle)));
+        EXPECT_TRUE(matricesEqual(Matrix4::rotation(Quaternion::rotationY(angle)), Matrix4::rotationY(angle)));
+        EXPECT_TRUE(matricesEqual(Matrix4::rotation(Quaternion::rotationZ(angle)), Matrix4::rotationZ(angle)));
+    }
+    Vector3 axis = Vector3(1.0f, 2.0f, -0.5f).Normalized();
+    Quaternion q = Quaternion::fromAxisAngle(axis, 0.9f);
+    EXPECT_TRUE(vectorsEqual(q.Rotate(axis), axis));
+}
+
+TEST_F(Matrix4Test, QuaternionComposition) {
+    Quaternion a = makeTestQuaternion(1);
+    Quaternion b = makeTestQuaternion(2);
+    EXPECT_TRUE(matricesEqual(Matrix4::rotation(a * b), Matrix4::rotation(a) * Matrix4::rotation(b)));
+
+    Vector3 v(1.5f, -2.0f, 0.25f);
+    EXPECT_TRUE(vectorsEqual((a * b).Rotate(v), a.Rotate(b.Rotate(v))));
+    EXPECT_TRUE(vectorsEqual(a.Rotate(v), Matrix4::rotation(a).transformDirection(v)));
+    EXPECT_TRUE(quaternionsEqual(a * a.Inverse(), Quaternion::identity()));
+    EXPECT_TRUE(quaternionsEqual(a.Inverse(), a.Conjugate()));
+}
+
+TEST_F(Matrix4Test, TRSMatchesChainedProduct) {
+    Vector3 position(3.0f, -1.0f, 8.0f);
+    Vector3 scale(2.0f, 0.5f, 1.5f);
+    Quaternion rotation = makeTestQuaternion(5);
+    Matrix4 expected = Matrix4::translation(position.x, position.y, position.z) * Matrix4::rotation(rotation) * Matrix4::scale(scale);
+    EXPECT_TRUE(matricesEqual(Matrix4::trs(position, rotation, scale), expected));
+}
+
+TEST_F(Matrix4Test, QuaternionInterpolation) {
+    Quaternion start = Quaternion::identity();
+    Quaternion end = Quaternion::rotationZ(1.2f);
+    EXPECT_TRUE(quaternionsEqual(Quaternion::Slerp(start, end, 0.0f), start));
+    EXPECT_TRUE(quaternionsEqual(Quaternion::Slerp(start, end, 1.0f), end));
+    EXPECT_TRUE(quaternionsEqual(Quaternion::Slerp(start, end, 0.25f), Quaternion::rotationZ(0.3f)));
+    // q and -q are the same rotation; both paths take the short arc
+    EXPECT_TRUE(quaternionsEqual(Quaternion::Slerp(start, -end, 0.5f), Quaternion::rotationZ(0.6f)));
+    EXPECT_TRUE(quaternionsEqual(Quaternion::Nlerp(start, -end, 0.5f), Quaternion::rotationZ(0.6f)));
+    EXPECT_NEAR(Quaternion::Nlerp(start, end, 0.3f).Magnitude(), 1.0f, 1e-6f);
+    // Nearly parallel inputs fall back to Nlerp instead of dividing by ~0
+    Quaternion tiny = Quaternion::rotationZ(1e-4f);
+    EXPECT_TRUE(quaternionsEqual(Quaternion::Slerp(start, tiny, 0.5f), Quaternion::rotationZ(5e-5f)));
+}
+
+TEST_F(Matrix4Test, SimdBackendsMatchScalarQuaternionBatch) {
+    const SimdBackend original = GetSimdBackend();
+    const size_t kCount = 37; // Exercises the SIMD tails
+    std::vector<Quaternion> a(kCount), b(kCount);
+    std::vector<Vector3> positions = makeTestPoints(kCount), scales(kCount);
+    std::vector<float> t(kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+        int seed = static_cast<int>(i);
+        a[i] = makeTestQuaternion(seed);
+        // Mix of wide arcs, negative dots and nearly parallel pairs
+        b[i] = (i % 3 == 0) ? a[i] * Quaternion::rotationY(1e-3f) : makeTestQuaternion(seed + 50);
+        if (i % 4 == 1) b[i] = -b[i];
+        t[i] = static_cast<float>(i) / static_cast<float>(kCount - 1);
+        scales[i] = Vector3(1.0f + t[i], 2.0f - t[i], 0.5f);
+    }
+
+    ASSERT_TRUE(SetSimdBackend(SimdBackend::Scalar));
+    std::vector<Quaternion> nlerpRef(kCount), slerpRef(kCount);
+    std::vector<Matrix4> trsRef(kCount);
+    NlerpBatch(a.data(), b.data(), t.data(), nlerpRef.data(), kCount);
+    SlerpBatch(a.data(), b.data(), t.data(), slerpRef.data(), kCount);
+    ComposeTRS(positions.data(), a.data(), scales.data(), trsRef.data(), kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_TRUE(slerpRef[i] == Quaternion::Slerp(a[i], b[i], t[i]));
+        ASSERT_TRUE(matricesEqual(trsRef[i], Matrix4::trs(positions[i], a[i], scales[i])));
+    }
+
+    for (SimdBackend backend : {SimdBackend::SSE41, SimdBackend::AVX2}) {
+        if (!SetSimdBackend(backend)) {
+            continue;
+        }
+        std::vector<Quaternion> nlerp(kCount), slerp(kCount);
+        std::vector<Matrix4> trs(kCount);
+        NlerpBatch(a.data(), b.data(), t.data(), nlerp.data(), kCount);
+        SlerpBatch(a.data(), b.data(), t.data(), slerp.data(), kCount);
+        ComposeTRS(positions.data(), a.data(), scales.data(), trs.data(), kCount);
+        for (size_t i = 0; i < kCount; ++i) {
+            EXPECT_TRUE(quaternionsEqual(nlerp[i], nlerpRef[i], 1e-6f)) << GetSimdBackendName(backend) << " nlerp " << i;
+            EXPECT_TRUE(quaternionsEqual(slerp[i], slerpRef[i], 1e-5f)) << GetSimdBackendName(backend) << " slerp " << i;
+            for (int row = 0; row < 4; ++row) {
+                for (int col = 0; col < 4; ++col) {
+                    EXPECT_NEAR(trs[i](row, col), trsRef[i](row, col), 1e-6f) << GetSimdBackendName(backend) << " trs " << i;
+                }
+            }
+        }
+    }
+    SetSimdBackend(original);
+}
+
+static_assert(Quaternion(1.0f, 0.0f, 0.0f, 0.0f) * Quaternion(0.0f, 1.0f, 0.0f, 0.0f) == Quaternion(0.0f, 0.0f, 1.0f, 0.0f),
+              "constexpr Quaternion product (i * j = k)");
+static_assert(Quaternion(0.0f, 0.0f, 1.0f, 0.0f).Rotate(Vector3(1.0f, 0.0f, 0.0f)) == Vector3(-1.0f, 0.0f, 0.0f),
+              "constexpr Quaternion::Rotate");
+
+// ========== STRESS TESTS ==========
 TEST_F(Matrix4Test, ManyMultiplications) {
     Matrix4 result = Matrix4::identity();
     Matrix4 smallRot = Matrix4::rotationZ(0.01f); // Small rotation
@@ -479,4 +814,114 @@ TEST_F(Matrix4Test, ManyMultiplications) {
     // Total rotation should be 1 radian
     Matrix4 expected = Matrix4::rotationZ(1.0f);
     EXPECT_TRUE(matricesEqual(result, expected, 1e-3f)); // Looser tolerance due to accumulation
-}
\ No newline at end of file
+
+    // The same chain on every backend the CPU supports
+    const SimdBackend original = GetSimdBackend();
+    for (SimdBackend backend : {SimdBackend::Scalar, SimdBackend::SSE41, SimdBackend::AVX2}) {
+        if (!SetSimdBackend(backend)) {
+            continue;
+        }
+        Matrix4 chained = Matrix4::identity();
+        for (int i = 0; i < 100; ++i) {
+            chained = chained * smallRot;
+        }
+        EXPECT_TRUE(matricesEqual(chained, expected, 1e-3f)) << GetSimdBackendName(backend);
+    }
+    SetSimdBackend(original);
+}
+
+// ========== SIMD BACKEND TESTS ==========
+// Scalar and SSE4.1 must agree bit-for-bit; AVX2 uses FMA and may differ by
+// 4 * FLT_EPSILON * sum(|a_ik * b_kj|) per element (see SimdBackend).
+static float productMagnitude(const Matrix4& a, const Matrix4& b, int row, int col) {
+    float sum = 0.0f;
+    for (int k = 0; k < 4; ++k) {
+        sum += std::abs(a(row, k) * b(k, col));
+    }
+    return sum;
+}
+
+TEST_F(Matrix4Test, ScalarBackendAlwaysSupported) {
+    EXPECT_TRUE(IsSimdBackendSupported(SimdBackend::Scalar));
+    EXPECT_TRUE(IsSimdBackendSupported(GetSimdBackend()));
+}
+
+TEST_F(Matrix4Test, SimdBackendsMatchScalarMultiply) {
+    const SimdBackend original = GetSimdBackend();
+
+    for (int seed = 0; seed < 32; ++seed) {
+        Matrix4 a = makeTestMatrix(seed);
+        Matrix4 b = makeTestMatrix(seed + 100);
+
+        ASSERT_TRUE(SetSimdBackend(SimdBackend::Scalar));
+        Matrix4 reference = a * b;
+
+        for (SimdBackend backend : {SimdBackend::SSE41, SimdBackend::AVX2}) {
+            if (!SetSimdBackend(backend)) {
+                continue;
+            }
+            Matrix4 result = a * b;
+            for (int row = 0; row < 4; ++row) {
+                for (int col = 0; col < 4; ++col) {
+                    if (backend == SimdBackend::SSE41) {
+                        EXPECT_EQ(result(row, col), reference(row, col));
+                    } else {
+                        float tolerance = 4.0f * FLT_EPSILON * productMagnitude(a, b, row, col);
+                        EXPECT_NEAR(result(row, col), reference(row, col), tolerance);
+                    }
+                }
+            }
+        }
+    }
+    SetSimdBackend(original);
+}
+
+TEST_F(Matrix4Test, SimdBackendsMatchScalarTransform) {
+    const SimdBackend original = GetSimdBackend();
+    Matrix4 mat = Matrix4::translation(3.0f, -2.0f, 7.5f) * Matrix4::rotationY(0.7f) * Matrix4::scale(1.5f, 2.0f, 0.5f);
+    Vector3 point(1.25f, -4.0f, 9.0f);
+
+    // The inline single-point transforms are the scalar reference
+    Vector3 referencePoint = mat.transformPoint(point);
+    Vector3 referenceDir = mat.transformDirection(point);
+
+    for (SimdBackend backend : {SimdBackend::Scalar, SimdBackend::SSE41, SimdBackend::AVX2}) {
+        if (!SetSimdBackend(backend)) {
+            continue;
+        }
+        Vector3 resultPoint, resultDir;
+        mat.transformPoints(&point, &resultPoint, 1);
+        mat.transformDirections(&point, &resultDir, 1);
+        EXPECT_TRUE(vectorsEqual(resultPoint, referencePoint, 1e-4f)) << GetSimdBackendName(backend);
+        EXPECT_TRUE(vectorsEqual(resultDir, referenceDir, 1e-4f)) << GetSimdBackendName(backend);
+    }
+    SetSimdBackend(original);
+}
+
+// ========== CONSTEXPR TESTS ==========
+// Checked by the compiler: the math types must fold completely when their
+// inputs are constants.
+constexpr Vector3 kConstexprSum = Vector3(1.0f, 2.0f, 3.0f) + Vector3(4.0f, 5.0f, 6.0f) * 2.0f;
+static_assert(kConstexprSum == Vector3(9.0f, 12.0f, 15.0f), "constexpr Vector3 arithmetic");
+static_assert(Vector3(1.0f, 0.0f, 0.0f).Cross(Vector3(0.0f, 1.0f, 0.0f)) == Vector3(0.0f, 0.0f, 1.0f),
+              "constexpr Vector3::Cross");
+static_assert(Vector2(3.0f, 4.0f).MagnitudeSquared() == 25.0f, "constexpr Vector2::MagnitudeSquared");
+
+constexpr Matrix4 kConstexprTranslate = Matrix4::translation(1.0f, 2.0f, 3.0f);
+static_assert(kConstexprTranslate(0, 3) == 1.0f && kConstexprTranslate(2, 3) == 3.0f, "constexpr translation");
+static_assert(kConstexprTranslate.transformPoint(Vector3(1.0f, 1.0f, 1.0f)) == Vector3(2.0f, 3.0f, 4.0f),
+              "constexpr transformPoint");
+#if GE_MATH_HAS_CONSTANT_EVALUATED
+constexpr Matrix4 kConstexprComposed = Matrix4::translation(1.0f, 2.0f, 3.0f) * Matrix4::scale(2.0f);
+static_assert(kConstexprComposed.transformPoint(Vector3(1.0f, 1.0f, 1.0f)) == Vector3(3.0f, 4.0f, 5.0f),
+              "constexpr Matrix4 multiply");
+#endif
+
+TEST_F(Matrix4Test, ConstexprMatchesRuntime) {
+    Matrix4 reference = Matrix4::multiplyScalar(Matrix4::translation(1.0f, 2.0f, 3.0f), Matrix4::scale(2.0f));
+    Matrix4 dispatched = Matrix4::translation(1.0f, 2.0f, 3.0f) * Matrix4::scale(2.0f);
+    EXPECT_TRUE(matricesEqual(reference, dispatched));
+#if GE_MATH_HAS_CONSTANT_EVALUATED
+    EXPECT_TRUE(matricesEqual(kConstexprComposed, dispatched));
+#endif
+}
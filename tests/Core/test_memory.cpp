@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include "GameEngine/Core/Memory.h"
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
 
 using namespace GameEngine::Core;
 
@@ -93,4 +97,170 @@ TEST_F(MemoryPoolTest, MoveSemantics) {
     EXPECT_TRUE(ptr.isValid());
     EXPECT_EQ(ptr->value, 200);
     EXPECT_EQ(pool.UsedCount(), 1);
-}
\ No newline at end of file
+}
+
+TEST_F(MemoryPoolTest, IntrusiveFreeList) {
+    struct Payload { double a, b; };
+    // No side table: the pool is its slots plus a few words of bookkeeping
+    EXPECT_LE(sizeof(MemoryPool<Payload, 1024>), sizeof(Payload) * 1024 + 64);
+
+    MemoryPool<TestObject, 4> pool;
+    TestObject* a = pool.Allocate(1);
+    TestObject* b = pool.Allocate(2);
+    pool.Deallocate(a);
+    // Most recently freed slot is reused first
+    TestObject* c = pool.Allocate(3);
+    EXPECT_EQ(c, a);
+    EXPECT_EQ(b->value, 2);
+
+    TestObject* d = pool.Allocate(4);
+    TestObject* e = pool.Allocate(5);
+    EXPECT_EQ(pool.Allocate(6), nullptr);
+    EXPECT_EQ(pool.UsedCount(), 4u);
+
+    for (TestObject* obj : {b, c, d, e}) {
+        pool.Deallocate(obj);
+    }
+    EXPECT_EQ(pool.AvailableCount(), 4u);
+    EXPECT_EQ(TestObject::destructorCalls, 5);
+}
+
+TEST_F(MemoryPoolTest, PoolPtrWithGrowablePool) {
+    GrowableMemoryPool<TestObject, 8> pool;
+    {
+        PoolPtr<TestObject> ptr(pool.Allocate(300), &pool);
+        PoolPtr<TestObject> moved = std::move(ptr);
+        EXPECT_FALSE(ptr.isValid());
+        EXPECT_EQ(moved->value, 300);
+        EXPECT_EQ(pool.UsedCount(), 1u);
+    }
+    EXPECT_EQ(pool.UsedCount(), 0u);
+    EXPECT_EQ(TestObject::destructorCalls, 1);
+}
+
+// ========== GROWABLE POOL TESTS ==========
+// Counters in TestObject are not atomic; threaded tests use this instead
+struct Particle {
+    float position[3];
+    float velocity[3];
+    int owner;
+
+    explicit Particle(int owner_ = 0) : position{0.0f, 0.0f, 0.0f}, velocity{1.0f, 0.0f, 0.0f}, owner(owner_) {}
+};
+
+TEST_F(MemoryPoolTest, GrowablePoolGrowsInsteadOfFailing) {
+    GrowableMemoryPool<TestObject, 4> pool;
+    EXPECT_EQ(pool.ChunkCount(), 0u);
+
+    std::vector<TestObject*> objects;
+    for (int i = 0; i < 10; ++i) {
+        TestObject* obj = pool.Allocate(i);
+        ASSERT_NE(obj, nullptr);
+        objects.push_back(obj);
+    }
+    EXPECT_EQ(pool.UsedCount(), 10u);
+    EXPECT_EQ(pool.ChunkCount(), 3u);
+    EXPECT_EQ(pool.CapacityCount(), 12u);
+    EXPECT_EQ(TestObject::constructorCalls, 10);
+
+    // Growth never moves live objects
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(objects[static_cast<size_t>(i)]->value, i);
+    }
+
+    for (TestObject* obj : objects) {
+        pool.Deallocate(obj);
+    }
+    EXPECT_EQ(TestObject::destructorCalls, 10);
+    EXPECT_EQ(pool.UsedCount(), 0u);
+    EXPECT_EQ(pool.AvailableCount(), 12u);
+
+    // Freed slots are reused before growing again
+    TestObject* again = pool.Allocate(99);
+    EXPECT_EQ(pool.ChunkCount(), 3u);
+    pool.Deallocate(again);
+    pool.Deallocate(nullptr);
+}
+
+TEST_F(MemoryPoolTest, GrowablePoolHighWaterMark) {
+    GrowableMemoryPool<Particle, 64> pool;
+    std::vector<Particle*> particles;
+    for (int i = 0; i < 100; ++i) {
+        particles.push_back(pool.Allocate(i));
+    }
+    for (Particle* p : particles) {
+        pool.Deallocate(p);
+    }
+    // 100 live at the peak; the thread cache may hold a few more slots
+    EXPECT_GE(pool.HighWaterMark(), 100u);
+    EXPECT_LE(pool.HighWaterMark(), 100u + 64u);
+    EXPECT_EQ(pool.UsedCount(), 0u);
+
+    pool.ResetHighWaterMark();
+    EXPECT_LT(pool.HighWaterMark(), 100u);
+}
+
+TEST_F(MemoryPoolTest, GrowablePoolMultiThreadedChurn) {
+    GrowableMemoryPool<Particle, 128> pool;
+    const int kThreads = 4;
+    const int kIterations = 20000;
+    std::atomic<bool> corrupted{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&pool, &corrupted, t]() {
+            std::vector<Particle*> live;
+            for (int i = 0; i < kIterations; ++i) {
+                live.push_back(pool.Allocate(t));
+                if (i % 3 == 2 && live.size() >= 2) {
+                    // Free two, oldest first, checking nobody else wrote them
+                    for (int k = 0; k < 2; ++k) {
+                        if (live.front()->owner != t) corrupted = true;
+                        pool.Deallocate(live.front());
+                        live.erase(live.begin());
+                    }
+                }
+                if (live.size() > 64) {
+                    for (Particle* p : live) {
+                        if (p->owner != t) corrupted = true;
+                        pool.Deallocate(p);
+                    }
+                    live.clear();
+                }
+            }
+            for (Particle* p : live) {
+                pool.Deallocate(p);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(corrupted);
+    EXPECT_EQ(pool.UsedCount(), 0u);
+    EXPECT_GT(pool.HighWaterMark(), 0u);
+}
+
+TEST_F(MemoryPoolTest, GrowablePoolCrossThreadFree) {
+    GrowableMemoryPool<Particle, 32> pool;
+    std::vector<Particle*> produced;
+    std::thread producer([&]() {
+        for (int i = 0; i < 1000; ++i) {
+            produced.push_back(pool.Allocate(i));
+        }
+    });
+    producer.join();
+
+    std::set<Particle*> unique(produced.begin(), produced.end());
+    EXPECT_EQ(unique.size(), produced.size());
+    EXPECT_EQ(pool.UsedCount(), 1000u);
+
+    std::thread consumer([&]() {
+        for (Particle* p : produced) {
+            pool.Deallocate(p);
+        }
+    });
+    consumer.join();
+    EXPECT_EQ(pool.UsedCount(), 0u);
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/MemoryTracker.h"
+#include "GameEngine/Core/Memory.h"
+#include "GameEngine/Core/FrameArena.h"
+#include "GameEngine/Core/SlabAllocator.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace GameEngine::Core;
+
+namespace {
+
+size_t FixedReserve(const void*) {
+    return 4096;
+}
+
+bool HasLeak(const std::string& tag) {
+    for (const MemoryStats& leak : MemoryTracker::GetInstance().Leaks()) {
+        if (leak.tag == tag) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+TEST(MemoryTrackerTest, CountsBytesPeakAndFragmentation) {
+    AllocationTracker tracker("TrackerCounts", &FixedReserve, nullptr);
+    tracker.OnAllocate(64, 48);
+    tracker.OnAllocate(32, 32);
+    tracker.OnFree(64, 48);
+    tracker.OnAllocate(16, 16);
+
+    auto stats = MemoryTracker::GetInstance().Query("TrackerCounts");
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->bytesInUse, 48u);
+    EXPECT_EQ(stats->requestedBytes, 48u);
+    EXPECT_EQ(stats->peakBytes, 96u);
+    EXPECT_EQ(stats->reservedBytes, 4096u);
+    EXPECT_EQ(stats->liveAllocations, 2u);
+    EXPECT_EQ(stats->totalAllocations, 3u);
+    EXPECT_EQ(stats->totalFrees, 1u);
+    EXPECT_DOUBLE_EQ(stats->InternalFragmentation(), 0.0);
+    EXPECT_DOUBLE_EQ(stats->Utilization(), 48.0 / 4096.0);
+
+    tracker.OnAllocate(64, 16);
+    EXPECT_DOUBLE_EQ(tracker.Snapshot().InternalFragmentation(), 48.0 / 112.0);
+}
+
+TEST(MemoryTrackerTest, PerFrameRates) {
+    AllocationTracker tracker("TrackerFrames", nullptr, nullptr);
+    MemoryTracker& memory = MemoryTracker::GetInstance();
+
+    memory.BeginFrame();
+    tracker.OnAllocate(8, 8);
+    tracker.OnAllocate(8, 8);
+    memory.BeginFrame();
+    EXPECT_EQ(tracker.Snapshot().allocationsLastFrame, 2u);
+    EXPECT_EQ(tracker.Snapshot().bytesAllocatedLastFrame, 16u);
+
+    tracker.OnFree(8, 8);
+    memory.BeginFrame();
+    EXPECT_EQ(tracker.Snapshot().allocationsLastFrame, 0u);
+}
+
+TEST(MemoryTrackerTest, RewindReleasesArenaBytes) {
+    AllocationTracker tracker("TrackerRewind", nullptr, nullptr, false);
+    tracker.OnAllocate(40, 32);
+    tracker.OnAllocate(24, 24);
+    tracker.OnRewind(40);
+    EXPECT_EQ(tracker.Snapshot().bytesInUse, 40u);
+    EXPECT_EQ(tracker.Snapshot().liveAllocations, 2u);
+
+    tracker.OnRewind(0);
+    MemoryStats stats = tracker.Snapshot();
+    EXPECT_EQ(stats.bytesInUse, 0u);
+    EXPECT_EQ(stats.liveAllocations, 0u);
+    EXPECT_EQ(stats.totalFrees, 2u);
+    EXPECT_EQ(stats.peakBytes, 64u);
+
+    // Arenas never leak
+    tracker.OnAllocate(8, 8);
+    EXPECT_FALSE(HasLeak("TrackerRewind"));
+}
+
+TEST(MemoryTrackerTest, LeakReport) {
+    {
+        AllocationTracker tracker("TrackerLeaky", nullptr, nullptr);
+        tracker.OnAllocate(128, 100);
+        EXPECT_TRUE(HasLeak("TrackerLeaky"));
+
+        AllocationTracker clean("TrackerClean", nullptr, nullptr);
+        clean.OnAllocate(16, 16);
+        clean.OnFree(16, 16);
+    }
+    // Still reported after the allocator is gone
+    EXPECT_TRUE(HasLeak("TrackerLeaky"));
+    EXPECT_FALSE(HasLeak("TrackerClean"));
+    EXPECT_FALSE(MemoryTracker::GetInstance().Query("TrackerLeaky").has_value());
+
+    std::ostringstream out;
+    EXPECT_GE(MemoryTracker::GetInstance().ReportLeaks(out), 1u);
+    EXPECT_NE(out.str().find("Leak: TrackerLeaky has 1 live allocations (128 bytes)"), std::string::npos);
+}
+
+TEST(MemoryTrackerTest, DumpToFile) {
+    AllocationTracker tracker("TrackerDump", &FixedReserve, nullptr);
+    tracker.OnAllocate(1024, 1000);
+
+    const std::string path = "memory_tracker_test_report.txt";
+    ASSERT_TRUE(MemoryTracker::GetInstance().DumpToFile(path));
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_NE(contents.str().find("Memory report:"), std::string::npos);
+    EXPECT_NE(contents.str().find("TrackerDump"), std::string::npos);
+    std::remove(path.c_str());
+
+    tracker.OnFree(1024, 1000);
+}
+
+#if GE_MEMORY_TRACKING
+TEST(MemoryTrackerTest, TaggedAllocatorsReport) {
+    MemoryTracker& memory = MemoryTracker::GetInstance();
+
+    MemoryPool<double, 16> pool("TaggedPool");
+    double* d = pool.Allocate(1.0);
+    EXPECT_EQ(memory.Query("TaggedPool")->bytesInUse, sizeof(double));
+    EXPECT_EQ(memory.Query("TaggedPool")->reservedBytes, 16 * sizeof(double));
+    pool.Deallocate(d);
+    EXPECT_EQ(memory.Query("TaggedPool")->liveAllocations, 0u);
+
+    GrowableMemoryPool<int, 8> growable("TaggedGrowable");
+    int* values[9];
+    for (int i = 0; i < 9; ++i) {
+        values[i] = growable.Allocate(i);
+    }
+    EXPECT_EQ(memory.Query("TaggedGrowable")->liveAllocations, 9u);
+    EXPECT_EQ(memory.Query("TaggedGrowable")->reservedBytes, 16 * sizeof(void*));
+    for (int* value : values) {
+        growable.Deallocate(value);
+    }
+
+    FrameArena arena(256, "TaggedArena");
+    arena.Allocate(1, 1);
+    arena.Allocate(16, 16);
+    MemoryStats arenaStats = *memory.Query("TaggedArena");
+    EXPECT_EQ(arenaStats.bytesInUse, arena.Used());
+    EXPECT_EQ(arenaStats.requestedBytes, 17u);
+    arena.Reset();
+    EXPECT_EQ(memory.Query("TaggedArena")->bytesInUse, 0u);
+
+    SlabAllocator slab("TaggedSlab");
+    void* p = slab.Allocate(100);
+    MemoryStats slabStats = *memory.Query("TaggedSlab");
+    EXPECT_EQ(slabStats.bytesInUse, SlabAllocator::SizeClassSize(SlabAllocator::SizeClassIndex(100)));
+    EXPECT_EQ(slabStats.requestedBytes, 100u);
+    EXPECT_GT(slabStats.InternalFragmentation(), 0.0);
+    EXPECT_GE(slabStats.reservedBytes, slabStats.bytesInUse);
+    slab.Deallocate(p, 100);
+
+    // Untagged allocators are not registered
+    const size_t before = memory.Snapshot().size();
+    MemoryPool<double, 16> untagged;
+    untagged.Deallocate(untagged.Allocate(2.0));
+    EXPECT_EQ(memory.Snapshot().size(), before);
+}
+#endif
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/Profiler.h"
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace GameEngine::Core;
+
+#if GE_PROFILER
+
+namespace {
+
+size_t CountOccurrences(const std::string& text, const std::string& pattern) {
+    size_t count = 0;
+    for (size_t at = text.find(pattern); at != std::string::npos; at = text.find(pattern, at + pattern.size())) {
+        ++count;
+    }
+    return count;
+}
+
+std::string ChromeTrace() {
+    std::ostringstream out;
+    Profiler::WriteChromeTrace(out);
+    return out.str();
+}
+
+// Starts each test with an empty, enabled profiler
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Profiler::Clear();
+        Profiler::SetEnabled(true);
+    }
+    void TearDown() override { Profiler::SetEnabled(false); }
+};
+
+} // namespace
+
+TEST_F(ProfilerTest, TraceHasZonesCountersAndThreads) {
+    {
+        PROFILE_SCOPE("Outer");
+        for (int i = 0; i < 3; ++i) {
+            PROFILE_SCOPE("Inner \"quoted\"");
+        }
+        PROFILE_COUNTER("Entities", 42);
+    }
+    std::thread worker([] {
+        Profiler::SetThreadName("Test worker");
+        PROFILE_SCOPE("OnWorker");
+    });
+    worker.join();
+    PROFILE_FRAME();
+
+    const std::string trace = ChromeTrace();
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+    EXPECT_EQ(CountOccurrences(trace, "{\"name\":\"Outer\",\"ph\":\"X\""), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "{\"name\":\"Inner \\\"quoted\\\"\",\"ph\":\"X\""), 3u);
+    EXPECT_EQ(CountOccurrences(trace, "{\"name\":\"OnWorker\",\"ph\":\"X\""), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "\"args\":{\"name\":\"Test worker\"}"), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "\"ph\":\"C\""), 1u);
+    EXPECT_NE(trace.find("\"args\":{\"value\":42.000}"), std::string::npos);
+    EXPECT_EQ(CountOccurrences(trace, "\"ph\":\"i\""), 1u);
+    EXPECT_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+
+    // Clear() hides everything recorded so far
+    Profiler::Clear();
+    EXPECT_EQ(CountOccurrences(ChromeTrace(), "\"ph\":"), 0u);
+}
+
+TEST_F(ProfilerTest, SummaryCoversTheLastFrame) {
+    EXPECT_TRUE(Profiler::SummarizeLastFrame().zones.empty());
+    PROFILE_FRAME();
+    {
+        PROFILE_SCOPE("Previous frame");
+    }
+    PROFILE_FRAME();
+    for (int i = 0; i < 2; ++i) {
+        PROFILE_SCOPE("Sleep");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    {
+        PROFILE_SCOPE("Quick");
+    }
+    PROFILE_FRAME();
+
+    const Profiler::FrameSummary summary = Profiler::SummarizeLastFrame();
+    EXPECT_EQ(summary.frame, 3u);
+    EXPECT_GE(summary.frameMs, 3.5);
+    ASSERT_EQ(summary.zones.size(), 2u);
+    EXPECT_EQ(summary.zones[0].name, "Sleep");
+    EXPECT_EQ(summary.zones[0].calls, 2u);
+    EXPECT_GE(summary.zones[0].totalMs, 3.5);
+    EXPECT_LE(summary.zones[0].totalMs, summary.frameMs);
+    EXPECT_GE(summary.zones[0].maxMs, 1.75);
+    EXPECT_EQ(summary.zones[1].name, "Quick");
+    EXPECT_NE(summary.ToString().find("Sleep"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, DisabledRecordsNothing) {
+    Profiler::SetEnabled(false);
+    {
+        PROFILE_SCOPE("Hidden");
+        PROFILE_COUNTER("Hidden", 1);
+    }
+    PROFILE_FRAME();
+    // A zone open while enabling is skipped rather than half-timed
+    {
+        PROFILE_SCOPE("Straddling");
+        Profiler::SetEnabled(true);
+    }
+    EXPECT_EQ(ChromeTrace().find("\"name\":"), std::string::npos);
+
+    // Runtime names are copied
+    std::string name = "Dynamic";
+    const char* interned = Profiler::InternName(name);
+    name = "Changed";
+    {
+        PROFILE_SCOPE(interned);
+    }
+    EXPECT_EQ(interned, Profiler::InternName("Dynamic"));
+    EXPECT_EQ(CountOccurrences(ChromeTrace(), "\"Dynamic\""), 1u);
+}
+
+TEST_F(ProfilerTest, RingKeepsNewestEvents) {
+    // A thread of its own, so its ring holds nothing else
+    std::thread writer([] {
+        for (size_t i = 0; i < Detail::ProfileThreadBuffer::kCapacity + 1000; ++i) {
+            PROFILE_SCOPE("Flood");
+        }
+    });
+    writer.join();
+    const size_t recorded = CountOccurrences(ChromeTrace(), "\"Flood\"");
+    // The slot after the newest event is treated as possibly torn
+    EXPECT_GE(recorded, Detail::ProfileThreadBuffer::kCapacity - 1);
+    EXPECT_LE(recorded, Detail::ProfileThreadBuffer::kCapacity);
+}
+
+#endif
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/SlabAllocator.h"
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+static bool isAligned(const void* ptr, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST(SlabAllocatorTest, SizeClasses) {
+    EXPECT_EQ(SlabAllocator::SizeClassSize(SlabAllocator::SizeClassIndex(0)), 16u);
+    EXPECT_EQ(SlabAllocator::SizeClassSize(SlabAllocator::SizeClassIndex(1)), 16u);
+    EXPECT_EQ(SlabAllocator::SizeClassSize(SlabAllocator::SizeClassIndex(17)), 32u);
+    EXPECT_EQ(SlabAllocator::SizeClassSize(SlabAllocator::SizeClassIndex(129)), 160u);
+    EXPECT_EQ(SlabAllocator::SizeClassSize(SlabAllocator::SizeClassIndex(4096)), 4096u);
+    EXPECT_EQ(SlabAllocator::SizeClassIndex(4096), SlabAllocator::kSizeClassCount - 1);
+
+    // Every size fits its class, and the class below is too small
+    for (size_t size = 1; size <= SlabAllocator::kMaxSmallSize; ++size) {
+        const size_t index = SlabAllocator::SizeClassIndex(size);
+        ASSERT_GE(SlabAllocator::SizeClassSize(index), size);
+        if (index > 0) {
+            ASSERT_LT(SlabAllocator::SizeClassSize(index - 1), size);
+        }
+    }
+}
+
+TEST(SlabAllocatorTest, AllocateAndReuse) {
+    SlabAllocator allocator;
+    std::vector<void*> blocks;
+    for (size_t size = 8; size <= SlabAllocator::kMaxSmallSize; size *= 2) {
+        void* ptr = allocator.Allocate(size);
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_TRUE(isAligned(ptr, SlabAllocator::kSmallAlignment));
+        std::memset(ptr, 0xAB, size);
+        blocks.push_back(ptr);
+    }
+    EXPECT_GT(allocator.UsedBytes(), 0u);
+    EXPECT_EQ(allocator.LargeAllocationCount(), 0u);
+
+    size_t size = 8;
+    for (void* ptr : blocks) {
+        allocator.Deallocate(ptr, size);
+        size *= 2;
+    }
+    EXPECT_EQ(allocator.UsedBytes(), 0u);
+
+    // A freed block is handed out again for the same class
+    void* first = allocator.Allocate(100);
+    allocator.Deallocate(first, 100);
+    EXPECT_EQ(allocator.Allocate(110), first);
+    allocator.Deallocate(first, 110);
+}
+
+TEST(SlabAllocatorTest, LargeAndOverAlignedFallback) {
+    SlabAllocator allocator;
+    void* large = allocator.Allocate(100000);
+    void* aligned = allocator.Allocate(64, 64);
+    EXPECT_TRUE(isAligned(aligned, 64));
+    EXPECT_EQ(allocator.LargeAllocationCount(), 2u);
+    EXPECT_EQ(allocator.UsedBytes(), 100064u);
+
+    allocator.Deallocate(large, 100000);
+    allocator.Deallocate(aligned, 64, 64);
+    EXPECT_EQ(allocator.LargeAllocationCount(), 0u);
+    EXPECT_EQ(allocator.UsedBytes(), 0u);
+}
+
+TEST(SlabAllocatorTest, TypedAllocation) {
+    SlabAllocator allocator;
+    std::string* name = allocator.New<std::string>("slab allocated string that is too long for SSO");
+    EXPECT_EQ(name->size(), 46u);
+    allocator.Delete(name);
+    allocator.Delete<std::string>(nullptr);
+    EXPECT_EQ(allocator.UsedBytes(), 0u);
+}
+
+TEST(SlabAllocatorTest, MemoryResource) {
+    SlabAllocator allocator;
+    {
+        std::pmr::map<int, std::pmr::string> names(&allocator);
+        for (int i = 0; i < 1000; ++i) {
+            names.emplace(i, std::pmr::string(static_cast<size_t>(i % 64 + 20), 'x'));
+        }
+        EXPECT_EQ(names.size(), 1000u);
+        EXPECT_EQ(names[999].size(), static_cast<size_t>(999 % 64 + 20));
+        EXPECT_GT(allocator.UsedBytes(), 0u);
+    }
+    EXPECT_EQ(allocator.UsedBytes(), 0u);
+
+    SlabAllocator other;
+    EXPECT_TRUE(allocator.is_equal(allocator));
+    EXPECT_FALSE(allocator.is_equal(other));
+}
+
+TEST(SlabAllocatorTest, MultiThreadedMixedSizes) {
+    SlabAllocator allocator;
+    const int kThreads = 4;
+    std::vector<std::thread> threads;
+    std::vector<int> errors(kThreads, 0);
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&allocator, &errors, t]() {
+            std::vector<std::pair<unsigned char*, size_t>> live;
+            for (int i = 0; i < 20000; ++i) {
+                const size_t size = static_cast<size_t>((i * 37 + t * 11) % 600 + 1);
+                auto* ptr = static_cast<unsigned char*>(allocator.Allocate(size));
+                ptr[0] = static_cast<unsigned char>(t);
+                ptr[size - 1] = static_cast<unsigned char>(t);
+                live.emplace_back(ptr, size);
+                if (live.size() > 100) {
+                    for (auto& [block, blockSize] : live) {
+                        if (block[0] != t || block[blockSize - 1] != t) ++errors[static_cast<size_t>(t)];
+                        allocator.Deallocate(block, blockSize);
+                    }
+                    live.clear();
+                }
+            }
+            for (auto& [block, blockSize] : live) {
+                allocator.Deallocate(block, blockSize);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (int count : errors) {
+        EXPECT_EQ(count, 0);
+    }
+    EXPECT_EQ(allocator.UsedBytes(), 0u);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/SlotMap.h"
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace GameEngine::Core;
+
+TEST(SlotMapTest, InsertAndGet) {
+    SlotMap<std::string> map;
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(sizeof(SlotMap<std::string>::Handle), 4u);
+
+    auto a = map.Insert("alpha");
+    auto b = map.Emplace(3, 'b');
+    EXPECT_FALSE(a.IsNull());
+    EXPECT_NE(a, b);
+    EXPECT_EQ(map.Size(), 2u);
+    ASSERT_NE(map.Get(a), nullptr);
+    EXPECT_EQ(*map.Get(a), "alpha");
+    EXPECT_EQ(*map.Get(b), "bbb");
+
+    SlotMap<std::string>::Handle null;
+    EXPECT_TRUE(null.IsNull());
+    EXPECT_FALSE(map.Contains(null));
+    EXPECT_EQ(map.Get(null), nullptr);
+}
+
+TEST(SlotMapTest, EraseInvalidatesHandles) {
+    SlotMap<int> map;
+    auto a = map.Insert(1);
+    auto b = map.Insert(2);
+    auto c = map.Insert(3);
+
+    EXPECT_TRUE(map.Erase(a));
+    EXPECT_FALSE(map.Erase(a));
+    EXPECT_FALSE(map.Contains(a));
+    EXPECT_EQ(map.Get(a), nullptr);
+    // The other values survive the swap-remove
+    EXPECT_EQ(*map.Get(b), 2);
+    EXPECT_EQ(*map.Get(c), 3);
+
+    // The freed slot is reused with a new generation; the old handle stays stale
+    auto d = map.Insert(4);
+    EXPECT_EQ(d.Index(), a.Index());
+    EXPECT_NE(d.Generation(), a.Generation());
+    EXPECT_EQ(map.Get(a), nullptr);
+    EXPECT_EQ(*map.Get(d), 4);
+}
+
+TEST(SlotMapTest, DenseIteration) {
+    SlotMap<int> map;
+    std::vector<SlotMap<int>::Handle> handles;
+    for (int i = 0; i < 100; ++i) {
+        handles.push_back(map.Insert(i));
+    }
+    for (int i = 0; i < 100; i += 3) {
+        map.Erase(handles[static_cast<size_t>(i)]);
+    }
+
+    // Values stay contiguous and every dense index maps back to its handle
+    std::set<int> seen;
+    for (size_t i = 0; i < map.Size(); ++i) {
+        EXPECT_EQ(map.Get(map.HandleAt(i)), map.Data() + i);
+        seen.insert(map.Data()[i]);
+    }
+    EXPECT_EQ(seen.size(), 66u);
+    EXPECT_EQ(seen.count(0), 0u);
+    EXPECT_EQ(seen.count(1), 1u);
+
+    int sum = 0;
+    for (int value : map) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 4950 - (0 + 99) * 34 / 2);
+}
+
+TEST(SlotMapTest, ClearAndMoveOnlyValues) {
+    SlotMap<std::unique_ptr<int>> map;
+    auto a = map.Insert(std::make_unique<int>(7));
+    auto b = map.Insert(std::make_unique<int>(8));
+    map.Erase(a);
+    EXPECT_EQ(**map.Get(b), 8);
+
+    map.Clear();
+    EXPECT_TRUE(map.Empty());
+    EXPECT_FALSE(map.Contains(b));
+    auto c = map.Insert(std::make_unique<int>(9));
+    EXPECT_EQ(**map.Get(c), 9);
+}
+
+TEST(SlotMapTest, GenerationWrapRetiresSlot) {
+    SlotMap<int> map;
+    auto first = map.Insert(0);
+    const uint32_t slot = first.Index();
+
+    // Cycle the only slot until its generation is exhausted
+    SlotMap<int>::Handle handle = first;
+    std::set<uint32_t> generations;
+    while (handle.Index() == slot) {
+        generations.insert(handle.Generation());
+        map.Erase(handle);
+        handle = map.Insert(1);
+    }
+    EXPECT_EQ(generations.size(), (1u << (32 - SlotMap<int>::kIndexBits)) - 1);
+    // No handle ever issued for the retired slot is accepted
+    EXPECT_FALSE(map.Contains(first));
+    EXPECT_EQ(map.Size(), 1u);
+}
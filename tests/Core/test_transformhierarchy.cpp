@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/TransformHierarchy.h"
+#include "../TestUtils.h"
+#include <cmath>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace GameEngine::Math;
+using NodeId = TransformHierarchy::NodeId;
+
+static bool transformsNear(const AffineTransform& a, const AffineTransform& b, float epsilon = 1e-4f) {
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            if (std::abs(a(row, col) - b(row, col)) > epsilon) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static AffineTransform makeLocal(size_t seed) {
+    float f = static_cast<float>(seed);
+    return AffineTransform(Matrix4::trs(Vector3(std::sin(f), 1.0f, std::cos(f) * 0.5f),
+                                        Quaternion::rotationY(f * 0.1f), Vector3(1.0f, 1.0f, 1.0f)));
+}
+
+// Runs tasks on a few short-lived threads; stands in for a job system.
+static void threadedFor(size_t count, const std::function<void(size_t)>& task) {
+    const size_t kThreads = 4;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = t; i < count; i += kThreads) {
+                task(i);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+class TransformHierarchyTest : public ::testing::Test {
+protected:
+    // Recomputes a node's world transform by walking its parent chain
+    AffineTransform ExpectedWorld(NodeId id) const {
+        AffineTransform world = hierarchy.GetLocalTransform(id);
+        for (NodeId p = hierarchy.GetParent(id); p != TransformHierarchy::kInvalidNode; p = hierarchy.GetParent(p)) {
+            world = hierarchy.GetLocalTransform(p) * world;
+        }
+        return world;
+    }
+
+    void ExpectAllWorldsCorrect() const {
+        for (size_t i = 0; i < hierarchy.Size(); ++i) {
+            NodeId id = hierarchy.GetNodeAt(i);
+            EXPECT_TRUE(transformsNear(hierarchy.GetWorldTransform(id), ExpectedWorld(id))) << "node " << id;
+        }
+    }
+
+    // Parents precede children and every subtree is contiguous
+    void ExpectDepthFirstLayout() const {
+        for (size_t i = 0; i < hierarchy.Size(); ++i) {
+            NodeId id = hierarchy.GetNodeAt(i);
+            EXPECT_EQ(hierarchy.GetIndex(id), i);
+            NodeId parent = hierarchy.GetParent(id);
+            if (parent != TransformHierarchy::kInvalidNode) {
+                EXPECT_LT(hierarchy.GetIndex(parent), i);
+            }
+        }
+    }
+
+    // Builds a tree where node i's parent is node (i - 1) / branching
+    std::vector<NodeId> BuildTree(size_t count, size_t branching) {
+        std::vector<NodeId> ids;
+        for (size_t i = 0; i < count; ++i) {
+            NodeId parent = i == 0 ? TransformHierarchy::kInvalidNode : ids[(i - 1) / branching];
+            ids.push_back(hierarchy.CreateNode(parent, makeLocal(i)));
+        }
+        return ids;
+    }
+
+    TransformHierarchy hierarchy;
+};
+
+TEST_F(TransformHierarchyTest, ParentChildComposition) {
+    NodeId root = hierarchy.CreateNode(TransformHierarchy::kInvalidNode, AffineTransform::translation(10.0f, 0.0f, 0.0f));
+    NodeId child = hierarchy.CreateNode(root, AffineTransform::rotationZ(static_cast<float>(M_PI) / 2.0f));
+    NodeId grandchild = hierarchy.CreateNode(child, AffineTransform::translation(1.0f, 0.0f, 0.0f));
+    EXPECT_EQ(hierarchy.Size(), 3u);
+    EXPECT_EQ(hierarchy.GetParent(grandchild), child);
+    EXPECT_TRUE(hierarchy.HasPendingUpdates());
+
+    hierarchy.UpdateWorldTransforms();
+    EXPECT_FALSE(hierarchy.HasPendingUpdates());
+    EXPECT_EQ(hierarchy.GetLastUpdateCount(), 3u);
+    Vector3 origin = hierarchy.GetWorldTransform(grandchild).transformPoint(Vector3(0.0f, 0.0f, 0.0f));
+    EXPECT_NEAR(origin.x, 10.0f, 1e-5f);
+    EXPECT_NEAR(origin.y, 1.0f, 1e-5f);
+}
+
+TEST_F(TransformHierarchyTest, InvalidParentIsRejected) {
+    EXPECT_EQ(hierarchy.CreateNode(42), TransformHierarchy::kInvalidNode);
+    EXPECT_TRUE(hierarchy.Empty());
+}
+
+TEST_F(TransformHierarchyTest, ChildrenInsertedOutOfOrderKeepDepthFirstLayout) {
+    NodeId a = hierarchy.CreateNode();
+    NodeId b = hierarchy.CreateNode();
+    NodeId a1 = hierarchy.CreateNode(a, makeLocal(1));
+    NodeId b1 = hierarchy.CreateNode(b, makeLocal(2));
+    NodeId a2 = hierarchy.CreateNode(a, makeLocal(3));
+    hierarchy.CreateNode(a1, makeLocal(4));
+    hierarchy.CreateNode(b1, makeLocal(5));
+
+    ExpectDepthFirstLayout();
+    EXPECT_LT(hierarchy.GetIndex(a2), hierarchy.GetIndex(b));
+    hierarchy.UpdateWorldTransforms();
+    ExpectAllWorldsCorrect();
+}
+
+TEST_F(TransformHierarchyTest, OnlyDirtySubtreesAreUpdated) {
+    std::vector<NodeId> ids = BuildTree(40, 3);
+    hierarchy.UpdateWorldTransforms();
+    EXPECT_EQ(hierarchy.GetLastUpdateCount(), 40u);
+
+    // Unchanged scene: nothing to do
+    hierarchy.UpdateWorldTransforms();
+    EXPECT_EQ(hierarchy.GetLastUpdateCount(), 0u);
+
+    // A leaf only recomputes itself
+    hierarchy.SetLocalTransform(ids[39], makeLocal(100));
+    hierarchy.UpdateWorldTransforms();
+    EXPECT_EQ(hierarchy.GetLastUpdateCount(), 1u);
+
+    // Node 1 and its descendants (4..6, 13..21) are 13 nodes; marking a
+    // descendant as well must not update it twice
+    hierarchy.SetLocalTransform(ids[13], makeLocal(101));
+    hierarchy.SetLocalTransform(ids[1], makeLocal(102));
+    hierarchy.SetLocalTransform(ids[1], makeLocal(103));
+    hierarchy.UpdateWorldTransforms();
+    EXPECT_EQ(hierarchy.GetLastUpdateCount(), 13u);
+    ExpectAllWorldsCorrect();
+}
+
+TEST_F(TransformHierarchyTest, DestroyRemovesSubtree) {
+    std::vector<NodeId> ids = BuildTree(13, 3);
+    hierarchy.UpdateWorldTransforms();
+
+    hierarchy.DestroyNode(ids[1]); // 1, 4, 5, 6
+    EXPECT_EQ(hierarchy.Size(), 9u);
+    EXPECT_FALSE(hierarchy.IsValid(ids[1]));
+    EXPECT_FALSE(hierarchy.IsValid(ids[5]));
+    EXPECT_TRUE(hierarchy.IsValid(ids[7]));
+    ExpectDepthFirstLayout();
+
+    // Freed ids are reused
+    NodeId reused = hierarchy.CreateNode(ids[2], makeLocal(50));
+    EXPECT_TRUE(reused == ids[1] || reused == ids[4] || reused == ids[5] || reused == ids[6]);
+    hierarchy.SetLocalTransform(ids[0], makeLocal(51));
+    hierarchy.UpdateWorldTransforms();
+    ExpectDepthFirstLayout();
+    ExpectAllWorldsCorrect();
+}
+
+TEST_F(TransformHierarchyTest, Reparenting) {
+    std::vector<NodeId> ids = BuildTree(13, 3);
+    hierarchy.UpdateWorldTransforms();
+
+    EXPECT_TRUE(hierarchy.SetParent(ids[1], ids[12]));
+    EXPECT_EQ(hierarchy.GetParent(ids[1]), ids[12]);
+    EXPECT_EQ(hierarchy.GetParent(ids[4]), ids[1]);
+    ExpectDepthFirstLayout();
+    hierarchy.UpdateWorldTransforms();
+    ExpectAllWorldsCorrect();
+
+    // Cycles are refused
+    EXPECT_FALSE(hierarchy.SetParent(ids[0], ids[4]));
+    EXPECT_FALSE(hierarchy.SetParent(ids[1], ids[1]));
+
+    EXPECT_TRUE(hierarchy.SetParent(ids[3], TransformHierarchy::kInvalidNode));
+    EXPECT_EQ(hierarchy.GetParent(ids[3]), TransformHierarchy::kInvalidNode);
+    ExpectDepthFirstLayout();
+    hierarchy.UpdateWorldTransforms();
+    ExpectAllWorldsCorrect();
+}
+
+TEST_F(TransformHierarchyTest, ParallelUpdateMatchesSerial) {
+    std::vector<NodeId> ids = BuildTree(2000, 4);
+    TransformHierarchy serial = hierarchy;
+
+    hierarchy.UpdateWorldTransforms(threadedFor, 16);
+    serial.UpdateWorldTransforms();
+    EXPECT_EQ(hierarchy.GetLastUpdateCount(), serial.GetLastUpdateCount());
+    for (NodeId id : ids) {
+        ASSERT_TRUE(transformsNear(hierarchy.GetWorldTransform(id), serial.GetWorldTransform(id), 0.0f));
+    }
+
+    // Dirty root plus a dirty subtree deep inside it
+    hierarchy.SetLocalTransform(ids[0], makeLocal(7000));
+    hierarchy.SetLocalTransform(ids[500], makeLocal(7001));
+    hierarchy.UpdateWorldTransforms(threadedFor, 16);
+    EXPECT_EQ(hierarchy.GetLastUpdateCount(), 2000u);
+    ExpectAllWorldsCorrect();
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include "GameEngine/Core/Vector3SoA.h"
+#include "../TestUtils.h"
+#include <cstdint>
+#include <vector>
+
+using namespace GameEngine::Math;
+
+class Vector3SoATest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (size_t i = 0; i < 19; ++i) {
+            float f = static_cast<float>(i);
+            a.push_back(Vector3(f + 1.0f, -2.0f * f, 0.5f * f + 3.0f));
+            b.push_back(Vector3(0.25f * f, f - 4.0f, 1.0f));
+        }
+    }
+
+    std::vector<Vector3> a, b;
+};
+
+TEST_F(Vector3SoATest, ConstructionAndAccess) {
+    Vector3SoA empty;
+    EXPECT_TRUE(empty.Empty());
+
+    Vector3SoA zeros(5);
+    EXPECT_EQ(zeros.Size(), 5u);
+    EXPECT_VEC3_EQ(zeros.Get(4), Vector3(0.0f, 0.0f, 0.0f));
+
+    zeros.Set(2, Vector3(1.0f, 2.0f, 3.0f));
+    EXPECT_VEC3_EQ(zeros.Get(2), Vector3(1.0f, 2.0f, 3.0f));
+    EXPECT_FLOAT_EQ(zeros.Y()[2], 2.0f);
+
+    zeros.PushBack(Vector3(7.0f, 8.0f, 9.0f));
+    EXPECT_EQ(zeros.Size(), 6u);
+    EXPECT_VEC3_EQ(zeros.Get(5), Vector3(7.0f, 8.0f, 9.0f));
+}
+
+TEST_F(Vector3SoATest, StreamsAreAligned) {
+    Vector3SoA soa(a);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(soa.X()) % 32, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(soa.Y()) % 32, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(soa.Z()) % 32, 0u);
+}
+
+TEST_F(Vector3SoATest, AoSRoundTrip) {
+    Vector3SoA soa(a);
+    ASSERT_EQ(soa.Size(), a.size());
+    std::vector<Vector3> back = soa.ToAoS();
+    ASSERT_EQ(back.size(), a.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_VEC3_EQ(back[i], a[i]);
+    }
+}
+
+TEST_F(Vector3SoATest, AddScaleMultiplyAdd) {
+    Vector3SoA sa(a), sb(b);
+
+    sa.Add(sb);
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_VEC3_EQ(sa.Get(i), a[i] + b[i]);
+    }
+
+    sa.Scale(2.0f);
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_VEC3_EQ(sa.Get(i), (a[i] + b[i]) * 2.0f);
+    }
+
+    Vector3SoA sc(a);
+    sc.MultiplyAdd(sb, 0.5f);
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_VEC3_EQ(sc.Get(i), a[i] + b[i] * 0.5f);
+    }
+
+    // The operand may be the container itself
+    Vector3SoA sd(a);
+    sd.Add(sd);
+    sd.MultiplyAdd(sd, 0.5f);
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_VEC3_EQ(sd.Get(i), a[i] * 3.0f);
+    }
+}
+
+TEST_F(Vector3SoATest, DotAndCross) {
+    Vector3SoA sa(a), sb(b), cross;
+    std::vector<float> dots(a.size());
+
+    sa.Dot(sb, dots.data());
+    sa.Cross(sb, cross);
+    ASSERT_EQ(cross.Size(), a.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_FLOAT_EQ(dots[i], a[i].Dot(b[i]));
+        EXPECT_VEC3_EQ(cross.Get(i), a[i].Cross(b[i]));
+    }
+}
+
+TEST_F(Vector3SoATest, LengthAndNormalize) {
+    a[3] = Vector3(0.0f, 0.0f, 0.0f); // Inside a SIMD block
+    a.back() = Vector3(0.0f, 0.0f, 0.0f); // In the scalar tail
+    Vector3SoA sa(a);
+    std::vector<float> lengths(a.size());
+
+    sa.Length(lengths.data());
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_FLOAT_EQ(lengths[i], a[i].Magnitude());
+    }
+
+    sa.Normalize();
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_VEC3_EQ(sa.Get(i), a[i].Normalized());
+    }
+    EXPECT_VEC3_EQ(sa.Get(3), Vector3(0.0f, 0.0f, 0.0f));
+}
+
+// ========== STRESS TESTS ==========
+TEST_F(Vector3SoATest, IntegrateAndNormalizeMatchesAoS) {
+    const size_t kCount = 1003; // Not a multiple of any vector width
+    const int kRounds = 20;
+    const float dt = 0.016f;
+
+    std::vector<Vector3> positions(kCount), velocities(kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+        float f = static_cast<float>(i);
+        positions[i] = Vector3(f, f * 0.5f, -f);
+        velocities[i] = Vector3(1.0f, 0.5f + f * 1e-4f, -0.25f);
+    }
+    Vector3SoA soaPositions(positions), soaVelocities(velocities);
+
+    for (int round = 0; round < kRounds; ++round) {
+        for (size_t i = 0; i < kCount; ++i) {
+            positions[i] += velocities[i] * dt;
+            velocities[i] = velocities[i].Normalized();
+        }
+        soaPositions.MultiplyAdd(soaVelocities, dt);
+        soaVelocities.Normalize();
+    }
+
+    for (size_t i = 0; i < kCount; ++i) {
+        EXPECT_NEAR(soaPositions.Get(i).x, positions[i].x, 1e-2f) << i;
+        EXPECT_NEAR(soaPositions.Get(i).y, positions[i].y, 1e-2f) << i;
+        EXPECT_NEAR(soaPositions.Get(i).z, positions[i].z, 1e-2f) << i;
+    }
+}
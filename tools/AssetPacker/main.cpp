@@ -0,0 +1,48 @@
+#include "GameEngine/Core/AssetArchive.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// Packs every file under a directory into one asset archive.
+//
+//   GameEngineAssetPacker <output.pack> <directory> [--lz4] [--align <bytes>]
+int main(int argc, char** argv) {
+    using namespace GameEngine::Core;
+
+    std::string output;
+    std::string directory;
+    AssetPack::Compression compression = AssetPack::Compression::None;
+    unsigned long alignment = AssetPack::kDefaultAlignment;
+    bool valid = true;
+    for (int i = 1; i < argc && valid; ++i) {
+        if (std::strcmp(argv[i], "--lz4") == 0) {
+            compression = AssetPack::Compression::Lz4;
+        } else if (std::strcmp(argv[i], "--align") == 0 && i + 1 < argc) {
+            alignment = std::strtoul(argv[++i], nullptr, 10);
+            valid = alignment != 0 && (alignment & (alignment - 1)) == 0 && alignment <= 65536;
+        } else if (argv[i][0] == '-') {
+            valid = false;
+        } else if (output.empty()) {
+            output = argv[i];
+        } else if (directory.empty()) {
+            directory = argv[i];
+        } else {
+            valid = false;
+        }
+    }
+    if (!valid || directory.empty()) {
+        std::cerr << "usage: " << argv[0] << " <output.pack> <directory> [--lz4] [--align <bytes>]\n";
+        return 2;
+    }
+
+    AssetArchiveBuilder builder(static_cast<uint32_t>(alignment));
+    const size_t added = builder.AddDirectory(directory, compression);
+    std::string error;
+    if (!builder.Write(output, &error)) {
+        std::cerr << error << '\n';
+        return 1;
+    }
+    std::cout << "packed " << added << " files into " << output << '\n';
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include "GameEngine/Core/BinaryLog.h"
+#include "GameEngine/Core/FileSystem.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Turns a binary log written in LogMode::Binary back into text or JSON.
+//
+//   GameEngineLogDecoder <log.bin> [--json] [-o <output>]
+int main(int argc, char** argv) {
+    using namespace GameEngine::Core;
+
+    std::string input;
+    std::string output;
+    BinaryLog::DecodeFormat format = BinaryLog::DecodeFormat::Text;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0) {
+            format = BinaryLog::DecodeFormat::Json;
+        } else if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (input.empty() && argv[i][0] != '-') {
+            input = argv[i];
+        } else {
+            input.clear();
+            break;
+        }
+    }
+    if (input.empty()) {
+        std::cerr << "usage: " << argv[0] << " <log.bin> [--json] [-o <output>]\n";
+        return 2;
+    }
+
+    // Decoded straight from the mapping; the log is never copied
+    auto log = FileSystem::MapFile(input, MappedFile::Access::Sequential);
+    if (!log) {
+        std::cerr << "cannot open " << input << '\n';
+        return 1;
+    }
+    std::ofstream file;
+    if (!output.empty()) {
+        file.open(output);
+        if (!file.is_open()) {
+            std::cerr << "cannot write " << output << '\n';
+            return 1;
+        }
+    }
+
+    std::string error;
+    if (!BinaryLog::Decode(log->View(), output.empty() ? std::cout : file, format, &error)) {
+        std::cerr << input << ": " << error << '\n';
+        return 1;
+    }
+    return 0;
+}